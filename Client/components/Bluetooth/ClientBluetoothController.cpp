@@ -205,9 +205,19 @@ esp_err_t ClientBluetoothControlller::GetCharacteristicByUUID(esp_gatt_if_t gatt
 esp_err_t ClientBluetoothControlller::WriteCharacteristic(esp_gatt_if_t gattc_if, uint16_t connectionID,
 																													uint16_t characterissticHandle, std::vector<uint8_t> &value,
 																													esp_gatt_write_type_t writeType, esp_gatt_auth_req_t authenticationRequest)
+{
+	return WriteCharacteristic(gattc_if, connectionID, characterissticHandle, value.data(), value.size(), writeType, authenticationRequest);
+}
+
+/**
+ * @brief Write characteristic value
+ */
+esp_err_t ClientBluetoothControlller::WriteCharacteristic(esp_gatt_if_t gattc_if, uint16_t connectionID,
+																													uint16_t characterissticHandle, uint8_t *value, uint16_t length,
+																													esp_gatt_write_type_t writeType, esp_gatt_auth_req_t authenticationRequest)
 {
 	auto result = esp_ble_gattc_write_char(gattc_if, connectionID, characterissticHandle,
-																				 value.size(), value.data(), writeType, authenticationRequest);
+																				 length, value, writeType, authenticationRequest);
 
 	if (result)
 		ESP_LOGE(CLIENT_BLUETOOTH_CONTROLLER_TAG, "Writing characteristic value failed");
@@ -166,6 +166,23 @@ namespace Greenhouse
 			esp_err_t WriteCharacteristic(esp_gatt_if_t gattc_if, uint16_t connectionID, uint16_t characterissticHandle, std::vector<uint8_t> &value,
 																		esp_gatt_write_type_t writeType, esp_gatt_auth_req_t authenticationRequest);
 
+			/**
+			 * @brief Write characteristic value
+			 *
+			 * @param[in]  gattc_if               : Gatt client access interface
+			 * @param[in]  connectionID           : Connection ID
+			 * @param[in]  characterissticHandle  : The characteristic value to write
+			 * @param[in]  value               		: Pointer to data to be written
+			 * @param[in]  length               	: Length of data to be written
+			 * @param[in]  writeType     					: The type of attribute write operation
+			 * @param[in]  authenticationRequest  : Authentication request
+			 *
+			 * @return esp_err_t    ESP_OK  : success
+			 *                      Other   : failed
+			 */
+			esp_err_t WriteCharacteristic(esp_gatt_if_t gattc_if, uint16_t connectionID, uint16_t characterissticHandle, uint8_t *value,
+																		uint16_t length, esp_gatt_write_type_t writeType, esp_gatt_auth_req_t authenticationRequest);
+
 		private:
 			/* Default scan parameters */
 			esp_ble_scan_params_t ble_scan_params = {
@@ -21,7 +21,7 @@ using namespace Greenhouse::Bluetooth;
 /**
  * @brief Class constructor
  */
-ClientBluetoothHandler::ClientBluetoothHandler() : mRemoteDevice{CONFIG_BLUETOOTH_SERVER}, mConnected{false}
+ClientBluetoothHandler::ClientBluetoothHandler() : mRemoteDevice{CONFIG_BLUETOOTH_SERVER}, mConnected{false}, mMTU{GATT_DEFAULT_MTU}
 {
 }
 
@@ -29,7 +29,7 @@ ClientBluetoothHandler::ClientBluetoothHandler() : mRemoteDevice{CONFIG_BLUETOOT
  * @brief Class constructor with controller parameter
  */
 ClientBluetoothHandler::ClientBluetoothHandler(std::weak_ptr<ClientBluetoothControlller> controller)
-		: mBluetoothController(controller), mRemoteDevice{CONFIG_BLUETOOTH_SERVER}, mConnected{false}
+		: mBluetoothController(controller), mRemoteDevice{CONFIG_BLUETOOTH_SERVER}, mConnected{false}, mMTU{GATT_DEFAULT_MTU}
 {
 }
 
@@ -197,6 +197,8 @@ void ClientBluetoothHandler::GreenhouseEventHandler(esp_gattc_cb_event_t event,
 	}
 	case (ESP_GATTC_WRITE_CHAR_EVT):
 	{
+		GreenhouseManager::GetInstance()->HandleFrameWriteResult(param->write.status == ESP_GATT_OK);
+
 		if (param->write.status != ESP_GATT_OK)
 		{
 			ESP_LOGE(CLIENT_BLUETOOTH_HANDLER_TAG, "Write operation failed, error status = 0x%x", param->write.status);
@@ -244,6 +246,7 @@ void ClientBluetoothHandler::GreenhouseEventHandler(esp_gattc_cb_event_t event,
 		}
 
 		ESP_LOGI(CLIENT_BLUETOOTH_HANDLER_TAG, "MTU configuration was successful, MTU set to %d", param->cfg_mtu.mtu);
+		mMTU = param->cfg_mtu.mtu;
 		break;
 	}
 	case (ESP_GATTC_CONNECT_EVT):
@@ -294,6 +297,14 @@ const bool &ClientBluetoothHandler::GetReferenceToConnectionState() const
 	return mConnected;
 }
 
+/**
+ * @brief Get MTU negotiated with remote device
+ */
+uint16_t ClientBluetoothHandler::GetMTU() const
+{
+	return mMTU;
+}
+
 /*********************************************
  *              PRIVATE API                  *
  ********************************************/
@@ -452,6 +463,11 @@ void ClientBluetoothHandler::HandleDisconnection(esp_gatt_conn_reason_t reason)
 {
 	ESP_LOGI(CLIENT_BLUETOOTH_HANDLER_TAG, "Client was disconnected with reason = 0x%x", reason);
 
+	// MTU has to be negotiated again on next connection
+	mMTU = GATT_DEFAULT_MTU;
+
+	GreenhouseManager::GetInstance()->HandleServerDisconnection();
+
 	auto profile = mProfilesMap.find(GREENHOUSE_PROFILE);
 	if (profile == mProfilesMap.end())
 		return;
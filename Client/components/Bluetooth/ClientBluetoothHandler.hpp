@@ -107,6 +107,13 @@ namespace Greenhouse
              */
             const bool &GetReferenceToConnectionState() const;
 
+            /**
+             * @brief Get MTU negotiated with remote device
+             *
+             * @return uint16_t     : Negotiated MTU or GATT_DEFAULT_MTU before exchange
+             */
+            uint16_t GetMTU() const;
+
         private:
             /**
              * @brief Method to check if incoming event is registration event
@@ -175,6 +182,9 @@ namespace Greenhouse
             // Value should never be set via the assign operator.
             // !!! Use SetConnectionStatus method instead !!!
             bool mConnected;
+
+            /* MTU negotiated with remote device */
+            uint16_t mMTU;
         };
     } // namespace Bluetooth
 } // namespace Greenhouse
@@ -5,18 +5,43 @@
 /* ESP log library */
 #include "esp_log.h"
 
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 /* STD library */
+#include <algorithm>
+#include <array>
 #include <cmath>
 
+/* Common components */
+#include "Common_components/Convertors/DataType/BytePacking.hpp"
+
 #define PERFORMING_INTERVAL 60000 * 3
 
+// Duration of single shot measurement
+#define SINGLE_SHOT_DURATION 5000
+
+// Bits of data ready status which are zero while data is not ready
+#define DATA_READY_MASK 0x07FF
+
+// Period of samples in periodic measurement
+#define PERIODIC_INTERVAL 5000
+#define LOW_POWER_PERIODIC_INTERVAL 30000
+
+// Ticks between polls of data ready status while sample is due
+#define ACQUISITION_POLL_INTERVAL 500
+
+// Ticks to wait until acquisition task finishes its bus transfer
+#define ACQUISITION_STOP_TIMEOUT 1000
+
 using namespace Sensor;
 
 /**
  * @brief Class constructor
  */
 SCD4x::SCD4x(uint8_t i2C_address, I2C *i2c)
-    : AirSensor_I(i2C_address, i2c)
+    : AirSensor_I(i2C_address, i2c), mSampleInterval(PERIODIC_INTERVAL), mAcquisitionRunning(false), mAcquisitionTask(nullptr)
 {
     // Sensor need 1000 ms to enter the idle state
     vTaskDelay(1000);
@@ -31,6 +56,8 @@ SCD4x::SCD4x(uint8_t i2C_address, I2C *i2c)
  */
 SCD4x::~SCD4x()
 {
+    StopAcquisition();
+
     if (mTemperature)
         delete mTemperature;
     if (mHumanity)
@@ -44,8 +71,8 @@ SCD4x::~SCD4x()
  */
 std::string SCD4x::SerialNumber() const
 {
-    std::vector<uint8_t> serial_number;
-    if (SendCommand(GET_SERIAL_NUMBER, 1, 2, serial_number, 9) != I2C_OperationResult::I2C_OK)
+    std::array<uint8_t, 3 * SENSOR_WORD_SIZE> serial_number;
+    if (SendCommand(GET_SERIAL_NUMBER, 1, 2, serial_number) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGE(SCD4x_TAG, "Failed to get sensor serial number");
         return std::string();
@@ -59,6 +86,10 @@ std::string SCD4x::SerialNumber() const
  */
 float SCD4x::GetTemperature() const
 {
+    AirWindow window;
+    if (IsAcquisitionRunning() && GetWindow(SCD4x_AVERAGE_WINDOW, window))
+        return window.temperature.mean;
+
     return *mTemperature;
 }
 
@@ -67,6 +98,10 @@ float SCD4x::GetTemperature() const
  */
 float SCD4x::GetHumanity() const
 {
+    AirWindow window;
+    if (IsAcquisitionRunning() && GetWindow(SCD4x_AVERAGE_WINDOW, window))
+        return window.humidity.mean;
+
     return *mHumanity;
 }
 
@@ -75,50 +110,172 @@ float SCD4x::GetHumanity() const
  */
 uint16_t SCD4x::GetCO2() const
 {
+    AirWindow window;
+    if (IsAcquisitionRunning() && GetWindow(SCD4x_AVERAGE_WINDOW, window))
+        return static_cast<uint16_t>(std::lround(window.co2.mean));
+
     return *mCO2;
 }
 
 /**
  * @brief Start periodic measurement
  */
-void SCD4x::StartPeriodicMeasurement(const bool enable_low_power) const
+bool SCD4x::StartPeriodicMeasurement(const bool enable_low_power) const
 {
     auto command = enable_low_power ? START_LOW_POWER_PERIODIC_MEASUREMENT : START_PERIODIC_MEASUREMENT;
 
-    if (SendCommand(command, 0, 2) != I2C_OperationResult::I2C_OK)
-        ESP_LOGE(SCD4x_TAG, "Unable to start period measurement");
+    if (SendCommand(command, 0, 2) == I2C_OperationResult::I2C_OK)
+        return true;
+
+    ESP_LOGE(SCD4x_TAG, "Unable to start period measurement");
+    return false;
 }
 
 /**
  * @brief Stop periodic measurement
  */
-void SCD4x::StopPeriodicMeasurement() const
+bool SCD4x::StopPeriodicMeasurement() const
 {
-    if (SendCommand(STOP_PERIODIC_MEASUREMENT, 500, 2) != I2C_OperationResult::I2C_OK)
-        ESP_LOGE(SCD4x_TAG, "Unable to stop period measurement");
+    if (SendCommand(STOP_PERIODIC_MEASUREMENT, 500, 2) == I2C_OperationResult::I2C_OK)
+        return true;
+
+    ESP_LOGE(SCD4x_TAG, "Unable to stop period measurement");
+    return false;
 }
 
 /**
- * @brief Trigger measurement on sensor (Single shot)
+ * @brief Start periodic measurement and background task which buffers its samples
  */
-void SCD4x::Measure()
+bool SCD4x::StartAcquisition(const bool enable_low_power)
 {
-    // Send command to measure air values
-    if (SendCommand(MEASURE_SINGLE_SHOT, 5000, 2) != I2C_OperationResult::I2C_OK)
+    if (IsAcquisitionRunning())
+        return true;
+
+    if (GetMeasurementState() != MeasurementState::MEASUREMENT_IDLE)
     {
-        ESP_LOGE(SCD4x_TAG, "Measurement failed");
-        return;
+        ESP_LOGE(SCD4x_TAG, "Acquisition can not start while single shot measurement is converting");
+        return false;
     }
 
-    std::vector<uint8_t> measured_values;
-    // Send command to read measured values
-    if (SendCommand(READ_MEASUREMENT, 1, 2, measured_values, 9) != I2C_OperationResult::I2C_OK)
     {
-        ESP_LOGE(SCD4x_TAG, "Failed to read measured values");
+        std::lock_guard<std::mutex> lock(mSamplesMutex);
+        mSamples.Clear();
+    }
+
+    if (!StartPeriodicMeasurement(enable_low_power))
+        return false;
+
+    mSampleInterval = enable_low_power ? LOW_POWER_PERIODIC_INTERVAL : PERIODIC_INTERVAL;
+    mAcquisitionRunning = true;
+
+    TaskHandle_t task{nullptr};
+    if (xTaskCreate(&SCD4x::AcquisitionTask, "SCD4x_Acquisition", SCD4x_ACQUISITION_STACK_SIZE, this, tskIDLE_PRIORITY + 1, &task) != pdPASS)
+    {
+        ESP_LOGE(SCD4x_TAG, "Unable to create acquisition task");
+        mAcquisitionRunning = false;
+        StopPeriodicMeasurement();
+        return false;
+    }
+
+    mAcquisitionTask = task;
+    ESP_LOGI(SCD4x_TAG, "Acquisition started with sample interval %d ms", static_cast<int>(mSampleInterval));
+    return true;
+}
+
+/**
+ * @brief Stop background task and periodic measurement
+ */
+void SCD4x::StopAcquisition()
+{
+    if (!mAcquisitionRunning)
         return;
+
+    mAcquisitionRunning = false;
+
+    // Task may be sleeping for the whole sample interval
+    TaskHandle_t task = mAcquisitionTask;
+    if (task)
+        xTaskNotifyGive(task);
+
+    // Sensor accepts stop command only when bus transfer of task is finished
+    const TickType_t start = xTaskGetTickCount();
+    while (mAcquisitionTask)
+    {
+        if (xTaskGetTickCount() - start >= ACQUISITION_STOP_TIMEOUT)
+        {
+            ESP_LOGE(SCD4x_TAG, "Acquisition task did not finish its transfer in time");
+            break;
+        }
+
+        vTaskDelay(1);
+    }
+
+    StopPeriodicMeasurement();
+}
+
+/**
+ * @brief Check if continuous acquisition is running
+ */
+bool SCD4x::IsAcquisitionRunning() const
+{
+    return mAcquisitionRunning;
+}
+
+/**
+ * @brief Get the newest buffered sample
+ */
+bool SCD4x::GetLatestSample(AirSample &sample) const
+{
+    std::lock_guard<std::mutex> lock(mSamplesMutex);
+    if (mSamples.Empty())
+        return false;
+
+    sample = mSamples.Back();
+    return true;
+}
+
+/**
+ * @brief Aggregate the newest buffered samples
+ */
+bool SCD4x::GetWindow(size_t samples, AirWindow &window) const
+{
+    std::lock_guard<std::mutex> lock(mSamplesMutex);
+    if (mSamples.Empty())
+        return false;
+
+    if (!samples || samples > mSamples.Size())
+        samples = mSamples.Size();
+
+    const auto &first = mSamples.At(mSamples.Size() - samples);
+    window = {samples,
+              {0.0f, first.temperature, first.temperature},
+              {0.0f, first.humidity, first.humidity},
+              {0.0f, static_cast<float>(first.co2), static_cast<float>(first.co2)}};
+
+    // Sums are kept in double, so mean of long window does not lose precision
+    double temperature{0.0}, humidity{0.0}, co2{0.0};
+    for (size_t i = mSamples.Size() - samples; i < mSamples.Size(); ++i)
+    {
+        const auto &sample = mSamples.At(i);
+
+        temperature += sample.temperature;
+        window.temperature.min = std::min(window.temperature.min, sample.temperature);
+        window.temperature.max = std::max(window.temperature.max, sample.temperature);
+
+        humidity += sample.humidity;
+        window.humidity.min = std::min(window.humidity.min, sample.humidity);
+        window.humidity.max = std::max(window.humidity.max, sample.humidity);
+
+        co2 += sample.co2;
+        window.co2.min = std::min(window.co2.min, static_cast<float>(sample.co2));
+        window.co2.max = std::max(window.co2.max, static_cast<float>(sample.co2));
     }
 
-    CalculateAirValues(measured_values);
+    window.temperature.mean = static_cast<float>(temperature / samples);
+    window.humidity.mean = static_cast<float>(humidity / samples);
+    window.co2.mean = static_cast<float>(co2 / samples);
+
+    return true;
 }
 
 /**
@@ -144,8 +301,9 @@ void SCD4x::PerformForcedRecalibration()
     vTaskDelay(500);
 
     // Send command with parameter to force recalibration
-    std::vector<uint8_t> response;
-    if (SendCommand(PERFORM_FORCED_RECALIBRATION, {0x01, 0xe0, 0xb4}, 400, 2, response, 3) != I2C_OperationResult::I2C_OK)
+    std::array<uint8_t, SENSOR_WORD_SIZE> response;
+    const uint8_t parameters[] = {0x01, 0xe0, 0xb4};
+    if (SendCommand(PERFORM_FORCED_RECALIBRATION, parameters, 400, 2, response) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGI(SCD4x_TAG, "Forcing recalibration failed");
         return;
@@ -160,16 +318,13 @@ void SCD4x::PerformForcedRecalibration()
  */
 bool SCD4x::IsAutomaticSelfCalibrationEnabled() const
 {
-    std::vector<uint8_t> response;
-    if (SendCommand(GET_AUTOMATIC_SELF_CALIBRATION_ENABLED, 1, 2, response, 3) != I2C_OperationResult::I2C_OK)
+    std::array<uint8_t, SENSOR_WORD_SIZE> response;
+    if (SendCommand(GET_AUTOMATIC_SELF_CALIBRATION_ENABLED, 1, 2, response) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGE(SCD4x_TAG, "Failed to get sensor serial number");
         return false;
     }
 
-    if (response.empty() && response.size() == 3)
-        return false;
-
     for (const auto &byte : response)
         printf("0x%x\n", byte);
 
@@ -183,7 +338,8 @@ bool SCD4x::IsAutomaticSelfCalibrationEnabled() const
 void SCD4x::EnableAutomaticSelfCalibration() const
 {
     // Send command with parameter
-    if (SendCommand(SET_AUTOMATIC_SELF_CALIBRATION_ENABLED, {0x01, 0xB0}, 1, 2) != I2C_OperationResult::I2C_OK)
+    const uint8_t parameters[] = {0x01, 0xB0};
+    if (SendCommand(SET_AUTOMATIC_SELF_CALIBRATION_ENABLED, parameters, 1, 2) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGI(SCD4x_TAG, "Enabling self automatic calibration failed");
         return;
@@ -199,7 +355,8 @@ void SCD4x::EnableAutomaticSelfCalibration() const
 void SCD4x::DisableAutomaticSelfCalibration() const
 {
     // Send command with parameter
-    if (SendCommand(SET_AUTOMATIC_SELF_CALIBRATION_ENABLED, {0x00, 0x81}, 1, 2) != I2C_OperationResult::I2C_OK)
+    const uint8_t parameters[] = {0x00, 0x81};
+    if (SendCommand(SET_AUTOMATIC_SELF_CALIBRATION_ENABLED, parameters, 1, 2) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGI(SCD4x_TAG, "Enabling self automatic calibration failed");
         return;
@@ -214,17 +371,14 @@ void SCD4x::DisableAutomaticSelfCalibration() const
  */
 uint16_t SCD4x::GetSensorAltitude() const
 {
-    std::vector<uint8_t> response;
+    std::array<uint8_t, SENSOR_WORD_SIZE> response;
     // Send command to read measured values
-    if (SendCommand(GET_SENSOR_ALTITUDE, 1, 2, response, 3) != I2C_OperationResult::I2C_OK)
+    if (SendCommand(GET_SENSOR_ALTITUDE, 1, 2, response) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGE(SCD4x_TAG, "Failed to read sensor altitude");
         return 0;
     }
 
-    if (response.empty() || response.size() != 3)
-        return 0;
-
     uint16_t altitude = response.at(0);
     altitude <<= 8;
     altitude += response.at(1);
@@ -238,7 +392,8 @@ uint16_t SCD4x::GetSensorAltitude() const
 void SCD4x::SetSensorAltitude(const uint16_t sensorAltitude) const
 {
     // Send command with parameter
-    if (SendCommand(SET_SENSOR_ALTITUDE, {0x02, 0xAC, 0xD9}, 1, 2) != I2C_OperationResult::I2C_OK)
+    const uint8_t parameters[] = {0x02, 0xAC, 0xD9};
+    if (SendCommand(SET_SENSOR_ALTITUDE, parameters, 1, 2) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGE(SCD4x_TAG, "Setting sensor altitude failed");
         return;
@@ -253,17 +408,14 @@ void SCD4x::SetSensorAltitude(const uint16_t sensorAltitude) const
  */
 uint16_t SCD4x::GetTemperatureOffset() const
 {
-    std::vector<uint8_t> response;
+    std::array<uint8_t, SENSOR_WORD_SIZE> response;
     // Send command to read measured values
-    if (SendCommand(GET_TEMPERATURE_OFFSET, 1, 2, response, 3) != I2C_OperationResult::I2C_OK)
+    if (SendCommand(GET_TEMPERATURE_OFFSET, 1, 2, response) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGE(SCD4x_TAG, "Failed to read temperature offset");
         return 0;
     }
 
-    if (response.empty() || response.size() != 3)
-        return 0;
-
     uint16_t offset = response.at(0);
     offset <<= 8;
     offset += response.at(1);
@@ -277,7 +429,8 @@ uint16_t SCD4x::GetTemperatureOffset() const
 void SCD4x::SetTemperatureOffset(const uint16_t sensorAltitude) const
 {
     // Send command with parameter
-    if (SendCommand(SET_TEMPERATURE_OFFSET, {0x00, 0x00, 0x81}, 1, 2) != I2C_OperationResult::I2C_OK)
+    const uint8_t parameters[] = {0x00, 0x00, 0x81};
+    if (SendCommand(SET_TEMPERATURE_OFFSET, parameters, 1, 2) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGI(SCD4x_TAG, "Setting temperature offset failed");
         return;
@@ -286,32 +439,150 @@ void SCD4x::SetTemperatureOffset(const uint16_t sensorAltitude) const
     SavePersistSettings();
 }
 
+/**
+ * @brief Send command of single shot measurement
+ */
+I2C_OperationResult SCD4x::TriggerMeasurement()
+{
+    // Sensor ignores single shot command in periodic mode
+    if (IsAcquisitionRunning())
+    {
+        ESP_LOGE(SCD4x_TAG, "Single shot measurement is not available while acquisition is running");
+        return I2C_OperationResult::INVALID_ARGUMENT;
+    }
+
+    const auto i2c_result = SendCommand(MEASURE_SINGLE_SHOT, 0, 2);
+    if (i2c_result != I2C_OperationResult::I2C_OK)
+        ESP_LOGE(SCD4x_TAG, "Measurement failed");
+
+    return i2c_result;
+}
+
+/**
+ * @brief Get time of single shot conversion
+ */
+TickType_t SCD4x::ConversionTime() const
+{
+    return SINGLE_SHOT_DURATION;
+}
+
+/**
+ * @brief Read data ready status of sensor
+ */
+bool SCD4x::PollDataReady() const
+{
+    std::array<uint8_t, SENSOR_WORD_SIZE> response;
+    if (SendCommand(GET_DATA_READY_STATUS, 1, 2, response) != I2C_OperationResult::I2C_OK)
+    {
+        ESP_LOGE(SCD4x_TAG, "Failed to read data ready status");
+        return false;
+    }
+
+    return Component::Convertor::Unpack<uint16_t>(response.data()) & DATA_READY_MASK;
+}
+
+/**
+ * @brief Read measured values
+ */
+I2C_OperationResult SCD4x::FetchMeasurement()
+{
+    AirSample sample;
+    const auto i2c_result = ReadSample(sample);
+    if (i2c_result != I2C_OperationResult::I2C_OK)
+        return i2c_result;
+
+    *mCO2 = sample.co2;
+    *mTemperature = sample.temperature;
+    *mHumanity = sample.humidity;
+
+    return I2C_OperationResult::I2C_OK;
+}
+
+/**
+ * @brief Read measured values
+ */
+I2C_OperationResult SCD4x::ReadSample(AirSample &sample) const
+{
+    std::array<uint8_t, 3 * SENSOR_WORD_SIZE> measured_values;
+    // Sensor clears its buffer once it was read, corrupted values are replaced by the next measurement
+    const auto i2c_result = SendReadOnceCommand(READ_MEASUREMENT, 1, 2, measured_values);
+    if (i2c_result != I2C_OperationResult::I2C_OK)
+    {
+        ESP_LOGE(SCD4x_TAG, "Failed to read measured values");
+        return i2c_result;
+    }
+
+    CalculateAirValues(measured_values, sample);
+    sample.tick = xTaskGetTickCount();
+
+    return I2C_OperationResult::I2C_OK;
+}
+
 /**
  * @brief Calculate values
  */
-void SCD4x::CalculateAirValues(const std::vector<uint8_t> &sensorData)
+void SCD4x::CalculateAirValues(ByteView sensorData, AirSample &sample)
 {
-    if (sensorData.empty() || sensorData.size() < 9)
+    if (sensorData.size() < 3 * SENSOR_WORD_SIZE)
         return;
 
     // CO2
-    *mCO2 = (sensorData.at(0) << 8) | sensorData.at(1);
+    sample.co2 = Component::Convertor::Unpack<uint16_t>(sensorData.data());
 
     // Temperature
-    uint16_t temp = (sensorData.at(3) << 8) | sensorData.at(4);
-    *mTemperature = -45 + 175 * temp / pow(2, 16);
+    uint16_t temp = Component::Convertor::Unpack<uint16_t>(sensorData.data() + 3);
+    sample.temperature = -45 + 175 * temp / pow(2, 16);
 
     // Humanity
-    uint16_t hum = (sensorData.at(6) << 8) | sensorData.at(7);
-    *mHumanity = 100 * hum / pow(2, 16);
+    uint16_t hum = Component::Convertor::Unpack<uint16_t>(sensorData.data() + 6);
+    sample.humidity = 100 * hum / pow(2, 16);
+}
+
+/**
+ * @brief Task which drains samples of periodic measurement into buffer
+ */
+void SCD4x::AcquisitionTask(void *arg)
+{
+    auto sensor = static_cast<SCD4x *>(arg);
+
+    // The first sample is ready one interval after start
+    TickType_t wait = sensor->mSampleInterval;
+
+    while (sensor->mAcquisitionRunning)
+    {
+        // Stop request wakes task immediately
+        ulTaskNotifyTake(pdTRUE, wait);
+        if (!sensor->mAcquisitionRunning)
+            break;
+
+        wait = ACQUISITION_POLL_INTERVAL;
+        if (!sensor->PollDataReady())
+            continue;
+
+        // Failed sample is not read again, the next one is read after sensor sets data ready
+        AirSample sample;
+        if (sensor->ReadSample(sample) != I2C_OperationResult::I2C_OK)
+            continue;
+
+        {
+            std::lock_guard<std::mutex> lock(sensor->mSamplesMutex);
+            sensor->mSamples.Push(sample);
+        }
+
+        // Next sample is not due sooner than one interval minus polling margin
+        wait = sensor->mSampleInterval - ACQUISITION_POLL_INTERVAL;
+    }
+
+    sensor->mAcquisitionTask = nullptr;
+    vTaskDelete(nullptr);
 }
 
 /**
  * @brief Format serial number
  */
-std::string SCD4x::FormatSerialNumber(const std::vector<uint8_t> &sensorData) const
+std::string SCD4x::FormatSerialNumber(ByteView sensorData) const
 {
-    if (sensorData.empty() || sensorData.size() < 9)
+    if (sensorData.size() < 3 * SENSOR_WORD_SIZE)
         return std::string("\"Data corrupted\"");
 
     uint8_t crc_index{0};
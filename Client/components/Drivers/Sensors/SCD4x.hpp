@@ -4,10 +4,62 @@
 /* Interface */
 #include "Sensor.hpp"
 
+/* Common components */
+#include "Common_components/Utility/DataType/RingBuffer.hpp"
+
+/* STD library */
+#include <atomic>
+#include <mutex>
+
 #define SCD4x_TAG "SCD4x_Sensor"
 
+// Continuous acquisition
+#ifdef CONFIG_SCD4X_PERIODIC_MODE
+#define SCD4x_SAMPLE_BUFFER_SIZE CONFIG_SCD4X_SAMPLE_BUFFER_SIZE
+#define SCD4x_AVERAGE_WINDOW CONFIG_SCD4X_AVERAGE_WINDOW
+#else
+#define SCD4x_SAMPLE_BUFFER_SIZE 1
+#define SCD4x_AVERAGE_WINDOW 1
+#endif
+
+#define SCD4x_ACQUISITION_STACK_SIZE 3072
+
 namespace Sensor
 {
+    /* One sample of periodic measurement */
+    struct AirSample
+    {
+        // Tick count when sample was read
+        TickType_t tick;
+        // Temperature
+        float temperature;
+        // Humanity
+        float humidity;
+        // CO2
+        uint16_t co2;
+    };
+
+    /* Mean and range of one value over window of samples */
+    struct AirRange
+    {
+        float mean;
+        float min;
+        float max;
+    };
+
+    /* Aggregate of the newest buffered samples */
+    struct AirWindow
+    {
+        // Number of aggregated samples
+        size_t count;
+        // Temperature
+        AirRange temperature;
+        // Humanity
+        AirRange humidity;
+        // CO2
+        AirRange co2;
+    };
+
     class SCD4x : public AirSensor_I
     {
     public:
@@ -30,21 +82,21 @@ namespace Sensor
         virtual std::string SerialNumber() const override;
 
         /**
-         * @brief Get temperature
+         * @brief Get temperature. Average of the newest samples while acquisition is running
          *
          * @return float
          */
         float GetTemperature() const override;
 
         /**
-         * @brief Get humanity
+         * @brief Get humanity. Average of the newest samples while acquisition is running
          *
          * @return float
          */
         virtual float GetHumanity() const override;
 
         /**
-         * @brief Get CO2
+         * @brief Get CO2. Average of the newest samples while acquisition is running
          *
          * @return uint16_t
          */
@@ -55,18 +107,57 @@ namespace Sensor
          *
          * @param[in] enable_low_power : True   : Periodic measurement will be low power
          *                               False  : regular periodic measurement without low power
+         *
+         * @return bool                : True when sensor accepted command
          */
-        void StartPeriodicMeasurement(const bool enable_low_power = true) const;
+        bool StartPeriodicMeasurement(const bool enable_low_power = true) const;
 
         /**
          * @brief Stop periodic measurement
+         *
+         * @return bool : True when sensor accepted command
          */
-        void StopPeriodicMeasurement() const;
+        bool StopPeriodicMeasurement() const;
 
         /**
-         * @brief Trigger measurement on sensor (Single shot)
+         * @brief Start periodic measurement and background task which buffers its samples
+         *
+         * @param[in] enable_low_power : True   : Sample every 30 s
+         *                               False  : Sample every 5 s
+         *
+         * @return bool                : True when acquisition is running
+         */
+        bool StartAcquisition(const bool enable_low_power = true);
+
+        /**
+         * @brief Stop background task and periodic measurement. Waits until task finishes its bus transfer,
+         *        at most one second
+         */
+        void StopAcquisition();
+
+        /**
+         * @brief Check if continuous acquisition is running
          */
-        virtual void Measure() override;
+        virtual bool IsAcquisitionRunning() const override;
+
+        /**
+         * @brief Get the newest buffered sample. Never waits for sensor
+         *
+         * @param[out] sample  : The newest sample
+         *
+         * @return bool        : False when no sample is buffered
+         */
+        bool GetLatestSample(AirSample &sample) const;
+
+        /**
+         * @brief Aggregate the newest buffered samples. Never waits for sensor
+         *
+         * @param[in] samples  : Number of the newest samples, zero for all buffered samples
+         * @param[out] window  : Mean and range of values
+         *
+         * @return bool        : False when no sample is buffered
+         */
+        bool GetWindow(size_t samples, AirWindow &window) const;
 
         /**
          * @brief Software reset
@@ -123,16 +214,52 @@ namespace Sensor
          */
         void SetTemperatureOffset(const uint16_t sensorAltitude) const;
 
+    protected:
+        /**
+         * @brief Send command of single shot measurement
+         */
+        virtual I2C_OperationResult TriggerMeasurement() override;
+
+        /**
+         * @brief Get time of single shot conversion
+         */
+        virtual TickType_t ConversionTime() const override;
+
+        /**
+         * @brief Read data ready status of sensor
+         */
+        virtual bool PollDataReady() const override;
+
+        /**
+         * @brief Read measured values
+         */
+        virtual I2C_OperationResult FetchMeasurement() override;
+
     private:
-        /* Type alias -> 16 bit command convert to vector structure */
-        using Command = std::vector<uint8_t>;
+        /* Type alias -> Buffer of periodic samples */
+        using SampleBuffer = Utility::DataType::RingBuffer<AirSample, SCD4x_SAMPLE_BUFFER_SIZE>;
+
+        /**
+         * @brief Read measured values. Corrupted values are not read again, sensor cleared them by the read
+         *
+         * @param[out] sample   : Measured values
+         */
+        I2C_OperationResult ReadSample(AirSample &sample) const;
 
         /**
          * @brief Calculate values
          *
-         * @param[in] sensorData : The sensor data
+         * @param[in] sensorData    : The sensor data
+         * @param[out] sample       : Calculated values
+         */
+        static void CalculateAirValues(ByteView sensorData, AirSample &sample);
+
+        /**
+         * @brief Task which drains samples of periodic measurement into buffer
+         *
+         * @param[in] arg   : Pointer to SCD4x
          */
-        void CalculateAirValues(const std::vector<uint8_t> &sensorData);
+        static void AcquisitionTask(void *arg);
 
         /**
          * @brief Format serial number
@@ -141,12 +268,27 @@ namespace Sensor
          *
          * @return std::string
          */
-        std::string FormatSerialNumber(const std::vector<uint8_t> &sensorData) const;
+        std::string FormatSerialNumber(ByteView sensorData) const;
 
         /**
          * @brief Save persist setttings
          */
         void SavePersistSettings() const;
+
+        /* Buffered samples of periodic measurement */
+        SampleBuffer mSamples;
+
+        /* Mutex to protect buffered samples between acquisition task and readers */
+        mutable std::mutex mSamplesMutex;
+
+        /* Period of sensor samples in ticks */
+        TickType_t mSampleInterval;
+
+        /* Flag to keep acquisition task running */
+        std::atomic<bool> mAcquisitionRunning;
+
+        /* Handle of acquisition task, cleared by task when it exits */
+        std::atomic<TaskHandle_t> mAcquisitionTask;
     };
 } // namespace Sensor
 
@@ -4,9 +4,17 @@
 /* ESP log library */
 #include "esp_log.h"
 
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 /* STD library */
+#include <array>
 #include <cmath>
 
+/* Common components */
+#include "Common_components/Convertors/DataType/BytePacking.hpp"
+
 using namespace Sensor;
 
 /**
@@ -54,9 +62,9 @@ float SHT4x::GetHumanity() const
  */
 std::string SHT4x::SerialNumber() const
 {
-    std::vector<uint8_t> serial_number;
+    std::array<uint8_t, 2 * SENSOR_WORD_SIZE> serial_number;
 
-    if (SendCommand(READ_SERIAL, 1, 1, serial_number, 6) != I2C_OperationResult::I2C_OK)
+    if (SendCommand(READ_SERIAL, 1, 1, serial_number) != I2C_OperationResult::I2C_OK)
     {
         ESP_LOGE(SHT4x_TAG, "Failed to get sensor serial number");
         return std::string();
@@ -65,21 +73,6 @@ std::string SHT4x::SerialNumber() const
     return std::to_string(serial_number.at(0)) + " " + std::to_string(serial_number.at(1)) + " " + std::to_string(serial_number.at(3)) + " " + std::to_string(serial_number.at(4));
 }
 
-/**
- * @brief Trigger measurement on sensor (Single shot)
- */
-void SHT4x::Measure()
-{
-    std::vector<uint8_t> sensorData;
-    if (SendCommand(MEASURE_T_RH_HIGH_PRECISION, 10, 1, sensorData, 6) != I2C_OperationResult::I2C_OK)
-    {
-        ESP_LOGE(SHT4x_TAG, "Measurement failed");
-        return;
-    }
-
-    CalculateAirValues(sensorData);
-}
-
 /**
  * @brief Software reset
  */
@@ -98,17 +91,55 @@ void SHT4x::ActivateHeaterPower() const
         ESP_LOGE(SHT4x_TAG, "Activation heater power for 1s failed");
 }
 
+/**
+ * @brief Send command of measurement with highest precision
+ */
+I2C_OperationResult SHT4x::TriggerMeasurement()
+{
+    const auto i2c_result = SendCommand(MEASURE_T_RH_HIGH_PRECISION, 0, 1);
+    if (i2c_result != I2C_OperationResult::I2C_OK)
+        ESP_LOGE(SHT4x_TAG, "Measurement failed");
+
+    return i2c_result;
+}
+
+/**
+ * @brief Get time of measurement with highest precision
+ */
+TickType_t SHT4x::ConversionTime() const
+{
+    return precisionTimeouts.at(MEASURE_T_RH_HIGH_PRECISION);
+}
+
+/**
+ * @brief Read measured values
+ */
+I2C_OperationResult SHT4x::FetchMeasurement()
+{
+    // Sensor sends result without command once conversion is finished, corrupted result is measured again
+    std::array<uint8_t, 2 * SENSOR_WORD_SIZE> sensorData;
+    const auto i2c_result = ReadResponse(MEASURE_T_RH_HIGH_PRECISION, ConversionTime(), 1, sensorData);
+    if (i2c_result != I2C_OperationResult::I2C_OK)
+    {
+        ESP_LOGE(SHT4x_TAG, "Failed to read measured values");
+        return i2c_result;
+    }
+
+    CalculateAirValues(sensorData);
+    return I2C_OperationResult::I2C_OK;
+}
+
 /**
  * @brief Calculate values
  */
-void SHT4x::CalculateAirValues(const std::vector<uint8_t> sensorData)
+void SHT4x::CalculateAirValues(ByteView sensorData)
 {
-    if (sensorData.empty() || sensorData.size() < 6)
+    if (sensorData.size() < 2 * SENSOR_WORD_SIZE)
         return;
 
-    int16_t temperatureSensorData = (sensorData.at(0) << 8) | sensorData.at(1);
+    uint16_t temperatureSensorData = Component::Convertor::Unpack<uint16_t>(sensorData.data());
     *mTemperature = (-45 + 175 * (temperatureSensorData / (pow(2, 16) - 1)));
 
-    int16_t humanintySensorData = (sensorData.at(3) << 8) | sensorData.at(4);
+    uint16_t humanintySensorData = Component::Convertor::Unpack<uint16_t>(sensorData.data() + 3);
     *mHumanity = (-6 + 125 * (humanintySensorData / (pow(2, 16) - 1)));
 }
\ No newline at end of file
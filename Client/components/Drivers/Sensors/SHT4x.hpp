@@ -46,11 +46,6 @@ namespace Sensor
          */
         virtual std::string SerialNumber() const override;
 
-        /**
-         * @brief Trigger measurement on sensor (Single shot)
-         */
-        virtual void Measure() override;
-
         /**
          * @brief Software reset
          */
@@ -61,13 +56,29 @@ namespace Sensor
          */
         void ActivateHeaterPower() const;
 
+    protected:
+        /**
+         * @brief Send command of measurement with highest precision
+         */
+        virtual I2C_OperationResult TriggerMeasurement() override;
+
+        /**
+         * @brief Get time of measurement with highest precision
+         */
+        virtual TickType_t ConversionTime() const override;
+
+        /**
+         * @brief Read measured values
+         */
+        virtual I2C_OperationResult FetchMeasurement() override;
+
     private:
         /**
          * @brief Calculate values
          *
          * @param[in] sensorData : The sensor data
          */
-        void CalculateAirValues(const std::vector<uint8_t> sensorData);
+        void CalculateAirValues(ByteView sensorData);
     };
 }
 
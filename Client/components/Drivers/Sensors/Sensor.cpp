@@ -4,11 +4,16 @@
 /* C library*/
 #include <cfloat>
 
+/* STD library */
+#include <algorithm>
+#include <array>
+
 /* ESP log library */
 #include "esp_log.h"
 
 /* Common components */
-#include "Common_components/Convertors/DataType/ByteConvertor.hpp"
+#include "Common_components/Convertors/DataType/BytePacking.hpp"
+#include "Common_components/Utility/Checksum/Crc8.hpp"
 
 using namespace Sensor;
 
@@ -16,7 +21,8 @@ using namespace Sensor;
  * @brief Class constructor
  */
 Sensor_I::Sensor_I(uint8_t i2c_address, I2C *i2c)
-    : mI2C_address(i2c_address), mI2C(i2c)
+    : mI2C_address(i2c_address), mI2C(i2c), mChecksumStatistics{},
+      mMeasurementState(MeasurementState::MEASUREMENT_IDLE), mMeasurementStart(0)
 {
 }
 
@@ -52,146 +58,253 @@ I2C *Sensor_I::GetI2C_Driver() const
  */
 I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, const uint32_t timeout, const uint8_t command_length) const
 {
-    auto i2c_result = mI2C->Write(mI2C_address, command, command_length);
-    if (i2c_result != I2C_OperationResult::WRITE_DATA_SUCCESSFUL)
-    {
-        ESP_LOGE(SENSOR_TAG, "Failed to send command[0x%x]: %s", command, I2C_RESULT_TO_STRING(i2c_result));
-        return i2c_result;
-    }
-
-    vTaskDelay(timeout);
-
-    return I2C_OperationResult::I2C_OK;
+    return Transfer(command, command_length, ByteView(), timeout, ByteSpan(), 0);
 }
 
 /**
  * @brief Method to send command to sensor with parameterrs
  */
-I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, const std::vector<uint8_t> &parameters, const uint32_t timeout, const uint8_t command_length) const
+I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, ByteView parameters, const uint32_t timeout, const uint8_t command_length) const
 {
-    if (!IsCommandLengthValid(command_length))
-        return I2C_OperationResult::INVALID_ARGUMENT;
-
-    std::vector<uint8_t> data;
-    data.reserve(command_length + parameters.size());
-
-    AddCommand(command, command_length, data);
-
-    data.insert(data.end(), parameters.begin(), parameters.end());
-
-    auto i2c_result = mI2C->Write(mI2C_address, data);
-    if (i2c_result != I2C_OperationResult::WRITE_DATA_SUCCESSFUL)
-    {
-        ESP_LOGE(SENSOR_TAG, "Failed to send command[0x%x]: %s", command, I2C_RESULT_TO_STRING(i2c_result));
-        return i2c_result;
-    }
-
-    vTaskDelay(timeout);
-
-    return I2C_OperationResult::I2C_OK;
+    return Transfer(command, command_length, parameters, timeout, ByteSpan(), 0);
 }
 
 /**
  * @brief Method to send command to sensor with expecting sensor response
  */
-I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, const std::vector<uint8_t> &parameters, const uint32_t timeout,
-                                          const uint8_t command_length, std::vector<uint8_t> &sensor_response, const uint8_t expected_data_length) const
+I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, ByteView parameters, const uint32_t timeout,
+                                          const uint8_t command_length, ByteSpan sensor_response) const
 {
-    if (!IsCommandLengthValid(command_length))
-        return I2C_OperationResult::INVALID_ARGUMENT;
+    // Command with parameters changes sensor state, so it is not repeated
+    return Transfer(command, command_length, parameters, timeout, sensor_response, 0);
+}
 
-    std::vector<uint8_t> data;
-    data.reserve(command_length + parameters.size());
+/**
+ * @brief Method to send command to sensor with expecting sensor response
+ */
+I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
+                                          ByteSpan sensor_response) const
+{
+    return Transfer(command, command_length, ByteView(), timeout, sensor_response, CONFIG_SENSOR_CRC_RETRIES);
+}
 
-    AddCommand(command, command_length, data);
+/**
+ * @brief Method to send command whose response sensor clears once it was read
+ */
+I2C_OperationResult Sensor_I::SendReadOnceCommand(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
+                                                  ByteSpan sensor_response) const
+{
+    return Transfer(command, command_length, ByteView(), timeout, sensor_response, 0);
+}
 
-    data.insert(data.end(), parameters.begin(), parameters.end());
+/**
+ * @brief Method to calculate checksum CRC8
+ */
+uint8_t Sensor_I::CalculateChecksum_CRC_8(const uint8_t *data, const size_t length)
+{
+    return Utility::Checksum::SensirionCrc8::Compute(Utility::DataType::ByteView(data, length));
+}
 
-    auto i2c_result = mI2C->Write(mI2C_address, data);
-    if (i2c_result != I2C_OperationResult::WRITE_DATA_SUCCESSFUL)
+/**
+ * @brief Validate CRC of every word of response in place
+ */
+bool Sensor_I::IsResponseValid(ByteView response) const
+{
+    if (response.size() % SENSOR_WORD_SIZE)
     {
-        ESP_LOGE(SENSOR_TAG, "Failed to send command[0x%x]: %s", command, I2C_RESULT_TO_STRING(i2c_result));
-        return i2c_result;
+        ESP_LOGE(SENSOR_TAG, "Response of %d bytes is not made of whole words", static_cast<int>(response.size()));
+        return false;
     }
 
-    vTaskDelay(timeout);
+    uint32_t mismatches = 0;
+    for (size_t i = 0; i < response.size(); i += SENSOR_WORD_SIZE)
+    {
+        if (CalculateChecksum_CRC_8(&response[i], SENSOR_WORD_SIZE - 1) != response[i + SENSOR_WORD_SIZE - 1])
+            ++mismatches;
+    }
 
-    // Reservce space in data structure with expected data length
-    sensor_response.reserve(expected_data_length);
+    mChecksumStatistics.mismatches += mismatches;
+    return !mismatches;
+}
 
-    // Read sensor response
-    i2c_result = mI2C->Read(mI2C_address, sensor_response, expected_data_length);
+/**
+ * @brief Read result of measurement, which sensor sends without command
+ */
+I2C_OperationResult Sensor_I::ReadResponse(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
+                                           ByteSpan sensor_response) const
+{
+    const auto i2c_result = mI2C->Read(mI2C_address, sensor_response);
     if (i2c_result != I2C_OperationResult::READ_DATA_SUCCESSFUL)
     {
         ESP_LOGE(SENSOR_TAG, "Failed to read sensor response: %s", I2C_RESULT_TO_STRING(i2c_result));
         return i2c_result;
     }
 
-    return I2C_OperationResult::I2C_OK;
+    if (IsResponseValid(sensor_response))
+        return I2C_OperationResult::I2C_OK;
+
+    if (!CONFIG_SENSOR_CRC_RETRIES)
+    {
+        ++mChecksumStatistics.failures;
+        ESP_LOGE(SENSOR_TAG, "Sensor response is corrupted");
+        return I2C_OperationResult::CHECKSUM_ERROR;
+    }
+
+    // Measurement is started again and its result read in one transaction, which repeats the rest of retries
+    ++mChecksumStatistics.retries;
+    ESP_LOGW(SENSOR_TAG, "CRC mismatch in measured values, measuring again by command[0x%x]", command);
+    return Transfer(command, command_length, ByteView(), timeout, sensor_response, CONFIG_SENSOR_CRC_RETRIES - 1);
 }
 
 /**
- * @brief Method to send command to sensor with expecting sensor response
+ * @brief Ask sensor if result is ready
  */
-I2C_OperationResult Sensor_I::SendCommand(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
-                                          std::vector<uint8_t> &sensor_response, const uint8_t expected_data_length) const
+bool Sensor_I::PollDataReady() const
 {
-    // Write to sensor specific command and if expected_data_length is 0 -> return from method
-    auto i2c_result = SendCommand(command, timeout, command_length);
-    if (i2c_result != I2C_OperationResult::I2C_OK || !expected_data_length)
-        return i2c_result;
+    return true;
+}
 
-    // Reservce space in data structure with expected data length
-    sensor_response.reserve(expected_data_length);
+/**
+ * @brief Check if command length is valid in range <1 - 4>
+ */
+bool Sensor_I::IsCommandLengthValid(const uint8_t command_length) const
+{
+    return command_length >= 1 && command_length <= 4;
+}
 
-    // Read sensor response
-    i2c_result = mI2C->Read(mI2C_address, sensor_response, expected_data_length);
-    if (i2c_result != I2C_OperationResult::READ_DATA_SUCCESSFUL)
+/**
+ * @brief Write command with parameters, wait and read response in one bus transaction
+ */
+I2C_OperationResult Sensor_I::Transfer(const uint32_t command, const uint8_t command_length, ByteView parameters,
+                                       const uint32_t timeout, ByteSpan sensor_response, const uint8_t retries) const
+{
+    if (!IsCommandLengthValid(command_length) || parameters.size() > SENSOR_MAX_PARAMETERS_LENGTH)
+        return I2C_OperationResult::INVALID_ARGUMENT;
+
+    // Command and parameters are sent in one write, so frame is built on stack
+    std::array<uint8_t, sizeof(command) + SENSOR_MAX_PARAMETERS_LENGTH> frame;
+    Component::Convertor::Store(command, ByteSpan(frame), command_length);
+    std::copy(parameters.begin(), parameters.end(), frame.begin() + command_length);
+
+    const Component::Driver::Communication::I2C_Transaction transaction = {
+        mI2C_address,
+        ByteView(frame.data(), command_length + parameters.size()),
+        sensor_response,
+        timeout,
+    };
+
+    for (uint8_t attempt = 0;; ++attempt)
     {
-        ESP_LOGE(SENSOR_TAG, "Failed to read sensor response: %s", I2C_RESULT_TO_STRING(i2c_result));
-        return i2c_result;
+        size_t completed = 0;
+        const auto i2c_result = mI2C->Execute(Utility::DataType::Span<const Component::Driver::Communication::I2C_Transaction>(&transaction, 1), completed);
+        if (i2c_result != I2C_OperationResult::I2C_OK)
+        {
+            ESP_LOGE(SENSOR_TAG, "Failed to send command[0x%x]: %s", command, I2C_RESULT_TO_STRING(i2c_result));
+            return i2c_result;
+        }
+
+        if (sensor_response.empty() || IsResponseValid(sensor_response))
+            return I2C_OperationResult::I2C_OK;
+
+        if (attempt >= retries)
+        {
+            ++mChecksumStatistics.failures;
+            ESP_LOGE(SENSOR_TAG, "Response to command[0x%x] is corrupted after %d retries", command, attempt);
+            return I2C_OperationResult::CHECKSUM_ERROR;
+        }
+
+        ++mChecksumStatistics.retries;
+        ESP_LOGW(SENSOR_TAG, "CRC mismatch in response to command[0x%x], reading again", command);
     }
-
-    return I2C_OperationResult::I2C_OK;
 }
 
 /**
- * @brief Method to calculate checksum CRC8
+ * @brief Trigger measurement on sensor (Single shot) and block until its result is read
  */
-uint8_t Sensor_I::CalculateChecksum_CRC_8() const
+void Sensor_I::Measure()
 {
-    auto convertor = new Component::Convertor::ByteConvertor();
+    if (StartMeasurement() != I2C_OperationResult::I2C_OK)
+        return;
+
+    if (!WaitForData())
+        ESP_LOGW(SENSOR_TAG, "Data ready status was not set in time");
 
-    auto bytes = convertor->ConvertTo<uint8_t>(0xBEEF, 1);
+    ReadMeasurement();
+}
 
-    for (const auto &byte : bytes)
+/**
+ * @brief Start measurement and return while sensor converts
+ */
+I2C_OperationResult Sensor_I::StartMeasurement()
+{
+    if (mMeasurementState != MeasurementState::MEASUREMENT_IDLE)
     {
-        printf("Value: %ld\n", static_cast<long>(byte));
+        ESP_LOGE(SENSOR_TAG, "Previous measurement was not read yet");
+        return I2C_OperationResult::INVALID_ARGUMENT;
     }
 
-    return 0;
+    const auto i2c_result = TriggerMeasurement();
+    if (i2c_result != I2C_OperationResult::I2C_OK)
+        return i2c_result;
+
+    mMeasurementStart = xTaskGetTickCount();
+    mMeasurementState = MeasurementState::MEASUREMENT_CONVERTING;
+
+    return I2C_OperationResult::I2C_OK;
 }
 
 /**
- * @brief Check if command length is valid in range <1 - 4>
+ * @brief Check if result of started measurement can be read
  */
-bool Sensor_I::IsCommandLengthValid(const uint8_t command_length) const
+bool Sensor_I::IsDataReady() const
 {
-    return command_length >= 1 && command_length <= 4;
+    if (mMeasurementState != MeasurementState::MEASUREMENT_CONVERTING)
+        return false;
+
+    // Bus is not used until sensor can have result
+    if (xTaskGetTickCount() - mMeasurementStart < ConversionTime())
+        return false;
+
+    return PollDataReady();
 }
 
 /**
- * @brief Add command to data structure
+ * @brief Wait until result of started measurement is ready
  */
-void Sensor_I::AddCommand(uint32_t command, const uint8_t commandLength, std::vector<uint8_t> &data) const
+bool Sensor_I::WaitForData(const TickType_t timeout) const
 {
-    command <<= (4 - commandLength) * 8;
+    if (mMeasurementState != MeasurementState::MEASUREMENT_CONVERTING)
+        return false;
 
-    for (uint8_t i = 0; i < commandLength; ++i)
+    const TickType_t elapsed = xTaskGetTickCount() - mMeasurementStart;
+    if (elapsed < ConversionTime())
+        vTaskDelay(ConversionTime() - elapsed);
+
+    const TickType_t deadline = xTaskGetTickCount() + timeout;
+    while (!IsDataReady())
+    {
+        if (static_cast<int32_t>(deadline - xTaskGetTickCount()) <= 0)
+            return false;
+
+        vTaskDelay(SENSOR_POLL_INTERVAL);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Read result of started measurement
+ */
+I2C_OperationResult Sensor_I::ReadMeasurement()
+{
+    if (mMeasurementState != MeasurementState::MEASUREMENT_CONVERTING)
     {
-        data.emplace_back((command & 0xFF000000) >> 24);
-        command <<= 8;
+        ESP_LOGE(SENSOR_TAG, "No measurement was started");
+        return I2C_OperationResult::INVALID_ARGUMENT;
     }
+
+    mMeasurementState = MeasurementState::MEASUREMENT_IDLE;
+    return FetchMeasurement();
 }
 
 /**
@@ -6,18 +6,62 @@
 #include <string>
 
 /* Common components */
-#include <Common_components/Drivers/Communication/I2C.hpp>
+#include <Common_components/Drivers/Communication/I2C_BusInterface.hpp>
+#include <Common_components/Utility/DataType/Span.hpp>
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/* SDK config */
+#include "sdkconfig.h"
 
 #define SENSOR_TAG "Sensor"
 
+// Size of response word followed by its CRC
+#define SENSOR_WORD_SIZE 3
+
+// Maximum length of command parameters, three words with their CRC
+#define SENSOR_MAX_PARAMETERS_LENGTH 9
+
+// Ticks between polls of data ready status
+#define SENSOR_POLL_INTERVAL 50
+
+// Ticks to wait for data ready status after conversion time elapsed
+#define SENSOR_READY_TIMEOUT 1000
+
 namespace Sensor
 {
-    /* Type alias -> I2C communication driver */
-    using I2C = Component::Driver::Communication::I2C;
+    /* Type alias -> I2C bus */
+    using I2C = Component::Driver::Communication::I2C_BusInterface;
+
+    /* Type alias -> Read only bytes */
+    using ByteView = Utility::DataType::ByteView;
+
+    /* Type alias -> Writable bytes */
+    using ByteSpan = Utility::DataType::Span<uint8_t>;
 
     //  Type alias -> The methods results of I2C interface class
     using I2C_OperationResult = Component::Driver::Communication::I2C_Result;
 
+    /* Counters of response checksum validation */
+    struct ChecksumStatistics
+    {
+        // Response words with wrong CRC
+        uint32_t mismatches;
+        // Reads repeated due to wrong CRC
+        uint32_t retries;
+        // Reads which failed after all retries
+        uint32_t failures;
+    };
+
+    /* State of non-blocking measurement */
+    enum class MeasurementState
+    {
+        MEASUREMENT_IDLE,
+        MEASUREMENT_CONVERTING,
+    };
+
     class Sensor_I
     {
     protected:
@@ -41,7 +85,7 @@ namespace Sensor
         /**
          * @brief Get I2C driver
          *
-         * @return Pointer to I2C driver
+         * @return Pointer to I2C bus
          */
         I2C *GetI2C_Driver() const;
 
@@ -62,7 +106,7 @@ namespace Sensor
          * @param[in] timeout           : Timeout to complete sensor commmand
          * @param[in] command_length    : Command length in bytes (Default is 1 byte)
          */
-        virtual I2C_OperationResult SendCommand(const uint32_t command, const std::vector<uint8_t> &parameters,
+        virtual I2C_OperationResult SendCommand(const uint32_t command, ByteView parameters,
                                                 const uint32_t timeout, const uint8_t command_length = 1) const;
 
         /**
@@ -72,30 +116,101 @@ namespace Sensor
          * @param[in] parameters            : Additional command parameters
          * @param[in]  timeout              : Timeout to complete sensor command and start to read sensor response
          * @param[in]  command_length       : Command length in bytes
-         * @param[out] sensor_response      : Sensor response data
-         * @param[in]  expected_data_length : Expected length of sensor data response
+         * @param[out] sensor_response      : Buffer filled by sensor response, its size is expected length of response
          */
-        virtual I2C_OperationResult SendCommand(const uint32_t command, const std::vector<uint8_t> &parameters, const uint32_t timeout,
-                                                const uint8_t command_length, std::vector<uint8_t> &sensor_response, const uint8_t expected_data_length) const;
+        virtual I2C_OperationResult SendCommand(const uint32_t command, ByteView parameters, const uint32_t timeout,
+                                                const uint8_t command_length, ByteSpan sensor_response) const;
 
         /**
-         * @brief Method to send command to sensor with expecting sensor response
+         * @brief Method to send command to sensor with expecting sensor response.
+         *        Response with wrong CRC is read again up to CONFIG_SENSOR_CRC_RETRIES times
          *
          * @param[in]  command              : Sensor command
          * @param[in]  timeout              : Timeout to complete sensor command and start to read sensor response
          * @param[in]  command_length       : Command length in bytes
-         * @param[out] sensor_response      : Sensor response data
-         * @param[in]  expected_data_length : Expected length of sensor data response
+         * @param[out] sensor_response      : Buffer filled by sensor response, its size is expected length of response
+         *
+         * @return I2C_OperationResult      : CHECKSUM_ERROR when response is corrupted after all retries
          */
         virtual I2C_OperationResult SendCommand(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
-                                                std::vector<uint8_t> &sensor_response, const uint8_t expected_data_length) const;
+                                                ByteSpan sensor_response) const;
+
+        /**
+         * @brief Method to send command whose response sensor clears once it was read, like measured values.
+         *        Repeated command would not return the same response, so corrupted response is not read again
+         *
+         * @param[in]  command              : Sensor command
+         * @param[in]  timeout              : Timeout to complete sensor command and start to read sensor response
+         * @param[in]  command_length       : Command length in bytes
+         * @param[out] sensor_response      : Buffer filled by sensor response, its size is expected length of response
+         *
+         * @return I2C_OperationResult      : CHECKSUM_ERROR when response is corrupted
+         */
+        I2C_OperationResult SendReadOnceCommand(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
+                                                ByteSpan sensor_response) const;
 
         /**
          * @brief Method to calculate checksum CRC8
          *
+         * @param[in] data      : Data
+         * @param[in] length    : Length of data
+         *
          * @return uint8_t
          */
-        virtual uint8_t CalculateChecksum_CRC_8() const;
+        static uint8_t CalculateChecksum_CRC_8(const uint8_t *data, const size_t length);
+
+        /**
+         * @brief Validate CRC of every word of response in place
+         *
+         * @param[in] response  : Sensor response of words followed by their CRC
+         *
+         * @return bool         : True  - all words are valid
+         *                        False - response is corrupted
+         */
+        bool IsResponseValid(ByteView response) const;
+
+        /**
+         * @brief Read result of measurement, which sensor sends without command. Sensor sends result only once,
+         *        so corrupted result is measured again by the command up to CONFIG_SENSOR_CRC_RETRIES times
+         *
+         * @param[in]  command          : Command which started measurement
+         * @param[in]  timeout          : Ticks of conversion of measurement
+         * @param[in]  command_length   : Command length in bytes
+         * @param[out] sensor_response  : Buffer filled by sensor response, its size is expected length of response
+         *
+         * @return I2C_OperationResult  : CHECKSUM_ERROR when result is corrupted after all retries
+         */
+        I2C_OperationResult ReadResponse(const uint32_t command, const uint32_t timeout, const uint8_t command_length,
+                                         ByteSpan sensor_response) const;
+
+        /**
+         * @brief Send command which starts measurement. Must not wait for conversion
+         *
+         * @return I2C_OperationResult  : I2C_OK when sensor accepted command
+         */
+        virtual I2C_OperationResult TriggerMeasurement() = 0;
+
+        /**
+         * @brief Get time of conversion of started measurement
+         *
+         * @return TickType_t   : Ticks until result can be read at the earliest
+         */
+        virtual TickType_t ConversionTime() const = 0;
+
+        /**
+         * @brief Ask sensor if result is ready, called only after conversion time elapsed.
+         *        Sensors without data ready status are ready as soon as conversion time elapses
+         *
+         * @return bool : True when result can be read
+         */
+        virtual bool PollDataReady() const;
+
+        /**
+         * @brief Read result of finished measurement and calculate values
+         *
+         * @return I2C_OperationResult  : I2C_OK when values were updated
+         */
+        virtual I2C_OperationResult FetchMeasurement() = 0;
 
     public:
         /**
@@ -107,15 +222,64 @@ namespace Sensor
         virtual std::string SerialNumber() const = 0;
 
         /**
-         * @brief Trigger measurement on sensor (Single shot)
+         * @brief Trigger measurement on sensor (Single shot) and block until its result is read
+         */
+        virtual void Measure();
+
+        /**
+         * @brief Start measurement and return while sensor converts
+         *
+         * @return I2C_OperationResult  : I2C_OK when measurement was started
+         *                                INVALID_ARGUMENT when previous measurement was not read yet
+         */
+        I2C_OperationResult StartMeasurement();
+
+        /**
+         * @brief Check if result of started measurement can be read. Never blocks
+         *
+         * @return bool : True when result is ready
+         */
+        bool IsDataReady() const;
+
+        /**
+         * @brief Wait until result of started measurement is ready
+         *
+         * @param[in] timeout   : Ticks to wait after conversion time elapsed
+         *
+         * @return bool         : True when result is ready
+         */
+        bool WaitForData(const TickType_t timeout = SENSOR_READY_TIMEOUT) const;
+
+        /**
+         * @brief Read result of started measurement. Measurement is finished even when reading failed
+         *
+         * @return I2C_OperationResult  : I2C_OK when values were updated
+         *                                INVALID_ARGUMENT when no measurement was started
+         */
+        I2C_OperationResult ReadMeasurement();
+
+        /**
+         * @brief Get state of non-blocking measurement
          */
-        virtual void Measure() = 0;
+        MeasurementState GetMeasurementState() const { return mMeasurementState; }
+
+        /**
+         * @brief Check if sensor measures continuously in background. Values are then available without measurement
+         *
+         * @return bool : True when continuous acquisition is running
+         */
+        virtual bool IsAcquisitionRunning() const { return false; }
 
         /**
          * @brief Software reset
          */
         virtual void SoftReset() const = 0;
 
+        /**
+         * @brief Get counters of response checksum validation
+         */
+        ChecksumStatistics GetChecksumStatistics() const { return mChecksumStatistics; }
+
     private:
         /**
          * @brief Check if command length is valid in range <1 - 4>
@@ -128,19 +292,32 @@ namespace Sensor
         bool IsCommandLengthValid(const uint8_t command_length) const;
 
         /**
-         * @brief Add command to data structure
+         * @brief Write command with parameters, wait and read response in one bus transaction
          *
-         * @param[in] command       : Command
-         * @param[in] commandLength : Command length
-         * @param[in/out] data      : Data structure
+         * @param[in]  command          : Sensor command
+         * @param[in]  command_length   : Command length in bytes
+         * @param[in]  parameters       : Additional command parameters
+         * @param[in]  timeout          : Ticks to complete sensor command. Zero reads response with repeated start
+         * @param[out] sensor_response  : Buffer filled by sensor response, may be empty
+         * @param[in]  retries          : Number of repeated transactions when response is corrupted
          */
-        void AddCommand(uint32_t command, const uint8_t commandLength, std::vector<uint8_t> &data) const;
+        I2C_OperationResult Transfer(const uint32_t command, const uint8_t command_length, ByteView parameters,
+                                     const uint32_t timeout, ByteSpan sensor_response, const uint8_t retries) const;
 
         /* I2C slave address */
         uint8_t mI2C_address;
 
-        /* I2C driver */
+        /* I2C bus */
         I2C *mI2C;
+
+        /* Counters of checksum validation, updated by const read methods */
+        mutable ChecksumStatistics mChecksumStatistics;
+
+        /* State of non-blocking measurement */
+        MeasurementState mMeasurementState;
+
+        /* Tick count when measurement was started */
+        TickType_t mMeasurementStart;
     };
 
     class AirSensor_I : public Sensor_I
@@ -12,7 +12,11 @@
 /* C library */
 #include <cstring>
 
+/* ESP timer library */
+#include "esp_timer.h"
+
 /* STD library */
+#include <algorithm>
 #include <limits>
 
 // Timer divider
@@ -25,6 +29,28 @@
 #define SEC 1000
 #define MIN 60 * SEC
 
+// Delta encoding, deadbands are configured in hundredths of unit
+#ifdef CONFIG_DELTA_ENCODING
+#define DELTA_KEYFRAME_INTERVAL CONFIG_DELTA_KEYFRAME_INTERVAL
+#define DELTA_DEADBAND_TEMPERATURE (CONFIG_DELTA_DEADBAND_TEMPERATURE / 100.0f)
+#define DELTA_DEADBAND_HUMIDITY (CONFIG_DELTA_DEADBAND_HUMIDITY / 100.0f)
+#define DELTA_DEADBAND_CO2 static_cast<float>(CONFIG_DELTA_DEADBAND_CO2)
+#define DELTA_DEADBAND_SOIL_MOISTURE (CONFIG_DELTA_DEADBAND_SOIL_MOISTURE / 100.0f)
+#else
+#define DELTA_KEYFRAME_INTERVAL 0
+#define DELTA_DEADBAND_TEMPERATURE 0.0f
+#define DELTA_DEADBAND_HUMIDITY 0.0f
+#define DELTA_DEADBAND_CO2 0.0f
+#define DELTA_DEADBAND_SOIL_MOISTURE 0.0f
+#endif
+
+// Continuous acquisition of SCD4x
+#ifdef CONFIG_SCD4X_LOW_POWER
+#define SCD4x_LOW_POWER true
+#else
+#define SCD4x_LOW_POWER false
+#endif
+
 using namespace Greenhouse;
 
 GreenhouseManager *GreenhouseManager::mManagerInstance{nullptr};
@@ -41,7 +67,16 @@ GreenhouseManager::GreenhouseManager()
 		: mBluetoothController(new Bluetooth::ClientBluetoothControlller()),
 			mBluetoothHandler(new Bluetooth::ClientBluetoothHandler(mBluetoothController)),
 			mConnectionHolder(new Bluetooth::ConnectionHolder(mBluetoothController, mBluetoothHandler->GetReferenceToConnectionState(), 10 * MIN)),
-			mI2C(new I2C(GPIO_NUM_21, GPIO_NUM_22))
+			mI2C(new I2C(GPIO_NUM_21, GPIO_NUM_22)),
+			mI2C_Arbiter(new I2C_Arbiter(mI2C)),
+			mSentSamples(0),
+			mDeltaEncoder({.age = 0,
+										 .content = ClientSchema::MASK,
+										 .temperature = DELTA_DEADBAND_TEMPERATURE,
+										 .humidity = DELTA_DEADBAND_HUMIDITY,
+										 .co2 = DELTA_DEADBAND_CO2,
+										 .soilMoisture = DELTA_DEADBAND_SOIL_MOISTURE},
+										DELTA_KEYFRAME_INTERVAL)
 {
 	mBluetoothConnectionTracker = new Component::Tracker::BluetoothConnectionTracker(mBluetoothHandler->GetReferenceToConnectionState());
 
@@ -50,10 +85,19 @@ GreenhouseManager::GreenhouseManager()
 
 	if (mI2C->Activate() != ESP_OK)
 		ESP_LOGE(GREENHOUSE_MANAGER_TAG, "Activation of I2C failed");
+
+	// Sensors share bus only through arbiter, so they can be used from different tasks
+	if (!mI2C_Arbiter->Start())
+		ESP_LOGE(GREENHOUSE_MANAGER_TAG, "Start of I2C arbiter failed");
 #endif
 
 #ifdef CONFIG_CO2
-	mAirSensor = new Sensor::SCD4x(0x62, mI2C);
+	mAirSensor = new Sensor::SCD4x(0x62, new Component::Driver::Communication::I2C_ArbiterClient(mI2C_Arbiter));
+
+#ifdef CONFIG_SCD4X_PERIODIC_MODE
+	if (!static_cast<Sensor::SCD4x *>(mAirSensor)->StartAcquisition(SCD4x_LOW_POWER))
+		ESP_LOGE(GREENHOUSE_MANAGER_TAG, "Continuous acquisition of air values failed to start");
+#endif
 
 	/*auto scd = dynamic_cast<Sensor::SCD4x *>(mAirSensor);
 
@@ -66,13 +110,15 @@ GreenhouseManager::GreenhouseManager()
 	printf("Temperature: %.2f\n", mAirSensor->GetTemperature());*/
 
 #elif CONFIG_TEMPERATURE || CONFIG_HUMANITY
-	mAirSensor = new Sensor::SHT4x(0x44, mI2C);
+	mAirSensor = new Sensor::SHT4x(0x44, new Component::Driver::Communication::I2C_ArbiterClient(mI2C_Arbiter));
 #else
 	ESP_LOGW(GREENHOUSE_MANAGER_TAG, "None of air values has been chosen");
 #endif
 
 #ifdef CONFIG_SOIL_MOISURE
 	mSoilMoistureSensor = new Component::Driver::Sensor::SoilMoistureSensor(adc2_channel_t::ADC2_CHANNEL_3, ADC_WIDTH_12Bit, ADC_ATTEN_11db);
+	if (!mSoilMoistureSensor->LoadCalibration())
+		ESP_LOGW(GREENHOUSE_MANAGER_TAG, "Soil moisure sensor uses default calibration");
 #endif
 }
 
@@ -84,73 +130,56 @@ GreenhouseManager::~GreenhouseManager()
 }
 
 /**
- * @brief Method to prepare data for sending to BLE server
+ * @brief Method to encode the oldest queued samples into sensor frame
  */
-void GreenhouseManager::PrepareData(BluetoothDataVector &data)
+size_t GreenhouseManager::PrepareData(Utility::DataType::Span<uint8_t> buffer, uint8_t &samples)
 {
-	// Client ID and position
-	data.emplace_back((CONFIG_CLIENT_ID << 2) | GetPosition());
-	// Data content fill up during incialization data strucutre with sensors values
-	data.emplace_back(0x00);
+	samples = 0;
 
-	if (mAirSensor != nullptr)
+	const Component::Protocol::FrameHeader header{SENSOR_FRAME_VERSION, CONFIG_CLIENT_ID, GetPosition()};
+	SensorFrame::Encoder encoder(header, buffer);
+
+	// Samples stay queued until result of previous frame arrives
+	if (!mDeltaEncoder.BeginFrame())
 	{
-		// Perform measurement
-		mAirSensor->Measure();
+		ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Previous sensor frame waits for result");
+		return 0;
 	}
 
-	// Temperature
-#ifdef CONFIG_TEMPERATURE
-	auto temperature = mAirSensor->GetTemperature();
-	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Temperature is %.2f °C", temperature);
-	data.emplace_back(GetExponent<uint8_t>(temperature));
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Temperature exponent: %d", data.back());
-	data.emplace_back(GetMantisa<uint8_t>(temperature, 2));
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Temperature mantisa: %d", data.back());
-
-	data.at(1) |= 0x80;
-#endif
-	// Humanity
-#ifdef CONFIG_HUMANITY
-	auto humanity = mAirSensor->GetHumanity();
-	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Humanity is %.2f %%", humanity);
-	data.emplace_back(GetExponent<uint8_t>(humanity));
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Humanity exponent: %d", data.back());
-	data.emplace_back(GetMantisa<uint8_t>(humanity, 2));
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Humanity mantisa: %d", data.back());
-
-	data.at(1) |= 0x40;
-#endif
-// CO2
-#ifdef CONFIG_CO2
-	auto co2 = mAirSensor->GetCO2();
-	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "CO2 is %d ppm\n", co2);
-	data.emplace_back((co2 >> 8) & 0xFF); // H
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "CO2 H register: %d", data.back());
-	data.emplace_back(co2 & 0xFF); // L
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "CO2 L register: %d", data.back());
-
-	data.at(1) |= 0x20;
-#endif
-// Soil moisture
-#ifdef CONFIG_SOIL_MOISURE
-	auto soilMoisure = mSoilMoistureSensor->Measure();
-	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Soil moisure is %.2f %%", soilMoisure);
-	data.emplace_back(GetExponent<uint8_t>(soilMoisure));
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Soil exponent: %d", data.back());
-	data.emplace_back(GetMantisa<uint8_t>(soilMoisure, 2));
-	ESP_LOGD(GREENHOUSE_MANAGER_TAG, "Soil mantisa: %d", data.back());
-
-	data.at(1) |= 0x10;
-#endif
-}
+	const int64_t now = esp_timer_get_time() / 1000000;
 
-/**
- * @brief Method to fill space inside bluetooth vector when some values is not defined from sensor
- */
-void GreenhouseManager::FillSpace(BluetoothDataVector &data, const uint8_t spaces)
-{
-	data.insert(data.end(), spaces, std::numeric_limits<BluetoothDataVector::value_type>::max());
+	for (size_t i = 0; i < mPendingSamples.Size(); ++i)
+	{
+		const auto &pending = mPendingSamples.At(i);
+
+		auto sample = pending.sample;
+		const auto age = now - pending.timestamp;
+		sample.age = age > std::numeric_limits<uint16_t>::max() ? std::numeric_limits<uint16_t>::max() : static_cast<uint16_t>(age);
+
+		// Only fields which moved beyond deadband are sent
+		const auto prepared = mDeltaEncoder.Prepare(sample);
+
+		const auto result = encoder.Append(prepared);
+		if (result == Component::Protocol::FrameResult::BUFFER_TOO_SMALL)
+			break;
+
+		if (result != Component::Protocol::FrameResult::FRAME_OK)
+		{
+			ESP_LOGE(GREENHOUSE_MANAGER_TAG, "Encoding of sensor frame failed: %s", FRAME_RESULT_TO_STRING(result));
+			return 0;
+		}
+
+		mDeltaEncoder.Accept(prepared);
+	}
+
+	if (!encoder.Count())
+		return 0;
+
+	samples = encoder.Count();
+	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Encoded %d samples into %d bytes", samples, static_cast<int>(encoder.Size()));
+	ESP_LOG_BUFFER_HEX_LEVEL(GREENHOUSE_MANAGER_TAG, buffer.data(), encoder.Size(), ESP_LOG_DEBUG);
+
+	return encoder.Size();
 }
 
 /**
@@ -228,7 +257,86 @@ GreenhouseManager::Shared_Bluetooth_Handler GreenhouseManager::GetHandler(void)
 }
 
 /**
- * @brief Method to trigger action for sending measurement data to BLE server
+ * @brief Start measurement of all enabled sensors
+ */
+void GreenhouseManager::StartMeasurement()
+{
+	mMeasurement = PendingSample{};
+	mMeasurement.timestamp = esp_timer_get_time() / 1000000;
+
+	// Sensor in continuous acquisition already has buffered samples
+	if (mAirSensor != nullptr && !mAirSensor->IsAcquisitionRunning())
+	{
+		if (mAirSensor->StartMeasurement() != Sensor::I2C_OperationResult::I2C_OK)
+			ESP_LOGE(GREENHOUSE_MANAGER_TAG, "Measurement of air values was not started");
+	}
+
+	// Soil moisture is measured while air sensor converts
+#ifdef CONFIG_SOIL_MOISURE
+	mMeasurement.sample.soilMoisture = mSoilMoistureSensor->Measure();
+	mMeasurement.sample.content |= CLIENT_SOIL_MOISTURE_CONTENT;
+	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Soil moisure is %.2f %%", mMeasurement.sample.soilMoisture);
+#endif
+}
+
+/**
+ * @brief Wait for result of started measurement and queue it for sending to BLE server
+ */
+void GreenhouseManager::CollectMeasurement()
+{
+	auto &sample = mMeasurement.sample;
+
+	if (mAirSensor != nullptr && mAirSensor->GetMeasurementState() == Sensor::MeasurementState::MEASUREMENT_CONVERTING)
+	{
+		if (!mAirSensor->WaitForData())
+			ESP_LOGW(GREENHOUSE_MANAGER_TAG, "Air sensor did not report ready data in time");
+
+		if (mAirSensor->ReadMeasurement() != Sensor::I2C_OperationResult::I2C_OK)
+			ESP_LOGE(GREENHOUSE_MANAGER_TAG, "Reading of air values failed");
+	}
+
+	// Temperature
+#ifdef CONFIG_TEMPERATURE
+	sample.temperature = mAirSensor->GetTemperature();
+	sample.content |= CLIENT_TEMPERATURE_CONTENT;
+	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Temperature is %.2f °C", sample.temperature);
+#endif
+	// Humanity
+#ifdef CONFIG_HUMANITY
+	sample.humidity = mAirSensor->GetHumanity();
+	sample.content |= CLIENT_HUMIDITY_CONTENT;
+	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "Humanity is %.2f %%", sample.humidity);
+#endif
+// CO2
+#ifdef CONFIG_CO2
+	sample.co2 = mAirSensor->GetCO2();
+	sample.content |= CLIENT_CO2_CONTENT;
+	ESP_LOGI(GREENHOUSE_MANAGER_TAG, "CO2 is %.0f ppm", sample.co2);
+#endif
+
+	std::lock_guard<std::mutex> lock(mUploadMutex);
+
+	if (mPendingSamples.Push(mMeasurement))
+	{
+		// Dropped sample may belong to frame waiting for its result
+		if (mSentSamples)
+			--mSentSamples;
+
+		ESP_LOGW(GREENHOUSE_MANAGER_TAG, "Sample queue is full. The oldest sample was dropped");
+	}
+}
+
+/**
+ * @brief Check if enough samples is queued for upload
+ */
+bool GreenhouseManager::IsUploadReady()
+{
+	std::lock_guard<std::mutex> lock(mUploadMutex);
+	return mPendingSamples.Size() >= CONFIG_SAMPLES_PER_UPLOAD;
+}
+
+/**
+ * @brief Method to trigger action for sending queued measurement data to BLE server
  */
 void GreenhouseManager::SendDataToServer()
 {
@@ -240,9 +348,56 @@ void GreenhouseManager::SendDataToServer()
 
 	auto profile = mBluetoothHandler->GetGattcProfile(GREENHOUSE_PROFILE);
 
-	BluetoothDataVector data;
-	PrepareData(data);
+	// Whole frame has to fit into one ATT write request
+	const size_t payload = std::min<size_t>(mBluetoothHandler->GetMTU() - ATT_WRITE_HEADER_SIZE, mFrameBuffer.size());
+
+	// Result of write may arrive on bluetooth task before this method returns
+	std::lock_guard<std::mutex> lock(mUploadMutex);
+
+	if (mPendingSamples.Empty())
+		return;
+
+	uint8_t samples{0};
+	const auto length = PrepareData(Utility::DataType::Span<uint8_t>(mFrameBuffer).First(payload), samples);
+	if (!length)
+		return;
+
+	if (mBluetoothController->WriteCharacteristic(profile.gattc_if, profile.conn_id, profile.char_handle, mFrameBuffer.data(), length,
+																								ESP_GATT_WRITE_TYPE_RSP, ESP_GATT_AUTH_REQ_NONE) == ESP_OK)
+	{
+		// Samples stay queued until server accepts frame
+		mSentSamples = samples;
+		mDeltaEncoder.FrameSent();
+	}
+}
+
+/**
+ * @brief Handle result of sensor frame write
+ */
+void GreenhouseManager::HandleFrameWriteResult(bool acknowledged)
+{
+	std::lock_guard<std::mutex> lock(mUploadMutex);
+
+	if (!mDeltaEncoder.IsAwaitingAck())
+		return;
+
+	// Rejected samples are sent again with next upload, encoder starts it with keyframe
+	if (acknowledged)
+		mPendingSamples.PopFront(mSentSamples);
+	else
+		ESP_LOGW(GREENHOUSE_MANAGER_TAG, "Sensor frame rejected. %d samples will be sent again", mSentSamples);
 
-	mBluetoothController->WriteCharacteristic(profile.gattc_if, profile.conn_id, profile.char_handle, data,
-																						ESP_GATT_WRITE_TYPE_RSP, ESP_GATT_AUTH_REQ_NONE);
-}
\ No newline at end of file
+	mSentSamples = 0;
+	mDeltaEncoder.Acknowledge(acknowledged);
+}
+
+/**
+ * @brief Handle disconnection from BLE server
+ */
+void GreenhouseManager::HandleServerDisconnection()
+{
+	// Server may lose state of client while disconnected, next frame starts with keyframe
+	std::lock_guard<std::mutex> lock(mUploadMutex);
+	mSentSamples = 0;
+	mDeltaEncoder.Reset();
+}
@@ -9,16 +9,47 @@
 
 /* Common components */
 #include "Common_components/Drivers/Communication/I2C.hpp"
+#include "Common_components/Drivers/Communication/I2C_Arbiter.hpp"
 #include "Common_components/Drivers/Sensor/SoilMoistureSensor.hpp"
+#include "Common_components/Protocol/SensorDelta.hpp"
+#include "Common_components/Protocol/SensorFrame.hpp"
 #include "Common_components/Trackers/BluetoothConnectionTracker.hpp"
+#include "Common_components/Utility/DataType/RingBuffer.hpp"
 
 /* STD library */
+#include <array>
 #include <memory>
 #include <mutex>
-#include <math.h>
 
 #define GREENHOUSE_MANAGER_TAG "Greenhouse Manager"
 
+// Content bits of measured values, assigned by sensor registry
+#ifdef CONFIG_TEMPERATURE
+#define CLIENT_TEMPERATURE_CONTENT Component::Protocol::ContentBit<Component::Protocol::TemperatureField>()
+#else
+#define CLIENT_TEMPERATURE_CONTENT 0x00
+#endif
+
+#ifdef CONFIG_HUMANITY
+#define CLIENT_HUMIDITY_CONTENT Component::Protocol::ContentBit<Component::Protocol::HumidityField>()
+#else
+#define CLIENT_HUMIDITY_CONTENT 0x00
+#endif
+
+#ifdef CONFIG_CO2
+#define CLIENT_CO2_CONTENT Component::Protocol::ContentBit<Component::Protocol::CO2Field>()
+#else
+#define CLIENT_CO2_CONTENT 0x00
+#endif
+
+#ifdef CONFIG_SOIL_MOISURE
+#define CLIENT_SOIL_MOISTURE_CONTENT Component::Protocol::ContentBit<Component::Protocol::SoilMoistureField>()
+#else
+#define CLIENT_SOIL_MOISTURE_CONTENT 0x00
+#endif
+
+#define CLIENT_CONTENT (CLIENT_TEMPERATURE_CONTENT | CLIENT_HUMIDITY_CONTENT | CLIENT_CO2_CONTENT | CLIENT_SOIL_MOISTURE_CONTENT)
+
 namespace Greenhouse
 {
     class GreenhouseManager
@@ -53,10 +84,42 @@ namespace Greenhouse
         Shared_Bluetooth_Handler GetHandler(void) const;
 
         /**
-         * @brief Method to trigger action for sending measurement data to BLE server
+         * @brief Start measurement of all enabled sensors. Returns while air sensor converts,
+         *        so caller can do other work before CollectMeasurement
+         */
+        void StartMeasurement();
+
+        /**
+         * @brief Wait for result of started measurement and queue it for sending to BLE server
+         */
+        void CollectMeasurement();
+
+        /**
+         * @brief Check if enough samples is queued for upload
+         *
+         * @return bool     true    : Number of queued samples reached CONFIG_SAMPLES_PER_UPLOAD
+         *                  false   : Otherwise
+         */
+        bool IsUploadReady();
+
+        /**
+         * @brief Method to trigger action for sending queued measurement data to BLE server
          */
         void SendDataToServer();
 
+        /**
+         * @brief Handle result of sensor frame write. Called from bluetooth handler
+         *
+         * @param[in] acknowledged  : True  - server accepted frame
+         *                            False - write failed
+         */
+        void HandleFrameWriteResult(bool acknowledged);
+
+        /**
+         * @brief Handle disconnection from BLE server. Called from bluetooth handler
+         */
+        void HandleServerDisconnection();
+
     private:
         /* Unique pointer to bluetooth controller */
         using Shared_Bluetooth_Controller = std::shared_ptr<Bluetooth::ClientBluetoothControlller>;
@@ -64,8 +127,14 @@ namespace Greenhouse
         /* Alias for component driver I2C */
         using I2C = Component::Driver::Communication::I2C;
 
-        /* Alias for bluetooth data vector */
-        using BluetoothDataVector = std::vector<uint8_t>;
+        /* Alias for arbiter of I2C bus */
+        using I2C_Arbiter = Component::Driver::Communication::I2C_Arbiter;
+
+        /* Schema of values measured by client. Fields keep bits of registry, other fields generate no code */
+        using ClientSchema = Component::Protocol::GreenhouseRegistry::Subset<CLIENT_CONTENT>::Schema;
+
+        /* Alias for sensor frame codec */
+        using SensorFrame = Component::Protocol::SensorFrame<ClientSchema>;
 
         /**
          * @brief Class constructor
@@ -84,43 +153,24 @@ namespace Greenhouse
          */
         static void BluetoothConnectionTrackerCallback(void *arg);
 
-        /**
-         * @brief Method to prepare data for sending to BLE server
-         *
-         * @param[out] data     : Prepared data vector
-         */
-        void PrepareData(BluetoothDataVector &data);
-
-        /**
-         * @brief Method to fill space inside bluetooth vector when some values is not defined from sensor
-         *
-         * @param[in] data      : Bluetooth data vector
-         * @param[in] spaces    : Number of space wich will be filled
-         */
-        void FillSpace(BluetoothDataVector &data, const uint8_t spaces);
-
-        /**
-         * @brief Get exponent from float number
-         *
-         * @param[in] number
-         */
-        template <typename Type>
-        Type GetExponent(const float number)
+        /* Measured sample waiting for upload */
+        struct PendingSample
         {
-            return static_cast<Type>(number);
-        }
+            // Time of measurement in seconds since boot
+            int64_t timestamp;
+            // Measured values
+            Component::Protocol::SensorSample sample;
+        };
 
         /**
-         * @brief Get mantisa from float number
+         * @brief Method to encode the oldest queued samples into sensor frame
+         *
+         * @param[out] buffer   : Output buffer for encoded frame
+         * @param[out] samples  : Number of encoded samples
          *
-         * @param[in] number
-         * @param[in] precision     :
+         * @return size_t       : Size of encoded frame. Zero if encoding failed
          */
-        template <typename Type>
-        Type GetMantisa(const float number, uint8_t precision = 2)
-        {
-            return static_cast<Type>((number - static_cast<Type>(number)) * pow(10, precision));
-        }
+        size_t PrepareData(Utility::DataType::Span<uint8_t> buffer, uint8_t &samples);
 
         /**
          * @brief Get position of client
@@ -153,6 +203,9 @@ namespace Greenhouse
         /* Pointer to I2C driver */
         I2C *mI2C;
 
+        /* Pointer to arbiter of I2C bus, owns I2C driver */
+        I2C_Arbiter *mI2C_Arbiter;
+
         /* Pointer to air's properties sensor*/
         Sensor::AirSensor_I *mAirSensor;
 
@@ -164,6 +217,24 @@ namespace Greenhouse
 
         /* Bluetooth conecction tracer data */
         TrackerData mBluetoothConnectionTrackerData;
+
+        /* Sample of measurement in progress */
+        PendingSample mMeasurement;
+
+        /* Samples waiting for upload */
+        Utility::DataType::RingBuffer<PendingSample, CONFIG_SAMPLE_QUEUE_SIZE> mPendingSamples;
+
+        /* Number of queued samples in frame waiting for its result */
+        uint8_t mSentSamples;
+
+        /* Buffer for encoded sensor frame, sized to the largest write payload */
+        std::array<uint8_t, GATT_LOCAL_MTU - ATT_WRITE_HEADER_SIZE> mFrameBuffer;
+
+        /* Delta encoder of sent samples */
+        Component::Protocol::DeltaEncoder<ClientSchema> mDeltaEncoder;
+
+        /* Mutex to protect sample queue and delta encoder between main and bluetooth task */
+        std::mutex mUploadMutex;
     };
 } // namespace Greenhouse
 
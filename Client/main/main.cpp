@@ -63,9 +63,14 @@ extern "C" void app_main(void)
 
 	while (true)
 	{
-		// Wait for 2 min
-		vTaskDelay(60000 * 10);
+		vTaskDelay(CONFIG_MEASUREMENT_PERIOD * 1000);
 
-		greenhouseManager->SendDataToServer();
+		greenhouseManager->StartMeasurement();
+
+		// Upload of queued samples overlaps conversion of air sensor
+		if (greenhouseManager->IsUploadReady())
+			greenhouseManager->SendDataToServer();
+
+		greenhouseManager->CollectMeasurement();
 	}
 }
@@ -43,7 +43,7 @@ INIT_BLUETOOTH_RV BaseBluetoothController::InitBluetoothController(const esp_bt_
         return result;
 
 
-    esp_err_t local_mtu_ret = esp_ble_gatt_set_local_mtu(512);
+    esp_err_t local_mtu_ret = esp_ble_gatt_set_local_mtu(GATT_LOCAL_MTU);
     if (local_mtu_ret)
     {
         ESP_LOGE(BASE_BLUETOOTH_CONTROLLER_TAG, "set local  MTU failed, error code = %x", local_mtu_ret);
@@ -16,6 +16,9 @@
 #include "esp_gattc_api.h"   //  implements GATT configuration, such as creating services and characteristics.
 #include "esp_gatt_common_api.h"
 
+/* Common components */
+#include "BluetoothDefinitions.hpp"
+
 namespace Component
 {
     namespace Bluetooth
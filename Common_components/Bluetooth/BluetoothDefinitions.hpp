@@ -15,7 +15,7 @@ namespace Component
 {
     namespace Bluetooth
     {
-        static std::string EnumToString(esp_gap_ble_cb_event_t event)
+        inline std::string EnumToString(esp_gap_ble_cb_event_t event)
         {
             switch (event)
             {
@@ -42,7 +42,7 @@ namespace Component
             return "Unimplemented event[" + std::to_string(event) + "] conversion.";
         }
 
-        static std::string EnumToString(esp_gap_search_evt_t searchEvent)
+        inline std::string EnumToString(esp_gap_search_evt_t searchEvent)
         {
             switch (searchEvent)
             {
@@ -90,7 +90,7 @@ namespace Component
             esp_bt_uuid_t descr_uuid;
         };
 
-        static std::string EnumToString(esp_gatts_cb_event_t event)
+        inline std::string EnumToString(esp_gatts_cb_event_t event)
         {
             switch (event)
             {
@@ -204,7 +204,7 @@ namespace Component
             esp_bd_addr_t remote_bda;
         };
 
-        static std::string EnumToString(esp_gattc_cb_event_t gattc_event)
+        inline std::string EnumToString(esp_gattc_cb_event_t gattc_event)
         {
             switch (gattc_event)
             {
@@ -237,6 +237,14 @@ namespace Component
 /* PROFILES */
 #define GREENHOUSE_PROFILE 0
 
+/* MTU */
+// Local MTU requested during connection
+#define GATT_LOCAL_MTU 512
+// Default MTU before exchange
+#define GATT_DEFAULT_MTU 23
+// Size of ATT write request header (opcode + attribute handle)
+#define ATT_WRITE_HEADER_SIZE 3
+
     } // namespace Bluetooth
 } // namespace Component
 
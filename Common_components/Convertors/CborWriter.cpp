@@ -0,0 +1,294 @@
+/* Project specific includes */
+#include "Convertors/CborWriter.hpp"
+
+/* STD library includes */
+#include <cmath>
+#include <cstring>
+
+#define CBOR_WRITER_MAX_PRECISION 5
+
+// Major types
+#define CBOR_UNSIGNED 0x00
+#define CBOR_NEGATIVE 0x20
+#define CBOR_TEXT 0x60
+#define CBOR_ARRAY 0x80
+#define CBOR_MAP 0xA0
+
+// Simple values and special codes
+#define CBOR_FALSE 0xF4
+#define CBOR_TRUE 0xF5
+#define CBOR_NULL 0xF6
+#define CBOR_FLOAT32 0xFA
+#define CBOR_INDEFINITE 0x1F
+#define CBOR_BREAK 0xFF
+
+using namespace Component::Convertor;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Append raw bytes
+ */
+void CborWriter::Append(const uint8_t *data, size_t length)
+{
+    if (mOverflow)
+        return;
+
+    if (mCapacity - mSize < length)
+    {
+        mOverflow = true;
+        return;
+    }
+
+    memcpy(mBuffer + mSize, data, length);
+    mSize += length;
+}
+
+/**
+ * @brief Append one byte
+ */
+void CborWriter::Append(uint8_t byte)
+{
+    Append(&byte, 1);
+}
+
+/**
+ * @brief Append head of data item with argument in the shortest encoding
+ */
+void CborWriter::AppendHead(uint8_t major, uint64_t argument)
+{
+    if (argument < 24)
+    {
+        Append(static_cast<uint8_t>(major | argument));
+        return;
+    }
+
+    uint8_t bytes;
+    uint8_t additional;
+    if (argument <= 0xFF)
+    {
+        bytes = 1;
+        additional = 24;
+    }
+    else if (argument <= 0xFFFF)
+    {
+        bytes = 2;
+        additional = 25;
+    }
+    else if (argument <= 0xFFFFFFFF)
+    {
+        bytes = 4;
+        additional = 26;
+    }
+    else
+    {
+        bytes = 8;
+        additional = 27;
+    }
+
+    // Argument is stored in network byte order
+    uint8_t head[9];
+    head[0] = major | additional;
+    for (uint8_t i = 0; i < bytes; ++i)
+        head[bytes - i] = static_cast<uint8_t>(argument >> (8 * i));
+
+    Append(head, bytes + 1);
+}
+
+/**
+ * @brief Append text string
+ */
+void CborWriter::AppendText(const char *value)
+{
+    const char *text = value ? value : "";
+    const auto length = strlen(text);
+
+    AppendHead(CBOR_TEXT, length);
+    Append(reinterpret_cast<const uint8_t *>(text), length);
+}
+
+/**
+ * @brief Start container of major type with indefinite length
+ */
+CborWriter &CborWriter::BeginContainer(uint8_t major)
+{
+    if (mDepth >= CBOR_WRITER_MAX_DEPTH)
+    {
+        mOverflow = true;
+        return *this;
+    }
+
+    Append(static_cast<uint8_t>(major | CBOR_INDEFINITE));
+    ++mDepth;
+    return *this;
+}
+
+/**
+ * @brief Finish container with break code
+ */
+CborWriter &CborWriter::EndContainer()
+{
+    if (!mDepth)
+        return *this;
+
+    --mDepth;
+    Append(static_cast<uint8_t>(CBOR_BREAK));
+    return *this;
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+CborWriter::CborWriter(Utility::DataType::Span<uint8_t> buffer)
+    : mBuffer(buffer.data()),
+      mCapacity(buffer.size()),
+      mSize(0),
+      mDepth(0),
+      mOverflow(!buffer.data() || !buffer.size())
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+CborWriter::~CborWriter()
+{
+}
+
+/**
+ * @brief Start map
+ */
+CborWriter &CborWriter::BeginObject()
+{
+    return BeginContainer(CBOR_MAP);
+}
+
+/**
+ * @brief Finish map
+ */
+CborWriter &CborWriter::EndObject()
+{
+    return EndContainer();
+}
+
+/**
+ * @brief Start array
+ */
+CborWriter &CborWriter::BeginArray()
+{
+    return BeginContainer(CBOR_ARRAY);
+}
+
+/**
+ * @brief Finish array
+ */
+CborWriter &CborWriter::EndArray()
+{
+    return EndContainer();
+}
+
+/**
+ * @brief Write key of next map member as text string
+ */
+CborWriter &CborWriter::Key(const char *key)
+{
+    AppendText(key);
+    return *this;
+}
+
+/**
+ * @brief Write text string
+ */
+CborWriter &CborWriter::String(const char *value)
+{
+    AppendText(value);
+    return *this;
+}
+
+/**
+ * @brief Write integer in the shortest encoding
+ */
+CborWriter &CborWriter::Integer(int64_t value)
+{
+    // Negative integer n is encoded as -1 - n
+    if (value < 0)
+        AppendHead(CBOR_NEGATIVE, static_cast<uint64_t>(-(value + 1)));
+    else
+        AppendHead(CBOR_UNSIGNED, static_cast<uint64_t>(value));
+
+    return *this;
+}
+
+/**
+ * @brief Write number rounded to precision
+ */
+CborWriter &CborWriter::Number(double value, uint8_t precision)
+{
+    if (!std::isfinite(value))
+        return Null();
+
+    if (precision > CBOR_WRITER_MAX_PRECISION)
+        precision = CBOR_WRITER_MAX_PRECISION;
+
+    double scale = 1;
+    for (uint8_t i = 0; i < precision; ++i)
+        scale *= 10;
+
+    const double rounded = std::round(value * scale) / scale;
+    if (std::fabs(rounded) < 9.0e15 && rounded == std::trunc(rounded))
+        return Integer(static_cast<int64_t>(rounded));
+
+    const float single = static_cast<float>(rounded);
+    uint32_t bits;
+    memcpy(&bits, &single, sizeof(bits));
+
+    const uint8_t encoded[] = {CBOR_FLOAT32, static_cast<uint8_t>(bits >> 24), static_cast<uint8_t>(bits >> 16),
+                               static_cast<uint8_t>(bits >> 8), static_cast<uint8_t>(bits)};
+    Append(encoded, sizeof(encoded));
+    return *this;
+}
+
+/**
+ * @brief Write boolean value
+ */
+CborWriter &CborWriter::Bool(bool value)
+{
+    Append(static_cast<uint8_t>(value ? CBOR_TRUE : CBOR_FALSE));
+    return *this;
+}
+
+/**
+ * @brief Write null value
+ */
+CborWriter &CborWriter::Null()
+{
+    Append(static_cast<uint8_t>(CBOR_NULL));
+    return *this;
+}
+
+/**
+ * @brief Discard output written after checkpoint
+ */
+void CborWriter::Rewind(const Checkpoint &checkpoint)
+{
+    if (!mBuffer || checkpoint.size > mCapacity)
+        return;
+
+    mSize = checkpoint.size;
+    mDepth = checkpoint.depth;
+    mOverflow = false;
+}
+
+/**
+ * @brief Discard all output
+ */
+void CborWriter::Reset()
+{
+    Rewind({0, 0});
+}
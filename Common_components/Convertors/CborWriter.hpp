@@ -0,0 +1,206 @@
+#ifndef CBOR_WRITER_H
+#define CBOR_WRITER_H
+
+/* STD library includes */
+#include <cstddef>
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Utility/DataType/Span.hpp"
+
+/* SDK */
+#include "sdkconfig.h"
+
+#define CBOR_WRITER_TAG "CBOR writer"
+
+// Maximum nesting of maps and arrays
+#define CBOR_WRITER_MAX_DEPTH 8
+
+namespace Component
+{
+    namespace Convertor
+    {
+        /**
+         * @brief Streaming CBOR (RFC 8949) writer formatting directly into caller provided buffer.
+         *        Interface matches JsonWriter, so the same code can produce both formats.
+         *        Objects and arrays are encoded with indefinite length, so number of members
+         *        does not have to be known in advance. When output does not fit into buffer,
+         *        writer is marked as overflowed and all following calls are ignored.
+         */
+        class CborWriter
+        {
+        public:
+            /**
+             * @brief Class constructor
+             *
+             * @param[out] buffer   : Output buffer
+             */
+            explicit CborWriter(Utility::DataType::Span<uint8_t> buffer);
+
+            /**
+             * @brief Class destructor
+             */
+            ~CborWriter();
+
+            /**
+             * @brief Start map. Inside map every value has to be preceded by Key
+             */
+            CborWriter &BeginObject();
+
+            /**
+             * @brief Finish map
+             */
+            CborWriter &EndObject();
+
+            /**
+             * @brief Start array
+             */
+            CborWriter &BeginArray();
+
+            /**
+             * @brief Finish array
+             */
+            CborWriter &EndArray();
+
+            /**
+             * @brief Write key of next map member as text string
+             *
+             * @param[in] key   : Key
+             */
+            CborWriter &Key(const char *key);
+
+            /**
+             * @brief Write text string
+             *
+             * @param[in] value : String
+             */
+            CborWriter &String(const char *value);
+
+            /**
+             * @brief Write integer in the shortest encoding
+             *
+             * @param[in] value : Integer
+             */
+            CborWriter &Integer(int64_t value);
+
+            /**
+             * @brief Write number rounded to precision. Integral value is written as integer,
+             *        other values as single precision float, which matches precision of sensor values.
+             *        Value which is not finite is written as null
+             *
+             * @param[in] value     : Number
+             * @param[in] precision : Number of decimal places
+             */
+            CborWriter &Number(double value, uint8_t precision = CONFIG_JSON_Number_Precision);
+
+            /**
+             * @brief Write boolean value
+             *
+             * @param[in] value : Boolean
+             */
+            CborWriter &Bool(bool value);
+
+            /**
+             * @brief Write null value
+             */
+            CborWriter &Null();
+
+            /* State of writer which can be restored */
+            struct Checkpoint
+            {
+                size_t size;
+                size_t depth;
+            };
+
+            /**
+             * @brief Remember current state of writer
+             */
+            Checkpoint Mark() const { return {mSize, mDepth}; }
+
+            /**
+             * @brief Discard output written after checkpoint. Used to drop value which did not fit
+             *
+             * @param[in] checkpoint    : State returned by Mark()
+             */
+            void Rewind(const Checkpoint &checkpoint);
+
+            /**
+             * @brief Discard all output
+             */
+            void Reset();
+
+            /**
+             * @brief Get written CBOR. Valid only while buffer lives
+             */
+            const uint8_t *Data() const { return mBuffer; }
+
+            /**
+             * @brief Get size of written CBOR
+             */
+            size_t Size() const { return mSize; }
+
+            /**
+             * @brief Get current nesting depth
+             */
+            size_t Depth() const { return mDepth; }
+
+            /**
+             * @brief Check if output did not fit into buffer
+             */
+            bool Overflowed() const { return mOverflow; }
+
+            /**
+             * @brief Check if output is complete CBOR data item
+             */
+            bool IsComplete() const { return !mOverflow && !mDepth && mSize; }
+
+        private:
+            /**
+             * @brief Append raw bytes
+             */
+            void Append(const uint8_t *data, size_t length);
+
+            /**
+             * @brief Append one byte
+             */
+            void Append(uint8_t byte);
+
+            /**
+             * @brief Append head of data item with argument in the shortest encoding
+             */
+            void AppendHead(uint8_t major, uint64_t argument);
+
+            /**
+             * @brief Append text string
+             */
+            void AppendText(const char *value);
+
+            /**
+             * @brief Start container of major type with indefinite length
+             */
+            CborWriter &BeginContainer(uint8_t major);
+
+            /**
+             * @brief Finish container with break code
+             */
+            CborWriter &EndContainer();
+
+            /* Output buffer */
+            uint8_t *mBuffer;
+
+            /* Size of output buffer */
+            const size_t mCapacity;
+
+            /* Number of written bytes */
+            size_t mSize;
+
+            /* Current nesting depth */
+            size_t mDepth;
+
+            /* True when output did not fit into buffer */
+            bool mOverflow;
+        };
+    } // namespace Convertor
+} // namespace Component
+
+#endif // CBOR_WRITER_H
@@ -1,11 +1,10 @@
 /* Project specific includes */
 #include "Convertors/Convertor_JSON.hpp"
+#include "Convertors/NumberFormatter.hpp"
 
 /* ESP log library*/
 #include <esp_log.h>
 
-#define JSON_SEPERATOR ":"
-
 using namespace Component::Convertor;
 
 Convertor_JSON *Convertor_JSON::mConvertor{nullptr};
@@ -30,18 +29,51 @@ Convertor_JSON::~Convertor_JSON()
 }
 
 /**
- * @brief Add double quotes to string literal
- *
- * @param[in] raw   : Raw string
- *
- * @return std::string  : Raw string with added double quotes
+ * @brief Write scalar value or start of container
  */
-std::string Convertor_JSON::StringWithDoubleQuotes(const char *raw) const
+bool Convertor_JSON::WriteItem(const cJSON *item, JsonWriter &writer) const
 {
-    if (!raw)
-        return {};
+    switch (item->type & 0xFF)
+    {
+    case (cJSON_False):
+        writer.Bool(false);
+        break;
+    case (cJSON_True):
+        writer.Bool(true);
+        break;
+    case (cJSON_Number):
+        writer.Number(item->valuedouble);
+        break;
+    case (cJSON_String):
+        writer.String(item->valuestring);
+        break;
+    case (cJSON_Array):
+        writer.BeginArray();
+        return item->child != nullptr;
+    case (cJSON_Object):
+        writer.BeginObject();
+        return item->child != nullptr;
+    case (cJSON_NULL):
+        writer.Null();
+        break;
+    default:
+        ESP_LOGW(CONVERTOR_JSON_TAG, "Unhandled JSON type %d written as null", item->type);
+        writer.Null();
+        break;
+    }
+
+    return false;
+}
 
-    return std::string("\"\"").insert(1, raw);
+/**
+ * @brief Write end of container
+ */
+void Convertor_JSON::EndItem(const cJSON *item, JsonWriter &writer) const
+{
+    if ((item->type & 0xFF) == cJSON_Object)
+        writer.EndObject();
+    else
+        writer.EndArray();
 }
 
 /*********************************************
@@ -62,59 +94,90 @@ Convertor_JSON *Convertor_JSON::GetInstance()
 
 /**
  * @brief Convert JSON structure to String
- *
- * @param[in] root  : Root of cJSON strcutre
- *
- * @return std::string
  */
 std::string Convertor_JSON::ToString(const cJSON *root)
 {
-    //////////////// !!!!!! CHECK FOR NULLPTR IMPORT TO DO !!!!! 02/01/2023
-
     if (!root)
         return {};
 
-    std::string jsonString{"{}"};
-    auto child = root->child;
-
-    for (uint16_t i = 0; i < cJSON_GetArraySize(root); ++i)
+    // Capacity grows geometrically, so total work stays linear in size of JSON
+    std::string jsonString(CONVERTOR_JSON_INITIAL_CAPACITY, '\0');
+    while (true)
     {
-        if (!child)
-            continue;
-
-        switch (child->type)
-        {
-        case (cJSON_Number):
+        JsonWriter writer(Utility::DataType::Span<char>(&jsonString[0], jsonString.size()));
+        if (Serialize(root, writer))
         {
-            jsonString.insert(jsonString.size() - 1, StringWithDoubleQuotes(child->string) +
-                                                         JSON_SEPERATOR +
-                                                         ToString(child->valuedouble) + ",");
-            break;
+            jsonString.resize(writer.Size());
+            return jsonString;
         }
-        case (cJSON_String):
+
+        // Nesting too deep can not be fixed by larger buffer
+        if (!writer.Overflowed())
+            return {};
+
+        jsonString.resize(jsonString.size() * 2);
+    }
+}
+
+/**
+ * @brief Serialize JSON structure in one pass into writer
+ */
+bool Convertor_JSON::Serialize(const cJSON *root, JsonWriter &writer) const
+{
+    if (!root)
+        return false;
+
+    // Open containers, cJSON items do not hold pointer to parent
+    const cJSON *parents[JSON_WRITER_MAX_DEPTH];
+    size_t depth = 0;
+    auto item = root;
+
+    while (item && !writer.Overflowed())
+    {
+        if (depth && (parents[depth - 1]->type & 0xFF) == cJSON_Object)
+            writer.Key(item->string);
+
+        const bool container = (item->type & 0xFF) == cJSON_Array || (item->type & 0xFF) == cJSON_Object;
+        if (container && depth >= JSON_WRITER_MAX_DEPTH)
         {
-            jsonString.insert(jsonString.size() - 1, StringWithDoubleQuotes(child->string) +
-                                                         JSON_SEPERATOR +
-                                                         StringWithDoubleQuotes(child->valuestring) + ",");
-            break;
+            ESP_LOGE(CONVERTOR_JSON_TAG, "JSON nesting exceeds %d levels", JSON_WRITER_MAX_DEPTH);
+            return false;
         }
-        case (cJSON_Object):
+
+        if (WriteItem(item, writer))
         {
-            break;
+            parents[depth++] = item;
+            item = item->child;
+            continue;
         }
-        default:
-            ESP_LOGW(CONVERTOR_JSON_TAG, "Unhandled JSON tag %d", child->type);
+
+        // Empty container
+        if (container)
+            EndItem(item, writer);
+
+        if (!depth)
             break;
+
+        // Close finished containers until one with next item is found
+        while (!item->next && depth)
+        {
+            item = parents[--depth];
+            EndItem(item, writer);
         }
 
-        child = child->next;
+        item = depth ? item->next : nullptr;
     }
 
-    // Remove comma after last JSON value if JSON contain some fields
-    if (jsonString.size() > 2)
-        jsonString.erase(jsonString.size() - 2, 1);
+    return !writer.Overflowed();
+}
 
-    return jsonString;
+/**
+ * @brief Serialize JSON structure into caller provided buffer
+ */
+size_t Convertor_JSON::Serialize(const cJSON *root, Utility::DataType::Span<char> buffer) const
+{
+    JsonWriter writer(buffer);
+    return Serialize(root, writer) ? writer.Size() : 0;
 }
 
 /**
@@ -122,23 +185,8 @@ std::string Convertor_JSON::ToString(const cJSON *root)
  */
 std::string Convertor_JSON::ToString(const double number, uint8_t precision)
 {
-    if (precision > MAX_NUMBER_PRECISION)
-        precision = MAX_NUMBER_PRECISION;
-
-    // Converstion to string
-    std::string numberString(std::to_string(number));
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    const auto length = NumberFormatter::Fixed(number, precision, Utility::DataType::Span<char>(buffer));
 
-    // Try to find floating point in string number
-    auto floatingPoint = numberString.find('.');
-    if (floatingPoint == std::string::npos)
-        return {};
-
-    // Erase string with define precision
-    numberString.erase(floatingPoint + precision + 1);
-
-    // Check if last character is floating point (Precision set to 0) then remove last character
-    if (numberString.back() == '.')
-        numberString.pop_back();
-
-    return numberString;
-}
\ No newline at end of file
+    return std::string(buffer, length);
+}
@@ -4,6 +4,10 @@
 /* STD library includes */
 #include <mutex>
 #include <cstdint>
+#include <string>
+
+/* Project specific includes */
+#include "Convertors/JsonWriter.hpp"
 
 /* ESP JSON library */
 #include <cJSON.h>
@@ -13,7 +17,8 @@
 
 #define CONVERTOR_JSON_TAG "Convertor JSON"
 
-#define MAX_NUMBER_PRECISION 5
+// Initial capacity of string produced by ToString, doubled until JSON fits
+#define CONVERTOR_JSON_INITIAL_CAPACITY 128
 
 namespace Component
 {
@@ -34,16 +39,39 @@ namespace Component
              *
              * @param[in] root  : Root of cJSON strcutre
              *
-             * @return std::string
+             * @return std::string  : JSON, empty when root is null or nesting is too deep
              */
             std::string ToString(const cJSON *root);
 
+            /**
+             * @brief Serialize JSON structure in one pass into writer. Nested objects and arrays are
+             *        supported up to JSON_WRITER_MAX_DEPTH, numbers use writer precision
+             *
+             * @param[in] root      : Root of cJSON structure
+             * @param[out] writer   : Writer receiving JSON
+             *
+             * @return bool         : True  - JSON was written completely
+             *                        False - Output did not fit or nesting is too deep
+             */
+            bool Serialize(const cJSON *root, JsonWriter &writer) const;
+
+            /**
+             * @brief Serialize JSON structure into caller provided buffer
+             *
+             * @param[in] root      : Root of cJSON structure
+             * @param[out] buffer   : Output buffer, JSON is null terminated
+             *
+             * @return size_t       : Length of JSON, zero when it did not fit
+             */
+            size_t Serialize(const cJSON *root, Utility::DataType::Span<char> buffer) const;
+
             /**
              * @brief Convert double to String with defined precision
              *
-             * @param[in] number  : Number
+             * @param[in] number    : Number
+             * @param[in] precision : Number of decimal places
              *
-             * @return std::string
+             * @return std::string  : Correctly rounded number, empty when it is not finite or out of range
              */
             std::string ToString(const double number, uint8_t precision = CONFIG_JSON_Number_Precision);
 
@@ -59,13 +87,16 @@ namespace Component
             ~Convertor_JSON();
 
             /**
-             * @brief Add double quotes to string literal
-             *
-             * @param[in] raw   : Raw string
+             * @brief Write scalar value or start of container
              *
-             * @return std::string  : Raw string with added double quotes
+             * @return bool : True when item is non empty container
+             */
+            bool WriteItem(const cJSON *item, JsonWriter &writer) const;
+
+            /**
+             * @brief Write end of container
              */
-            std::string StringWithDoubleQuotes(const char *raw) const;
+            void EndItem(const cJSON *item, JsonWriter &writer) const;
 
             // Singleton instance of JSON converter
             static Convertor_JSON *mConvertor;
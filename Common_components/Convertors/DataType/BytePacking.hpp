@@ -0,0 +1,148 @@
+/**
+ * Packing of integers to bytes and back
+ *
+ * Header only helpers for sensor commands, bus transfers and frames. Fixed size variants are constexpr,
+ * so command bytes can be computed at compile time. Nothing allocates.
+ *
+ * @author Dominik Regec
+ */
+#ifndef BYTE_PACKING_H
+#define BYTE_PACKING_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/* Common components */
+#include "Common_components/Utility/DataType/IndexSequence.hpp"
+#include "Common_components/Utility/DataType/Span.hpp"
+
+namespace Component
+{
+    namespace Convertor
+    {
+        /* Order of bytes */
+        enum class Endian
+        {
+            BIG,
+            LITTLE,
+        };
+
+        namespace Detail
+        {
+            /**
+             * @brief Get shift of byte at index within count bytes
+             */
+            template <Endian Order>
+            constexpr size_t Shift(size_t index, size_t count)
+            {
+                return (Order == Endian::BIG ? count - 1 - index : index) * 8;
+            }
+
+            template <Endian Order, typename T, size_t... Indexes>
+            constexpr std::array<uint8_t, sizeof(T)> Pack(T value, Utility::DataType::IndexSequence<Indexes...>)
+            {
+                return {{static_cast<uint8_t>(static_cast<typename std::make_unsigned<T>::type>(value) >> Shift<Order>(Indexes, sizeof(T)))...}};
+            }
+
+            template <typename T, Endian Order>
+            constexpr typename std::make_unsigned<T>::type Unpack(const uint8_t *in, size_t index)
+            {
+                using Unsigned = typename std::make_unsigned<T>::type;
+                return index == sizeof(T)
+                           ? 0
+                           : static_cast<Unsigned>(static_cast<Unsigned>(in[index]) << Shift<Order>(index, sizeof(T))) | Unpack<T, Order>(in, index + 1);
+            }
+        } // namespace Detail
+
+        /**
+         * @brief Pack integer to bytes
+         *
+         * @tparam Order    : Order of bytes
+         *
+         * @param[in] value : Integer
+         *
+         * @return std::array   : sizeof(T) bytes
+         */
+        template <Endian Order = Endian::BIG, typename T>
+        constexpr std::array<uint8_t, sizeof(T)> Pack(T value)
+        {
+            static_assert(std::is_integral<T>::value, "Only integers can be packed");
+            return Detail::Pack<Order>(value, typename Utility::DataType::MakeIndexSequence<sizeof(T)>::Type());
+        }
+
+        /**
+         * @brief Unpack integer from bytes
+         *
+         * @tparam T        : Integer type
+         * @tparam Order    : Order of bytes
+         *
+         * @param[in] in    : At least sizeof(T) bytes
+         *
+         * @return T        : Integer
+         */
+        template <typename T, Endian Order = Endian::BIG>
+        constexpr T Unpack(const uint8_t *in)
+        {
+            static_assert(std::is_integral<T>::value, "Only integers can be unpacked");
+            return static_cast<T>(Detail::Unpack<T, Order>(in, 0));
+        }
+
+        /**
+         * @brief Store low bytes of integer, used when number of bytes is known only at run time
+         *
+         * @tparam Order        : Order of bytes
+         *
+         * @param[in] value     : Integer
+         * @param[out] out      : Output buffer
+         * @param[in] count     : Number of stored bytes in range <1, sizeof(T)>
+         *
+         * @return size_t       : Number of stored bytes, zero when count is invalid or output is too small
+         */
+        template <Endian Order = Endian::BIG, typename T>
+        size_t Store(T value, Utility::DataType::Span<uint8_t> out, size_t count = sizeof(T))
+        {
+            static_assert(std::is_integral<T>::value, "Only integers can be stored");
+
+            if (!count || count > sizeof(T) || count > out.size())
+                return 0;
+
+            const auto raw = static_cast<typename std::make_unsigned<T>::type>(value);
+            for (size_t i = 0; i < count; ++i)
+                out[i] = static_cast<uint8_t>(raw >> Detail::Shift<Order>(i, count));
+
+            return count;
+        }
+
+        /**
+         * @brief Load integer from count bytes, used when number of bytes is known only at run time
+         *
+         * @tparam T            : Integer type
+         * @tparam Order        : Order of bytes
+         *
+         * @param[in] in        : Input bytes
+         * @param[in] count     : Number of loaded bytes in range <1, sizeof(T)>
+         *
+         * @return T            : Integer, zero when count is invalid or input is too small
+         */
+        template <typename T, Endian Order = Endian::BIG>
+        T Load(Utility::DataType::ByteView in, size_t count = sizeof(T))
+        {
+            static_assert(std::is_integral<T>::value, "Only integers can be loaded");
+
+            using Unsigned = typename std::make_unsigned<T>::type;
+            if (!count || count > sizeof(T) || count > in.size())
+                return 0;
+
+            Unsigned raw = 0;
+            for (size_t i = 0; i < count; ++i)
+                raw = static_cast<Unsigned>(raw | static_cast<Unsigned>(in[i]) << Detail::Shift<Order>(i, count));
+
+            return static_cast<T>(raw);
+        }
+    } // namespace Convertor
+} // namespace Component
+
+#endif // BYTE_PACKING_H
@@ -0,0 +1,422 @@
+/* Project specific includes */
+#include "Convertors/JsonStreamParser.hpp"
+
+/* STD library includes */
+#include <cstdlib>
+#include <cstring>
+
+using namespace Component::Convertor;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Check if character is JSON whitespace
+ */
+static bool IsWhitespace(char character)
+{
+    return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+}
+
+/**
+ * @brief Process one character
+ */
+void JsonStreamParser::Step(char character)
+{
+    switch (mState)
+    {
+    case (State::VALUE):
+        if (IsWhitespace(character))
+            return;
+
+        mTokenLength = 0;
+        switch (character)
+        {
+        case ('{'):
+            Emit(JsonEventType::OBJECT_BEGIN);
+            Push(false);
+            mState = State::KEY;
+            return;
+        case ('['):
+            Emit(JsonEventType::ARRAY_BEGIN);
+            Push(true);
+            return;
+        case (']'):
+            // Empty array
+            if (mAllowClose)
+                Pop(true);
+            else
+                Fail(JsonStreamStatus::SYNTAX_ERROR);
+            return;
+        case ('"'):
+            mIsKey = false;
+            mState = State::STRING;
+            return;
+        case ('t'):
+            mLiteral = "true";
+            break;
+        case ('f'):
+            mLiteral = "false";
+            break;
+        case ('n'):
+            mLiteral = "null";
+            break;
+        default:
+            if (character == '-' || (character >= '0' && character <= '9'))
+            {
+                AppendToken(character);
+                mState = State::NUMBER;
+            }
+            else
+                Fail(JsonStreamStatus::SYNTAX_ERROR);
+            return;
+        }
+
+        mLiteralPosition = 1;
+        mState = State::LITERAL;
+        return;
+
+    case (State::KEY):
+        if (IsWhitespace(character))
+            return;
+
+        if (character == '"')
+        {
+            mTokenLength = 0;
+            mIsKey = true;
+            mState = State::STRING;
+        }
+        else if (character == '}' && mAllowClose)
+            Pop(false);
+        else
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+        return;
+
+    case (State::COLON):
+        if (IsWhitespace(character))
+            return;
+
+        if (character == ':')
+        {
+            mAllowClose = false;
+            mState = State::VALUE;
+        }
+        else
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+        return;
+
+    case (State::AFTER_VALUE):
+        if (IsWhitespace(character))
+            return;
+
+        if (character == ',')
+        {
+            mAllowClose = false;
+            mState = (mStack & (1u << (mDepth - 1))) ? State::VALUE : State::KEY;
+        }
+        else if (character == '}')
+            Pop(false);
+        else if (character == ']')
+            Pop(true);
+        else
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+        return;
+
+    case (State::STRING):
+        if (character == '"')
+            FinishString();
+        else if (character == '\\')
+            mState = State::STRING_ESCAPE;
+        else if (static_cast<unsigned char>(character) < 0x20)
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+        else
+            AppendToken(character);
+        return;
+
+    case (State::STRING_ESCAPE):
+    {
+        static const char escaped[] = "\"\\/bfnrt";
+        static const char replaced[] = "\"\\/\b\f\n\r\t";
+
+        if (character == 'u')
+        {
+            mCodePoint = 0;
+            mCodePointDigits = 0;
+            mState = State::STRING_UNICODE;
+            return;
+        }
+
+        const char *found = character ? strchr(escaped, character) : nullptr;
+        if (!found)
+        {
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+            return;
+        }
+
+        AppendToken(replaced[found - escaped]);
+        mState = State::STRING;
+        return;
+    }
+
+    case (State::STRING_UNICODE):
+    {
+        uint8_t digit;
+        if (character >= '0' && character <= '9')
+            digit = character - '0';
+        else if (character >= 'a' && character <= 'f')
+            digit = character - 'a' + 10;
+        else if (character >= 'A' && character <= 'F')
+            digit = character - 'A' + 10;
+        else
+        {
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+            return;
+        }
+
+        mCodePoint = static_cast<uint16_t>((mCodePoint << 4) | digit);
+        if (++mCodePointDigits < 4)
+            return;
+
+        // Code point is stored as UTF-8, surrogate pairs are kept as two code points
+        if (mCodePoint < 0x80)
+            AppendToken(static_cast<char>(mCodePoint));
+        else if (mCodePoint < 0x800)
+        {
+            AppendToken(static_cast<char>(0xC0 | (mCodePoint >> 6)));
+            AppendToken(static_cast<char>(0x80 | (mCodePoint & 0x3F)));
+        }
+        else
+        {
+            AppendToken(static_cast<char>(0xE0 | (mCodePoint >> 12)));
+            AppendToken(static_cast<char>(0x80 | ((mCodePoint >> 6) & 0x3F)));
+            AppendToken(static_cast<char>(0x80 | (mCodePoint & 0x3F)));
+        }
+
+        mState = State::STRING;
+        return;
+    }
+
+    case (State::NUMBER):
+        if ((character >= '0' && character <= '9') || character == '.' || character == 'e' ||
+            character == 'E' || character == '+' || character == '-')
+        {
+            AppendToken(character);
+            return;
+        }
+
+        // Character after number belongs to structure
+        FinishNumber();
+        if (mStatus == JsonStreamStatus::IN_PROGRESS || mStatus == JsonStreamStatus::COMPLETE)
+            Step(character);
+        return;
+
+    case (State::LITERAL):
+        if (character != mLiteral[mLiteralPosition])
+        {
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+            return;
+        }
+
+        if (mLiteral[++mLiteralPosition])
+            return;
+
+        if (*mLiteral == 'n')
+            Emit(JsonEventType::NULL_VALUE);
+        else
+        {
+            JsonEvent event{JsonEventType::BOOL, mDepth, nullptr, 0, 0, *mLiteral == 't'};
+            mHandler(event, mContext);
+        }
+
+        AfterValue();
+        return;
+
+    case (State::DONE):
+        if (!IsWhitespace(character))
+            Fail(JsonStreamStatus::SYNTAX_ERROR);
+        return;
+    }
+}
+
+/**
+ * @brief Emit event without value
+ */
+void JsonStreamParser::Emit(JsonEventType type)
+{
+    JsonEvent event{type, mDepth, nullptr, 0, 0, false};
+    mHandler(event, mContext);
+}
+
+/**
+ * @brief Open container
+ */
+void JsonStreamParser::Push(bool array)
+{
+    if (mDepth >= JSON_STREAM_MAX_DEPTH)
+    {
+        Fail(JsonStreamStatus::DEPTH_ERROR);
+        return;
+    }
+
+    if (array)
+        mStack |= 1u << mDepth;
+    else
+        mStack &= ~(1u << mDepth);
+
+    ++mDepth;
+    mAllowClose = true;
+    mState = array ? State::VALUE : State::KEY;
+}
+
+/**
+ * @brief Close container if it is of expected type
+ */
+void JsonStreamParser::Pop(bool array)
+{
+    if (!mDepth || static_cast<bool>(mStack & (1u << (mDepth - 1))) != array)
+    {
+        Fail(JsonStreamStatus::SYNTAX_ERROR);
+        return;
+    }
+
+    --mDepth;
+    Emit(array ? JsonEventType::ARRAY_END : JsonEventType::OBJECT_END);
+    AfterValue();
+}
+
+/**
+ * @brief Move to state after finished value
+ */
+void JsonStreamParser::AfterValue()
+{
+    if (mDepth)
+    {
+        mState = State::AFTER_VALUE;
+        return;
+    }
+
+    mState = State::DONE;
+    mStatus = JsonStreamStatus::COMPLETE;
+}
+
+/**
+ * @brief Append character to token
+ */
+void JsonStreamParser::AppendToken(char character)
+{
+    // One character is kept for terminating null
+    if (mTokenLength + 1 >= sizeof(mToken))
+    {
+        Fail(JsonStreamStatus::TOKEN_ERROR);
+        return;
+    }
+
+    mToken[mTokenLength++] = character;
+}
+
+/**
+ * @brief Emit finished string or key
+ */
+void JsonStreamParser::FinishString()
+{
+    mToken[mTokenLength] = '\0';
+
+    JsonEvent event{mIsKey ? JsonEventType::KEY : JsonEventType::STRING, mDepth, mToken, mTokenLength, 0, false};
+    mHandler(event, mContext);
+
+    if (mIsKey)
+        mState = State::COLON;
+    else
+        AfterValue();
+}
+
+/**
+ * @brief Emit finished number
+ */
+void JsonStreamParser::FinishNumber()
+{
+    mToken[mTokenLength] = '\0';
+
+    char *end{nullptr};
+    const double number = strtod(mToken, &end);
+    if (end != mToken + mTokenLength || (mToken[0] == '-' && mTokenLength == 1))
+    {
+        Fail(JsonStreamStatus::SYNTAX_ERROR);
+        return;
+    }
+
+    JsonEvent event{JsonEventType::NUMBER, mDepth, mToken, mTokenLength, number, false};
+    mHandler(event, mContext);
+    AfterValue();
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+JsonStreamParser::JsonStreamParser(Handler_T handler, void *context)
+    : mHandler(handler),
+      mContext(context)
+{
+    Reset();
+}
+
+/**
+ * @brief Class destructor
+ */
+JsonStreamParser::~JsonStreamParser()
+{
+}
+
+/**
+ * @brief Prepare parser for new document
+ */
+void JsonStreamParser::Reset()
+{
+    mStatus = JsonStreamStatus::IN_PROGRESS;
+    mState = State::VALUE;
+    mAllowClose = false;
+    mIsKey = false;
+    mStack = 0;
+    mDepth = 0;
+    mTokenLength = 0;
+    mLiteral = nullptr;
+    mLiteralPosition = 0;
+    mCodePoint = 0;
+    mCodePointDigits = 0;
+}
+
+/**
+ * @brief Parse next fragment of document
+ */
+JsonStreamStatus JsonStreamParser::Feed(const char *data, size_t length)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (mStatus != JsonStreamStatus::IN_PROGRESS && mStatus != JsonStreamStatus::COMPLETE)
+            break;
+
+        Step(data[i]);
+    }
+
+    return mStatus;
+}
+
+/**
+ * @brief Finish document after its last fragment
+ */
+JsonStreamStatus JsonStreamParser::Finish()
+{
+    // Number at top level has no terminating character
+    if (mStatus == JsonStreamStatus::IN_PROGRESS && mState == State::NUMBER)
+        FinishNumber();
+
+    if (mStatus == JsonStreamStatus::IN_PROGRESS)
+        mStatus = JsonStreamStatus::SYNTAX_ERROR;
+
+    return mStatus;
+}
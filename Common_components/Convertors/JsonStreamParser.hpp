@@ -0,0 +1,216 @@
+#ifndef JSON_STREAM_PARSER_H
+#define JSON_STREAM_PARSER_H
+
+/* STD library includes */
+#include <cstddef>
+#include <cstdint>
+
+#define JSON_STREAM_PARSER_TAG "JSON stream parser"
+
+// Maximum nesting of objects and arrays
+#define JSON_STREAM_MAX_DEPTH 16
+
+// Maximum length of key, string or number token
+#define JSON_STREAM_MAX_TOKEN 64
+
+namespace Component
+{
+    namespace Convertor
+    {
+        /* Type of parser event */
+        enum class JsonEventType
+        {
+            OBJECT_BEGIN,
+            OBJECT_END,
+            ARRAY_BEGIN,
+            ARRAY_END,
+            KEY,
+            STRING,
+            NUMBER,
+            BOOL,
+            NULL_VALUE,
+        };
+
+        /* Event emitted by parser */
+        struct JsonEvent
+        {
+            JsonEventType type;
+            // Number of containers enclosing the event, container itself is not counted for its begin and end
+            size_t depth;
+            // Text of key or string, valid only during handler call
+            const char *text;
+            size_t length;
+            // Value of number
+            double number;
+            // Value of boolean
+            bool boolean;
+        };
+
+        /* Status of parsing */
+        enum class JsonStreamStatus
+        {
+            IN_PROGRESS,  // <- Document is not finished yet
+            COMPLETE,     // <- Whole document was parsed
+            SYNTAX_ERROR, // <- Input is not valid JSON
+            DEPTH_ERROR,  // <- Nesting exceeds JSON_STREAM_MAX_DEPTH
+            TOKEN_ERROR,  // <- Key, string or number exceeds JSON_STREAM_MAX_TOKEN
+        };
+
+        /**
+         * @brief Incremental JSON parser with fixed memory. Input may be split at any character,
+         *        every fragment is passed to Feed as it arrives. Parser emits events for structure
+         *        and values, so memory does not depend on size of document.
+         */
+        class JsonStreamParser
+        {
+        public:
+            /* Handler of parser events */
+            using Handler_T = void (*)(const JsonEvent &event, void *context);
+
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] handler   : Handler of events
+             * @param[in] context   : Context passed to handler
+             */
+            explicit JsonStreamParser(Handler_T handler, void *context);
+
+            /**
+             * @brief Class destructor
+             */
+            ~JsonStreamParser();
+
+            /**
+             * @brief Prepare parser for new document
+             */
+            void Reset();
+
+            /**
+             * @brief Parse next fragment of document
+             *
+             * @param[in] data      : Fragment
+             * @param[in] length    : Length of fragment
+             *
+             * @return JsonStreamStatus : Status after fragment. Error is final until Reset
+             */
+            JsonStreamStatus Feed(const char *data, size_t length);
+
+            /**
+             * @brief Finish document after its last fragment
+             *
+             * @return JsonStreamStatus : COMPLETE when whole document was parsed, error otherwise
+             */
+            JsonStreamStatus Finish();
+
+            /**
+             * @brief Get current status
+             */
+            JsonStreamStatus GetStatus() const { return mStatus; }
+
+        private:
+            /* Expected input */
+            enum class State : uint8_t
+            {
+                VALUE,
+                KEY,
+                COLON,
+                AFTER_VALUE,
+                STRING,
+                STRING_ESCAPE,
+                STRING_UNICODE,
+                NUMBER,
+                LITERAL,
+                DONE,
+            };
+
+            /**
+             * @brief Process one character
+             */
+            void Step(char character);
+
+            /**
+             * @brief Emit event without value
+             */
+            void Emit(JsonEventType type);
+
+            /**
+             * @brief Open container
+             */
+            void Push(bool array);
+
+            /**
+             * @brief Close container if it is of expected type
+             */
+            void Pop(bool array);
+
+            /**
+             * @brief Move to state after finished value
+             */
+            void AfterValue();
+
+            /**
+             * @brief Append character to token
+             */
+            void AppendToken(char character);
+
+            /**
+             * @brief Emit finished string or key
+             */
+            void FinishString();
+
+            /**
+             * @brief Emit finished number
+             */
+            void FinishNumber();
+
+            /**
+             * @brief Stop parsing with error
+             */
+            void Fail(JsonStreamStatus status) { mStatus = status; }
+
+            /* Handler of events */
+            const Handler_T mHandler;
+
+            /* Context passed to handler */
+            void *const mContext;
+
+            /* Status of parsing */
+            JsonStreamStatus mStatus;
+
+            /* Expected input */
+            State mState;
+
+            /* True when container may be closed at current position */
+            bool mAllowClose;
+
+            /* True when string being parsed is key */
+            bool mIsKey;
+
+            /* Open containers, bit is set for array */
+            uint32_t mStack;
+
+            /* Number of open containers */
+            size_t mDepth;
+
+            /* Text of current key, string or number */
+            char mToken[JSON_STREAM_MAX_TOKEN];
+
+            /* Length of current token */
+            size_t mTokenLength;
+
+            /* Literal being matched */
+            const char *mLiteral;
+
+            /* Number of matched characters of literal */
+            uint8_t mLiteralPosition;
+
+            /* Code point of unicode escape */
+            uint16_t mCodePoint;
+
+            /* Number of parsed hex digits of unicode escape */
+            uint8_t mCodePointDigits;
+        };
+    } // namespace Convertor
+} // namespace Component
+
+#endif // JSON_STREAM_PARSER_H
@@ -0,0 +1,301 @@
+/* Project specific includes */
+#include "Convertors/JsonWriter.hpp"
+#include "Convertors/NumberFormatter.hpp"
+
+/* STD library includes */
+#include <cstring>
+
+using namespace Component::Convertor;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Write comma when value is not the first one in container
+ */
+void JsonWriter::Separator()
+{
+    // Value of object member follows its key directly
+    if (mAfterKey)
+    {
+        mAfterKey = false;
+        return;
+    }
+
+    if (!mDepth)
+        return;
+
+    const uint32_t bit = 1u << (mDepth - 1);
+    if (mHasValue & bit)
+        Append(',');
+
+    mHasValue |= bit;
+}
+
+/**
+ * @brief Append raw characters
+ */
+void JsonWriter::Append(const char *data, size_t length)
+{
+    if (mOverflow)
+        return;
+
+    // One character is always kept for terminating null
+    if (mCapacity - mSize <= length)
+    {
+        mOverflow = true;
+        return;
+    }
+
+    memcpy(mBuffer + mSize, data, length);
+    mSize += length;
+    mBuffer[mSize] = '\0';
+}
+
+/**
+ * @brief Append one character
+ */
+void JsonWriter::Append(char character)
+{
+    Append(&character, 1);
+}
+
+/**
+ * @brief Append quoted and escaped string
+ */
+void JsonWriter::AppendEscaped(const char *value)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    Append('"');
+
+    const char *begin = value ? value : "";
+    const char *run = begin;
+
+    for (const char *it = begin; *it; ++it)
+    {
+        const auto character = static_cast<unsigned char>(*it);
+        if (character >= 0x20 && character != '"' && character != '\\')
+            continue;
+
+        // Copy characters which do not need escaping at once
+        Append(run, it - run);
+        run = it + 1;
+
+        switch (character)
+        {
+        case ('"'):
+            Append("\\\"", 2);
+            break;
+        case ('\\'):
+            Append("\\\\", 2);
+            break;
+        case ('\n'):
+            Append("\\n", 2);
+            break;
+        case ('\r'):
+            Append("\\r", 2);
+            break;
+        case ('\t'):
+            Append("\\t", 2);
+            break;
+        default:
+        {
+            const char escaped[] = {'\\', 'u', '0', '0', hex[character >> 4], hex[character & 0x0F]};
+            Append(escaped, sizeof(escaped));
+            break;
+        }
+        }
+    }
+
+    Append(run, strlen(run));
+    Append('"');
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+JsonWriter::JsonWriter(Utility::DataType::Span<char> buffer)
+    : mBuffer(buffer.data()),
+      mCapacity(buffer.size()),
+      mSize(0),
+      mDepth(0),
+      mHasValue(0),
+      mAfterKey(false),
+      mOverflow(!buffer.data() || !buffer.size())
+{
+    if (!mOverflow)
+        mBuffer[0] = '\0';
+}
+
+/**
+ * @brief Class destructor
+ */
+JsonWriter::~JsonWriter()
+{
+}
+
+/**
+ * @brief Start object
+ */
+JsonWriter &JsonWriter::BeginObject()
+{
+    if (mDepth >= JSON_WRITER_MAX_DEPTH)
+    {
+        mOverflow = true;
+        return *this;
+    }
+
+    Separator();
+    Append('{');
+    mHasValue &= ~(1u << mDepth++);
+    return *this;
+}
+
+/**
+ * @brief Finish object
+ */
+JsonWriter &JsonWriter::EndObject()
+{
+    if (!mDepth)
+        return *this;
+
+    --mDepth;
+    Append('}');
+    return *this;
+}
+
+/**
+ * @brief Start array
+ */
+JsonWriter &JsonWriter::BeginArray()
+{
+    if (mDepth >= JSON_WRITER_MAX_DEPTH)
+    {
+        mOverflow = true;
+        return *this;
+    }
+
+    Separator();
+    Append('[');
+    mHasValue &= ~(1u << mDepth++);
+    return *this;
+}
+
+/**
+ * @brief Finish array
+ */
+JsonWriter &JsonWriter::EndArray()
+{
+    if (!mDepth)
+        return *this;
+
+    --mDepth;
+    Append(']');
+    return *this;
+}
+
+/**
+ * @brief Write key of next object member
+ */
+JsonWriter &JsonWriter::Key(const char *key)
+{
+    Separator();
+    AppendEscaped(key);
+    Append(':');
+    mAfterKey = true;
+    return *this;
+}
+
+/**
+ * @brief Write string value
+ */
+JsonWriter &JsonWriter::String(const char *value)
+{
+    Separator();
+    AppendEscaped(value);
+    return *this;
+}
+
+/**
+ * @brief Write integer value
+ */
+JsonWriter &JsonWriter::Integer(int64_t value)
+{
+    char digits[NUMBER_FORMATTER_BUFFER_SIZE];
+    const auto length = NumberFormatter::Integer(value, Utility::DataType::Span<char>(digits));
+
+    Separator();
+    Append(digits, length);
+    return *this;
+}
+
+/**
+ * @brief Write number with fixed precision
+ */
+JsonWriter &JsonWriter::Number(double value, uint8_t precision)
+{
+    char digits[NUMBER_FORMATTER_BUFFER_SIZE];
+    const auto length = NumberFormatter::Fixed(value, precision, Utility::DataType::Span<char>(digits), true);
+
+    // Value is not finite or out of range of fixed-point formatting
+    if (!length)
+        return Null();
+
+    Separator();
+    Append(digits, length);
+    return *this;
+}
+
+/**
+ * @brief Write boolean value
+ */
+JsonWriter &JsonWriter::Bool(bool value)
+{
+    Separator();
+    if (value)
+        Append("true", 4);
+    else
+        Append("false", 5);
+
+    return *this;
+}
+
+/**
+ * @brief Write null value
+ */
+JsonWriter &JsonWriter::Null()
+{
+    Separator();
+    Append("null", 4);
+    return *this;
+}
+
+/**
+ * @brief Discard output written after checkpoint
+ */
+void JsonWriter::Rewind(const Checkpoint &checkpoint)
+{
+    if (!mBuffer || !mCapacity || checkpoint.size >= mCapacity)
+        return;
+
+    mSize = checkpoint.size;
+    mDepth = checkpoint.depth;
+    mHasValue = checkpoint.hasValue;
+    mAfterKey = checkpoint.afterKey;
+    mOverflow = false;
+    mBuffer[mSize] = '\0';
+}
+
+/**
+ * @brief Discard all output
+ */
+void JsonWriter::Reset()
+{
+    Rewind({0, 0, 0, false});
+}
@@ -0,0 +1,201 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+/* STD library includes */
+#include <cstddef>
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Utility/DataType/Span.hpp"
+
+/* SDK */
+#include "sdkconfig.h"
+
+#define JSON_WRITER_TAG "JSON writer"
+
+// Maximum nesting of objects and arrays
+#define JSON_WRITER_MAX_DEPTH 8
+
+namespace Component
+{
+    namespace Convertor
+    {
+        /**
+         * @brief Streaming JSON writer formatting directly into caller provided buffer.
+         *        It does not build any tree and never allocates. When output does not fit into
+         *        buffer, writer is marked as overflowed and all following calls are ignored.
+         */
+        class JsonWriter
+        {
+        public:
+            /**
+             * @brief Class constructor
+             *
+             * @param[out] buffer   : Output buffer. Output is always null terminated
+             */
+            explicit JsonWriter(Utility::DataType::Span<char> buffer);
+
+            /**
+             * @brief Class destructor
+             */
+            ~JsonWriter();
+
+            /**
+             * @brief Start object. Inside object every value has to be preceded by Key
+             */
+            JsonWriter &BeginObject();
+
+            /**
+             * @brief Finish object
+             */
+            JsonWriter &EndObject();
+
+            /**
+             * @brief Start array
+             */
+            JsonWriter &BeginArray();
+
+            /**
+             * @brief Finish array
+             */
+            JsonWriter &EndArray();
+
+            /**
+             * @brief Write key of next object member
+             *
+             * @param[in] key   : Key, escaped when needed
+             */
+            JsonWriter &Key(const char *key);
+
+            /**
+             * @brief Write string value
+             *
+             * @param[in] value : String, escaped when needed
+             */
+            JsonWriter &String(const char *value);
+
+            /**
+             * @brief Write integer value
+             *
+             * @param[in] value : Integer
+             */
+            JsonWriter &Integer(int64_t value);
+
+            /**
+             * @brief Write number with fixed precision. Trailing zeros are removed.
+             *        Value which is not finite or does not fit into 64 bit integer part is written as null
+             *
+             * @param[in] value     : Number
+             * @param[in] precision : Number of decimal places
+             */
+            JsonWriter &Number(double value, uint8_t precision = CONFIG_JSON_Number_Precision);
+
+            /**
+             * @brief Write boolean value
+             *
+             * @param[in] value : Boolean
+             */
+            JsonWriter &Bool(bool value);
+
+            /**
+             * @brief Write null value
+             */
+            JsonWriter &Null();
+
+            /* State of writer which can be restored */
+            struct Checkpoint
+            {
+                size_t size;
+                size_t depth;
+                uint32_t hasValue;
+                bool afterKey;
+            };
+
+            /**
+             * @brief Remember current state of writer
+             */
+            Checkpoint Mark() const { return {mSize, mDepth, mHasValue, mAfterKey}; }
+
+            /**
+             * @brief Discard output written after checkpoint. Used to drop value which did not fit
+             *
+             * @param[in] checkpoint    : State returned by Mark()
+             */
+            void Rewind(const Checkpoint &checkpoint);
+
+            /**
+             * @brief Discard all output
+             */
+            void Reset();
+
+            /**
+             * @brief Get written JSON. Valid only while buffer lives
+             */
+            const char *Data() const { return mBuffer; }
+
+            /**
+             * @brief Get size of written JSON without terminating null
+             */
+            size_t Size() const { return mSize; }
+
+            /**
+             * @brief Get current nesting depth
+             */
+            size_t Depth() const { return mDepth; }
+
+            /**
+             * @brief Check if output did not fit into buffer
+             */
+            bool Overflowed() const { return mOverflow; }
+
+            /**
+             * @brief Check if output is complete JSON document
+             */
+            bool IsComplete() const { return !mOverflow && !mDepth && mSize; }
+
+        private:
+            /**
+             * @brief Write comma when value is not the first one in container
+             */
+            void Separator();
+
+            /**
+             * @brief Append raw characters
+             */
+            void Append(const char *data, size_t length);
+
+            /**
+             * @brief Append one character
+             */
+            void Append(char character);
+
+            /**
+             * @brief Append quoted and escaped string
+             */
+            void AppendEscaped(const char *value);
+
+            /* Output buffer */
+            char *mBuffer;
+
+            /* Size of output buffer */
+            const size_t mCapacity;
+
+            /* Number of written characters */
+            size_t mSize;
+
+            /* Current nesting depth */
+            size_t mDepth;
+
+            /* Bit per level, set when container already has value */
+            uint32_t mHasValue;
+
+            /* True when previous token was key */
+            bool mAfterKey;
+
+            /* True when output did not fit into buffer */
+            bool mOverflow;
+        };
+    } // namespace Convertor
+} // namespace Component
+
+#endif // JSON_WRITER_H
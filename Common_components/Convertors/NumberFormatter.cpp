@@ -0,0 +1,198 @@
+/* Project specific includes */
+#include "Convertors/NumberFormatter.hpp"
+
+/* STD library includes */
+#include <cmath>
+
+using namespace Component::Convertor;
+
+// Powers of ten which fit into 64 bits
+static constexpr uint64_t POWERS_OF_TEN[] = {
+    1ull,
+    10ull,
+    100ull,
+    1000ull,
+    10000ull,
+    100000ull,
+    1000000ull,
+    10000000ull,
+    100000000ull,
+    1000000000ull,
+    10000000000ull,
+    100000000000ull,
+    1000000000000ull,
+    10000000000000ull,
+    100000000000000ull,
+    1000000000000000ull,
+    10000000000000000ull,
+    100000000000000000ull,
+    1000000000000000000ull,
+    10000000000000000000ull,
+};
+
+// Decimal digits of numbers 0 - 99
+static constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// 2^64, the smallest value whose integral part does not fit into 64 bits
+#define NUMBER_FORMATTER_INTEGRAL_LIMIT 18446744073709551616.0
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Get number of decimal digits of integer
+ */
+size_t NumberFormatter::DigitCount(uint64_t value)
+{
+    size_t count = 1;
+    while (count < sizeof(POWERS_OF_TEN) / sizeof(POWERS_OF_TEN[0]) && value >= POWERS_OF_TEN[count])
+        ++count;
+
+    return count;
+}
+
+/**
+ * @brief Write exactly count digits of integer ending at end, leading positions are filled by zeros
+ */
+void NumberFormatter::WriteDigits(uint64_t value, char *end, size_t count)
+{
+    for (; count >= 2; count -= 2)
+    {
+        const auto pair = DIGIT_PAIRS + (value % 100) * 2;
+        *--end = pair[1];
+        *--end = pair[0];
+        value /= 100;
+    }
+
+    if (count)
+        *--end = static_cast<char>('0' + value % 10);
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Write decimal representation of unsigned integer
+ */
+size_t NumberFormatter::Unsigned(uint64_t value, Utility::DataType::Span<char> buffer)
+{
+    const auto length = DigitCount(value);
+    if (length > buffer.size())
+        return 0;
+
+    WriteDigits(value, buffer.data() + length, length);
+    if (length < buffer.size())
+        buffer[length] = '\0';
+
+    return length;
+}
+
+/**
+ * @brief Write decimal representation of signed integer
+ */
+size_t NumberFormatter::Integer(int64_t value, Utility::DataType::Span<char> buffer)
+{
+    if (value >= 0)
+        return Unsigned(static_cast<uint64_t>(value), buffer);
+
+    if (buffer.size() < 2)
+        return 0;
+
+    // Magnitude of the most negative value does not fit into int64_t
+    const auto length = Unsigned(static_cast<uint64_t>(-(value + 1)) + 1, buffer.Subspan(1));
+    if (!length)
+        return 0;
+
+    buffer[0] = '-';
+    return length + 1;
+}
+
+/**
+ * @brief Write number with fixed number of decimal places
+ */
+size_t NumberFormatter::Fixed(double value, uint8_t precision, Utility::DataType::Span<char> buffer, bool trimZeros)
+{
+    if (!std::isfinite(value))
+        return 0;
+
+    if (precision > NUMBER_FORMATTER_MAX_PRECISION)
+        precision = NUMBER_FORMATTER_MAX_PRECISION;
+
+    const double magnitude = std::fabs(value);
+    if (magnitude >= NUMBER_FORMATTER_INTEGRAL_LIMIT)
+        return 0;
+
+    // Both parts are exact, fraction is split off before scaling so scaled value stays small
+    const double integral = std::floor(magnitude);
+    const double fraction = magnitude - integral;
+    auto whole = static_cast<uint64_t>(integral);
+
+    const uint64_t scale = POWERS_OF_TEN[precision];
+    const double product = fraction * static_cast<double>(scale);
+    // Rounding error of product, so rounding is decided by exact value like printf does
+    const double error = std::fma(fraction, static_cast<double>(scale), -product);
+
+    const double truncated = std::floor(product);
+    auto digits = static_cast<uint64_t>(truncated);
+
+    // Distance from half is exact, error decides only when product lies exactly on half
+    const double distance = (product - truncated) - 0.5;
+    const double rounding = distance != 0.0 ? distance : error;
+    const uint64_t last = precision ? digits : whole;
+
+    if (rounding > 0.0 || (rounding == 0.0 && (last & 1)))
+    {
+        if (++digits == scale)
+        {
+            digits = 0;
+            ++whole;
+        }
+    }
+
+    if (trimZeros)
+    {
+        while (precision && !(digits % 10))
+        {
+            digits /= 10;
+            --precision;
+        }
+    }
+
+    // Negative value rounded to zero keeps its sign like printf
+    const bool sign = std::signbit(value);
+    const auto integralLength = DigitCount(whole);
+    const size_t length = sign + integralLength + (precision ? precision + 1 : 0);
+    if (length > buffer.size())
+        return 0;
+
+    auto output = buffer.data();
+    if (sign)
+        *output++ = '-';
+
+    WriteDigits(whole, output + integralLength, integralLength);
+    output += integralLength;
+
+    if (precision)
+    {
+        *output++ = '.';
+        WriteDigits(digits, output + precision, precision);
+        output += precision;
+    }
+
+    if (length < buffer.size())
+        *output = '\0';
+
+    return length;
+}
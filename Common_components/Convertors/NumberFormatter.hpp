@@ -0,0 +1,88 @@
+/**
+ * Heap free number formatting
+ *
+ * Numbers are written into caller provided buffers, two digits per division. Fixed-point output of
+ * floating point values is rounded from exact binary value like printf("%.*f"), ties are rounded to
+ * even digit, and negative value rounded to zero is written with sign.
+ *
+ * @author Dominik Regec
+ */
+#ifndef NUMBER_FORMATTER_H
+#define NUMBER_FORMATTER_H
+
+/* STD library includes */
+#include <cstddef>
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Utility/DataType/Span.hpp"
+
+// Maximum number of decimal places of fixed-point output
+#define NUMBER_FORMATTER_MAX_PRECISION 9
+
+// Buffer size which fits any formatted number including terminating null
+#define NUMBER_FORMATTER_BUFFER_SIZE 32
+
+namespace Component
+{
+    namespace Convertor
+    {
+        class NumberFormatter
+        {
+        public:
+            /**
+             * @brief Write decimal representation of unsigned integer
+             *
+             * @param[in] value     : Integer
+             * @param[out] buffer   : Output buffer, output is null terminated when there is space left
+             *
+             * @return size_t       : Number of written characters, zero when output does not fit
+             */
+            static size_t Unsigned(uint64_t value, Utility::DataType::Span<char> buffer);
+
+            /**
+             * @brief Write decimal representation of signed integer
+             *
+             * @param[in] value     : Integer
+             * @param[out] buffer   : Output buffer, output is null terminated when there is space left
+             *
+             * @return size_t       : Number of written characters, zero when output does not fit
+             */
+            static size_t Integer(int64_t value, Utility::DataType::Span<char> buffer);
+
+            /**
+             * @brief Write number with fixed number of decimal places
+             *
+             * @param[in] value     : Number
+             * @param[in] precision : Number of decimal places, limited by NUMBER_FORMATTER_MAX_PRECISION
+             * @param[out] buffer   : Output buffer, output is null terminated when there is space left
+             * @param[in] trimZeros : Remove trailing zeros of fraction and decimal point without fraction
+             *
+             * @return size_t       : Number of written characters, zero when value is not finite,
+             *                        its integral part does not fit into 64 bits or output does not fit
+             */
+            static size_t Fixed(double value, uint8_t precision, Utility::DataType::Span<char> buffer, bool trimZeros = false);
+
+            /**
+             * @brief Write number with fixed number of decimal places
+             */
+            static size_t Fixed(float value, uint8_t precision, Utility::DataType::Span<char> buffer, bool trimZeros = false)
+            {
+                return Fixed(static_cast<double>(value), precision, buffer, trimZeros);
+            }
+
+        private:
+            /**
+             * @brief Get number of decimal digits of integer
+             */
+            static size_t DigitCount(uint64_t value);
+
+            /**
+             * @brief Write exactly count digits of integer ending at end, leading positions are filled by zeros
+             */
+            static void WriteDigits(uint64_t value, char *end, size_t count);
+        };
+    } // namespace Convertor
+} // namespace Component
+
+#endif // NUMBER_FORMATTER_H
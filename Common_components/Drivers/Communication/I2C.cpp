@@ -3,6 +3,12 @@
 /* C library */
 #include <cstring>
 
+/* STD library */
+#include <array>
+
+/* Common components */
+#include "Common_components/Convertors/DataType/BytePacking.hpp"
+
 /* ESP log library */
 #include <esp_log.h>
 
@@ -120,39 +126,32 @@ I2C_Result I2C::Write(const uint8_t slaveAddress, const uint8_t byte) const
  */
 I2C_Result I2C::Write(const uint8_t slaveAddress, uint32_t bytes, const uint8_t count) const
 {
-    if (!(count >= 1 && count <= 4))
-        return I2C_Result::INVALID_ARGUMENT;
-
-    std::vector<uint8_t> data;
-    data.reserve(count);
+    std::array<uint8_t, sizeof(bytes)> data;
 
-    bytes <<= (4 - count) * 8;
+    // Count out of range <1, 4> is rejected
+    const auto length = Component::Convertor::Store(bytes, Utility::DataType::Span<uint8_t>(data), count);
+    if (!length)
+        return I2C_Result::INVALID_ARGUMENT;
 
-    for (uint8_t i = 0; i < count; ++i)
-    {
-        data.emplace_back((bytes & 0xFF000000) >> 24);
-        bytes <<= 8;
-    }
+    if (!i2c_master_write_to_device(m_I2C_port, slaveAddress, data.data(), length, TIMEOUT_I2C_MS / portTICK_RATE_MS))
+        return I2C_Result::WRITE_DATA_SUCCESSFUL;
 
-    return Write(slaveAddress, data);
+    ESP_LOGE(I2C_TAG, "Unable to send data to slave with address 0x%x", slaveAddress);
+    return I2C_Result::I2C_ERROR;
 }
 
 /**
  * @brief Write data
  */
-I2C_Result I2C::Write(const uint8_t slaveAddress, std::vector<uint8_t> &data) const
+I2C_Result I2C::Write(const uint8_t slaveAddress, Utility::DataType::ByteView data)
 {
-    uint8_t *array_bytes = new uint8_t[data.size()];
-
-    std::copy(data.begin(), data.end(), array_bytes);
-
-    uint8_t status = i2c_master_write_to_device(m_I2C_port, slaveAddress, array_bytes, data.size(), TIMEOUT_I2C_MS / portTICK_RATE_MS);
-
-    delete[] array_bytes;
+    if (data.empty())
+        return I2C_Result::INVALID_ARGUMENT;
 
-    if (!status)
+    if (!i2c_master_write_to_device(m_I2C_port, slaveAddress, data.data(), data.size(), TIMEOUT_I2C_MS / portTICK_RATE_MS))
         return I2C_Result::WRITE_DATA_SUCCESSFUL;
 
+    ESP_LOGE(I2C_TAG, "Unable to send data to slave with address 0x%x", slaveAddress);
     return I2C_Result::I2C_ERROR;
 }
 
@@ -170,20 +169,76 @@ I2C_Result I2C::Read(const uint8_t slaveAddress, uint8_t *byte)
 /**
  * @brief Read data
  */
-I2C_Result I2C::Read(const uint8_t slaveAddress, std::vector<uint8_t> &data, uint8_t bytesToRead)
+I2C_Result I2C::Read(const uint8_t slaveAddress, Utility::DataType::Span<uint8_t> data)
 {
-    if (!bytesToRead)
+    if (data.empty())
         return I2C_Result::INVALID_ARGUMENT;
 
-    uint8_t *array_data = new uint8_t[bytesToRead];
+    if (!i2c_master_read_from_device(m_I2C_port, slaveAddress, data.data(), data.size(), TIMEOUT_I2C_MS / portTICK_RATE_MS))
+        return I2C_Result::READ_DATA_SUCCESSFUL;
 
-    int status = i2c_master_read_from_device(m_I2C_port, slaveAddress, array_data, bytesToRead, TIMEOUT_I2C_MS / portTICK_RATE_MS);
+    ESP_LOGE(I2C_TAG, "Unable to read data from slave with address 0x%x", slaveAddress);
+    return I2C_Result::I2C_ERROR;
+}
 
-    data.insert(data.begin(), array_data, array_data + bytesToRead);
-    delete[] array_data;
+/**
+ * @brief Write data and read response in one transaction with repeated start
+ */
+I2C_Result I2C::WriteRead(const uint8_t slaveAddress, Utility::DataType::ByteView write,
+                          Utility::DataType::Span<uint8_t> read)
+{
+    if (write.empty() || read.empty())
+        return I2C_Result::INVALID_ARGUMENT;
 
-    if (!status)
-        return I2C_Result::READ_DATA_SUCCESSFUL;
+    if (!i2c_master_write_read_device(m_I2C_port, slaveAddress, write.data(), write.size(), read.data(), read.size(),
+                                      TIMEOUT_I2C_MS / portTICK_RATE_MS))
+        return I2C_Result::I2C_OK;
 
+    ESP_LOGE(I2C_TAG, "Unable to write and read data of slave with address 0x%x", slaveAddress);
     return I2C_Result::I2C_ERROR;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Run transactions back to back
+ */
+I2C_Result I2C::Execute(Utility::DataType::Span<const I2C_Transaction> transactions, size_t &completed)
+{
+    completed = 0;
+    for (const auto &transaction : transactions)
+    {
+        if (transaction.write.empty() && transaction.read.empty())
+            return I2C_Result::INVALID_ARGUMENT;
+
+        // Response is available immediately, so bus is not released between write and read
+        if (!transaction.write.empty() && !transaction.read.empty() && !transaction.delay)
+        {
+            const auto result = WriteRead(transaction.address, transaction.write, transaction.read);
+            if (result != I2C_Result::I2C_OK)
+                return result;
+
+            ++completed;
+            continue;
+        }
+
+        if (!transaction.write.empty())
+        {
+            const auto result = Write(transaction.address, transaction.write);
+            if (result != I2C_Result::WRITE_DATA_SUCCESSFUL)
+                return result;
+
+            if (transaction.delay)
+                vTaskDelay(transaction.delay);
+        }
+
+        if (!transaction.read.empty())
+        {
+            const auto result = Read(transaction.address, transaction.read);
+            if (result != I2C_Result::READ_DATA_SUCCESSFUL)
+                return result;
+        }
+
+        ++completed;
+    }
+
+    return I2C_Result::I2C_OK;
+}
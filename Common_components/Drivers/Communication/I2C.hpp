@@ -6,7 +6,9 @@
 
 /* STD library */
 #include <stdint.h>
-#include <vector>
+
+/* Interface */
+#include "I2C_BusInterface.hpp"
 
 #define I2C_TAG "I2C driver"
 
@@ -15,41 +17,13 @@
 //
 #define NUMBER_OF_READ_BYTES_DEFAULT 10
 
-#define I2C_RESULT_TO_STRING(resultValue) Component::Driver::Communication::EnumToString(resultValue)
-
 namespace Component
 {
     namespace Driver
     {
         namespace Communication
         {
-            enum class I2C_Result
-            {
-                I2C_ERROR,
-                I2C_OK,
-                WRITE_DATA_SUCCESSFUL,
-                READ_DATA_SUCCESSFUL,
-                INVALID_ARGUMENT,
-            };
-
-            static const char *EnumToString(I2C_Result value)
-            {
-                switch (value)
-                {
-                case (I2C_Result::I2C_ERROR):
-                    return "I2C_Error";
-                case (I2C_Result::WRITE_DATA_SUCCESSFUL):
-                    return "I2C_Write_Data_Successful";
-                case (I2C_Result::READ_DATA_SUCCESSFUL):
-                    return "I2C_Read_Data_Successful";
-                case (I2C_Result::INVALID_ARGUMENT):
-                    return "I2C_Invalid_Argument";
-                default:
-                    return "Unimplemented value";
-                }
-            }
-
-            class I2C
+            class I2C : public I2C_BusInterface
             {
             public:
                 /**
@@ -63,7 +37,7 @@ namespace Component
                 /**
                  * @brief Class destructor
                  */
-                ~I2C();
+                ~I2C() override;
 
                 /**
                  * Set master mode
@@ -130,7 +104,7 @@ namespace Component
                  *
                  * @return I2C_Result       : WRITE_DATA_SUCCESSFUL - When all data was sent sussessfull
                  */
-                I2C_Result Write(const uint8_t slaveAddress, std::vector<uint8_t> &data) const;
+                I2C_Result Write(const uint8_t slaveAddress, Utility::DataType::ByteView data) override;
 
                 /**
                  * @brief Read data
@@ -146,12 +120,33 @@ namespace Component
                  * @brief Read data
                  *
                  * @param[in] slaveAddress  : Slave address
-                 * @param[out] data         : Received data
-                 * @param[in] bytesToRead   : Bytes to read
+                 * @param[out] data         : Buffer filled by received data
                  *
                  * @return I2C_Result       : READ_DATA_SUCCESSFUL - When all data was received sussessfull
                  */
-                I2C_Result Read(const uint8_t slaveAddress, std::vector<uint8_t> &data, uint8_t bytesToRead);
+                I2C_Result Read(const uint8_t slaveAddress, Utility::DataType::Span<uint8_t> data) override;
+
+                /**
+                 * @brief Write data and read response in one transaction with repeated start
+                 *
+                 * @param[in] slaveAddress  : Slave address
+                 * @param[in] write         : Data to send
+                 * @param[out] read         : Buffer filled by received data
+                 *
+                 * @return I2C_Result       : I2C_OK - When whole transaction was successful
+                 */
+                I2C_Result WriteRead(const uint8_t slaveAddress, Utility::DataType::ByteView write,
+                                     Utility::DataType::Span<uint8_t> read) override;
+
+                /**
+                 * @brief Run transactions back to back. Stops at the first failed transaction
+                 *
+                 * @param[in] transactions  : Transactions
+                 * @param[out] completed    : Number of successful transactions
+                 *
+                 * @return I2C_Result       : I2C_OK - When all transactions were successful
+                 */
+                I2C_Result Execute(Utility::DataType::Span<const I2C_Transaction> transactions, size_t &completed) override;
 
             private:
                 // Config file of I2C communication interface
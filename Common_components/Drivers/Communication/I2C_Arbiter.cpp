@@ -0,0 +1,386 @@
+/* Project specific includes */
+#include "I2C_Arbiter.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
+
+using namespace Component::Driver::Communication;
+
+/**
+ * @brief Check if tick a is before tick b, overflow of tick count is handled
+ */
+static bool IsBefore(TickType_t a, TickType_t b)
+{
+    return static_cast<int32_t>(a - b) < 0;
+}
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Arbiter task body
+ */
+void I2C_Arbiter::ArbiterTask(void *arg)
+{
+    auto arbiter = static_cast<I2C_Arbiter *>(arg);
+
+    while (true)
+    {
+        // Sleep until new request arrives or scheduled phase is due
+        arbiter->Collect(arbiter->TimeToNextDue(xTaskGetTickCount()));
+
+        const TickType_t now = xTaskGetTickCount();
+        const auto index = arbiter->Select(now);
+        if (index == I2C_ARBITER_MAX_PENDING)
+            continue;
+
+        auto &request = *arbiter->mSchedule[index];
+        if (IsBefore(request.deadline, now))
+            ++arbiter->mMissedDeadlines;
+
+        if (arbiter->Step(request, now))
+            arbiter->Finish(index, request.result);
+    }
+}
+
+/**
+ * @brief Move submitted requests from queue to schedule
+ */
+void I2C_Arbiter::Collect(TickType_t wait)
+{
+    I2C_Request *request{nullptr};
+    while (mScheduled < mSchedule.size() && xQueueReceive(mQueue, &request, wait) == pdTRUE)
+    {
+        mSchedule[mScheduled++] = request;
+
+        // Only the first request is waited for
+        wait = 0;
+    }
+
+    // Remaining requests stay in queue until schedule has space
+    if (mScheduled == mSchedule.size() && wait)
+        vTaskDelay(wait);
+}
+
+/**
+ * @brief Select due request with the earliest deadline
+ */
+size_t I2C_Arbiter::Select(TickType_t now) const
+{
+    size_t selected = I2C_ARBITER_MAX_PENDING;
+
+    for (size_t i = 0; i < mScheduled; ++i)
+    {
+        const auto &request = *mSchedule[i];
+        if (IsBefore(now, request.due))
+            continue;
+
+        if (selected == I2C_ARBITER_MAX_PENDING)
+        {
+            selected = i;
+            continue;
+        }
+
+        const auto &best = *mSchedule[selected];
+        if (IsBefore(request.deadline, best.deadline) ||
+            (request.deadline == best.deadline && request.priority > best.priority))
+            selected = i;
+    }
+
+    return selected;
+}
+
+/**
+ * @brief Get ticks until the first scheduled request is due
+ */
+TickType_t I2C_Arbiter::TimeToNextDue(TickType_t now) const
+{
+    TickType_t wait = portMAX_DELAY;
+
+    for (size_t i = 0; i < mScheduled; ++i)
+    {
+        const auto due = mSchedule[i]->due;
+        if (!IsBefore(now, due))
+            return 0;
+
+        if (due - now < wait)
+            wait = due - now;
+    }
+
+    return wait;
+}
+
+/**
+ * @brief Run next phase of request on bus
+ */
+bool I2C_Arbiter::Step(I2C_Request &request, TickType_t now)
+{
+    // Delay after write of the last transaction elapsed
+    if (request.index == request.transactions.size())
+    {
+        request.result = I2C_Result::I2C_OK;
+        return true;
+    }
+
+    const auto &transaction = request.transactions[request.index];
+
+    if (request.readPending)
+    {
+        request.result = mBus->Read(transaction.address, transaction.read);
+        if (request.result != I2C_Result::READ_DATA_SUCCESSFUL)
+            return true;
+
+        request.readPending = false;
+    }
+    else if (transaction.write.empty() && transaction.read.empty())
+    {
+        request.result = I2C_Result::INVALID_ARGUMENT;
+        return true;
+    }
+    else if (transaction.write.empty())
+    {
+        request.result = mBus->Read(transaction.address, transaction.read);
+        if (request.result != I2C_Result::READ_DATA_SUCCESSFUL)
+            return true;
+    }
+    else if (!transaction.read.empty() && !transaction.delay)
+    {
+        request.result = mBus->WriteRead(transaction.address, transaction.write, transaction.read);
+        if (request.result != I2C_Result::I2C_OK)
+            return true;
+    }
+    else
+    {
+        request.result = mBus->Write(transaction.address, transaction.write);
+        if (request.result != I2C_Result::WRITE_DATA_SUCCESSFUL)
+            return true;
+
+        if (transaction.delay)
+        {
+            // Device executes command on its own, bus serves other requests meanwhile. Read keeps latency
+            // of request, so it does not preempt requests whose deadlines are earlier
+            request.due = xTaskGetTickCount() + transaction.delay;
+            request.deadline = request.due + request.latency;
+            ++mDeferred;
+
+            if (!transaction.read.empty())
+            {
+                request.readPending = true;
+                return false;
+            }
+
+            ++request.completed;
+            ++request.index;
+            return false;
+        }
+    }
+
+    ++request.completed;
+    ++request.index;
+
+    if (request.index == request.transactions.size())
+    {
+        request.result = I2C_Result::I2C_OK;
+        return true;
+    }
+
+    // Next transaction follows without delay
+    request.due = now;
+    return false;
+}
+
+/**
+ * @brief Remove request from schedule and wake its client
+ */
+void I2C_Arbiter::Finish(size_t index, I2C_Result result)
+{
+    auto request = mSchedule[index];
+    mSchedule[index] = mSchedule[--mScheduled];
+
+    ++mRequests;
+    if (result != I2C_Result::I2C_OK)
+    {
+        ++mFailures;
+        ESP_LOGE(I2C_ARBITER_TAG, "Request failed in transaction %d: %s", static_cast<int>(request->index),
+                 I2C_RESULT_TO_STRING(result));
+    }
+
+    // Request belongs to client again once semaphore is given
+    xSemaphoreGive(request->done);
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+I2C_Arbiter::I2C_Arbiter(I2C_BusInterface *bus, uint32_t stackSize, UBaseType_t priority)
+    : mBus(bus),
+      mStackSize(stackSize),
+      mPriority(priority),
+      mQueue(nullptr),
+      mTask(nullptr),
+      mSchedule{},
+      mScheduled(0),
+      mRequests(0),
+      mFailures(0),
+      mDeferred(0),
+      mMissedDeadlines(0)
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+I2C_Arbiter::~I2C_Arbiter()
+{
+    if (mTask)
+        vTaskDelete(mTask);
+
+    if (mQueue)
+        vQueueDelete(mQueue);
+}
+
+/**
+ * @brief Create queue and arbiter task
+ */
+bool I2C_Arbiter::Start()
+{
+    if (mTask)
+        return true;
+
+    mQueue = xQueueCreate(I2C_ARBITER_MAX_PENDING, sizeof(I2C_Request *));
+    if (!mQueue)
+    {
+        ESP_LOGE(I2C_ARBITER_TAG, "Unable to create request queue");
+        return false;
+    }
+
+    if (xTaskCreate(&I2C_Arbiter::ArbiterTask, "I2C_Arbiter", mStackSize, this, mPriority, &mTask) != pdPASS)
+    {
+        ESP_LOGE(I2C_ARBITER_TAG, "Unable to create arbiter task");
+        mTask = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Submit request and wait until it is finished
+ */
+I2C_Result I2C_Arbiter::Submit(I2C_Request &request)
+{
+    if (!mTask)
+    {
+        ESP_LOGE(I2C_ARBITER_TAG, "Arbiter is not running");
+        return I2C_Result::I2C_ERROR;
+    }
+
+    I2C_Request *pointer = &request;
+    if (xQueueSend(mQueue, &pointer, portMAX_DELAY) != pdTRUE)
+        return I2C_Result::I2C_ERROR;
+
+    xSemaphoreTake(request.done, portMAX_DELAY);
+    return request.result;
+}
+
+/**
+ * @brief Get counters of arbiter
+ */
+I2C_ArbiterStatistics I2C_Arbiter::GetStatistics() const
+{
+    return {mRequests, mFailures, mDeferred, mMissedDeadlines};
+}
+
+/**
+ * @brief Class constructor
+ */
+I2C_ArbiterClient::I2C_ArbiterClient(I2C_Arbiter *arbiter, uint8_t priority, TickType_t latency)
+    : mArbiter(arbiter),
+      mPriority(priority),
+      mLatency(latency),
+      mMutex(xSemaphoreCreateMutex()),
+      mDone(xSemaphoreCreateBinary())
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+I2C_ArbiterClient::~I2C_ArbiterClient()
+{
+    if (mMutex)
+        vSemaphoreDelete(mMutex);
+
+    if (mDone)
+        vSemaphoreDelete(mDone);
+}
+
+/**
+ * @brief Write data
+ */
+I2C_Result I2C_ArbiterClient::Write(const uint8_t slaveAddress, Utility::DataType::ByteView data)
+{
+    const I2C_Transaction transaction = {slaveAddress, data, Utility::DataType::Span<uint8_t>(), 0};
+
+    size_t completed{0};
+    const auto result = Execute(Utility::DataType::Span<const I2C_Transaction>(&transaction, 1), completed);
+
+    return result == I2C_Result::I2C_OK ? I2C_Result::WRITE_DATA_SUCCESSFUL : result;
+}
+
+/**
+ * @brief Read data
+ */
+I2C_Result I2C_ArbiterClient::Read(const uint8_t slaveAddress, Utility::DataType::Span<uint8_t> data)
+{
+    const I2C_Transaction transaction = {slaveAddress, Utility::DataType::ByteView(), data, 0};
+
+    size_t completed{0};
+    const auto result = Execute(Utility::DataType::Span<const I2C_Transaction>(&transaction, 1), completed);
+
+    return result == I2C_Result::I2C_OK ? I2C_Result::READ_DATA_SUCCESSFUL : result;
+}
+
+/**
+ * @brief Write data and read response in one transaction with repeated start
+ */
+I2C_Result I2C_ArbiterClient::WriteRead(const uint8_t slaveAddress, Utility::DataType::ByteView write,
+                                        Utility::DataType::Span<uint8_t> read)
+{
+    if (write.empty() || read.empty())
+        return I2C_Result::INVALID_ARGUMENT;
+
+    const I2C_Transaction transaction = {slaveAddress, write, read, 0};
+
+    size_t completed{0};
+    return Execute(Utility::DataType::Span<const I2C_Transaction>(&transaction, 1), completed);
+}
+
+/**
+ * @brief Run transactions back to back
+ */
+I2C_Result I2C_ArbiterClient::Execute(Utility::DataType::Span<const I2C_Transaction> transactions, size_t &completed)
+{
+    completed = 0;
+    if (transactions.empty())
+        return I2C_Result::INVALID_ARGUMENT;
+
+    if (!mMutex || !mDone)
+        return I2C_Result::I2C_ERROR;
+
+    xSemaphoreTake(mMutex, portMAX_DELAY);
+
+    const TickType_t now = xTaskGetTickCount();
+    I2C_Request request = {transactions, 0, false, now, now + mLatency, mLatency, mPriority, 0, I2C_Result::I2C_ERROR, mDone};
+
+    const auto result = mArbiter->Submit(request);
+    completed = request.completed;
+
+    xSemaphoreGive(mMutex);
+    return result;
+}
@@ -0,0 +1,252 @@
+#ifndef I2C_ARBITER_H
+#define I2C_ARBITER_H
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/* STD library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/* Interface */
+#include "I2C_BusInterface.hpp"
+
+#define I2C_ARBITER_TAG "I2C arbiter"
+
+// Maximum number of requests scheduled at once, one per client is enough
+#define I2C_ARBITER_MAX_PENDING 8
+
+// Default time from submission in which request should be executed
+#define I2C_ARBITER_DEFAULT_LATENCY 100
+
+namespace Component
+{
+    namespace Driver
+    {
+        namespace Communication
+        {
+            /* Counters of bus arbiter */
+            struct I2C_ArbiterStatistics
+            {
+                // Finished requests
+                uint32_t requests;
+                // Requests finished with error
+                uint32_t failures;
+                // Phases deferred by command delay while bus served other requests
+                uint32_t deferred;
+                // Requests executed after their deadline
+                uint32_t missedDeadlines;
+            };
+
+            /* Request of one client waiting for arbiter */
+            struct I2C_Request
+            {
+                // Transactions of request, owned by client
+                Utility::DataType::Span<const I2C_Transaction> transactions;
+                // Index of current transaction
+                size_t index;
+                // Write of current transaction is done and its read waits for delay
+                bool readPending;
+                // Tick from which next phase can run
+                TickType_t due;
+                // Tick by which next phase should run
+                TickType_t deadline;
+                // Ticks from due to deadline of every phase
+                TickType_t latency;
+                // Priority of client, higher wins between equal deadlines
+                uint8_t priority;
+                // Number of finished transactions
+                size_t completed;
+                // Result of request
+                I2C_Result result;
+                // Semaphore given when request is finished
+                SemaphoreHandle_t done;
+            };
+
+            /**
+             * @brief Owner of I2C port. Requests of any task are queued and executed by arbiter task, earliest deadline first.
+             *        Delay between write and read of transaction does not hold bus, other requests run meanwhile
+             */
+            class I2C_Arbiter
+            {
+            public:
+                /**
+                 * @brief Class constructor
+                 *
+                 * @param[in] bus       : Bus driver, used only by arbiter task
+                 * @param[in] stackSize : Stack size of arbiter task
+                 * @param[in] priority  : Priority of arbiter task
+                 */
+                explicit I2C_Arbiter(I2C_BusInterface *bus, uint32_t stackSize = 3072,
+                                     UBaseType_t priority = tskIDLE_PRIORITY + 2) __attribute__((nonnull));
+
+                /**
+                 * @brief Class destructor
+                 */
+                ~I2C_Arbiter();
+
+                I2C_Arbiter(const I2C_Arbiter &) = delete;
+                I2C_Arbiter &operator=(const I2C_Arbiter &) = delete;
+
+                /**
+                 * @brief Create queue and arbiter task
+                 *
+                 * @return bool     true    : Arbiter is running
+                 *                  false   : Otherwise
+                 */
+                bool Start();
+
+                /**
+                 * @brief Submit request and wait until it is finished
+                 *
+                 * @param[in/out] request   : Request, must stay valid until it is finished
+                 *
+                 * @return I2C_Result       : Result of request
+                 */
+                I2C_Result Submit(I2C_Request &request);
+
+                /**
+                 * @brief Get counters of arbiter
+                 *
+                 * @return I2C_ArbiterStatistics
+                 */
+                I2C_ArbiterStatistics GetStatistics() const;
+
+            private:
+                /**
+                 * @brief Arbiter task body
+                 *
+                 * @param[in] arg   : Pointer to arbiter
+                 */
+                static void ArbiterTask(void *arg);
+
+                /**
+                 * @brief Move submitted requests from queue to schedule
+                 *
+                 * @param[in] wait  : Ticks to wait for the first request
+                 */
+                void Collect(TickType_t wait);
+
+                /**
+                 * @brief Select due request with the earliest deadline
+                 *
+                 * @param[in] now   : Current tick count
+                 *
+                 * @return size_t   : Index in schedule, I2C_ARBITER_MAX_PENDING when no request is due
+                 */
+                size_t Select(TickType_t now) const;
+
+                /**
+                 * @brief Get ticks until the first scheduled request is due
+                 *
+                 * @param[in] now       : Current tick count
+                 *
+                 * @return TickType_t   : portMAX_DELAY when nothing is scheduled
+                 */
+                TickType_t TimeToNextDue(TickType_t now) const;
+
+                /**
+                 * @brief Run next phase of request on bus
+                 *
+                 * @param[in/out] request   : Request
+                 * @param[in] now           : Current tick count
+                 *
+                 * @return bool             : True when request is finished
+                 */
+                bool Step(I2C_Request &request, TickType_t now);
+
+                /**
+                 * @brief Remove request from schedule and wake its client
+                 *
+                 * @param[in] index     : Index in schedule
+                 * @param[in] result    : Result of request
+                 */
+                void Finish(size_t index, I2C_Result result);
+
+                /* Bus driver */
+                I2C_BusInterface *mBus;
+
+                /* Arbiter stack size */
+                const uint32_t mStackSize;
+
+                /* Arbiter priority */
+                const UBaseType_t mPriority;
+
+                /* Queue of submitted request pointers */
+                QueueHandle_t mQueue;
+
+                /* Arbiter task handle */
+                TaskHandle_t mTask;
+
+                /* Scheduled requests, accessed only by arbiter task */
+                std::array<I2C_Request *, I2C_ARBITER_MAX_PENDING> mSchedule;
+
+                /* Number of scheduled requests */
+                size_t mScheduled;
+
+                /* Counters */
+                std::atomic<uint32_t> mRequests;
+                std::atomic<uint32_t> mFailures;
+                std::atomic<uint32_t> mDeferred;
+                std::atomic<uint32_t> mMissedDeadlines;
+            };
+
+            /**
+             * @brief Bus of one device behind arbiter. Calls block only calling task, while it waits other devices use bus
+             */
+            class I2C_ArbiterClient : public I2C_BusInterface
+            {
+            public:
+                /**
+                 * @brief Class constructor
+                 *
+                 * @param[in] arbiter   : Arbiter of bus
+                 * @param[in] priority  : Priority of requests, higher wins between equal deadlines
+                 * @param[in] latency   : Ticks from submission in which request should be executed
+                 */
+                explicit I2C_ArbiterClient(I2C_Arbiter *arbiter, uint8_t priority = 0,
+                                           TickType_t latency = I2C_ARBITER_DEFAULT_LATENCY) __attribute__((nonnull));
+
+                /**
+                 * @brief Class destructor
+                 */
+                ~I2C_ArbiterClient() override;
+
+                I2C_ArbiterClient(const I2C_ArbiterClient &) = delete;
+                I2C_ArbiterClient &operator=(const I2C_ArbiterClient &) = delete;
+
+                I2C_Result Write(const uint8_t slaveAddress, Utility::DataType::ByteView data) override;
+
+                I2C_Result Read(const uint8_t slaveAddress, Utility::DataType::Span<uint8_t> data) override;
+
+                I2C_Result WriteRead(const uint8_t slaveAddress, Utility::DataType::ByteView write,
+                                     Utility::DataType::Span<uint8_t> read) override;
+
+                I2C_Result Execute(Utility::DataType::Span<const I2C_Transaction> transactions, size_t &completed) override;
+
+            private:
+                /* Arbiter of bus */
+                I2C_Arbiter *mArbiter;
+
+                /* Priority of requests */
+                const uint8_t mPriority;
+
+                /* Ticks in which request should be executed */
+                const TickType_t mLatency;
+
+                /* Serializes requests of tasks which share client */
+                SemaphoreHandle_t mMutex;
+
+                /* Given by arbiter when request is finished */
+                SemaphoreHandle_t mDone;
+            };
+        } // namespace Communication
+    } // namespace Driver
+} // namespace Component
+
+#endif // I2C_ARBITER_H
@@ -0,0 +1,118 @@
+#ifndef I2C_BUS_INTERFACE_H
+#define I2C_BUS_INTERFACE_H
+
+/* STD library */
+#include <cstddef>
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Utility/DataType/Span.hpp"
+
+#define I2C_RESULT_TO_STRING(resultValue) Component::Driver::Communication::EnumToString(resultValue)
+
+namespace Component
+{
+    namespace Driver
+    {
+        namespace Communication
+        {
+            enum class I2C_Result
+            {
+                I2C_ERROR,
+                I2C_OK,
+                WRITE_DATA_SUCCESSFUL,
+                READ_DATA_SUCCESSFUL,
+                INVALID_ARGUMENT,
+                CHECKSUM_ERROR,
+            };
+
+            inline const char *EnumToString(I2C_Result value)
+            {
+                switch (value)
+                {
+                case (I2C_Result::I2C_ERROR):
+                    return "I2C_Error";
+                case (I2C_Result::WRITE_DATA_SUCCESSFUL):
+                    return "I2C_Write_Data_Successful";
+                case (I2C_Result::READ_DATA_SUCCESSFUL):
+                    return "I2C_Read_Data_Successful";
+                case (I2C_Result::INVALID_ARGUMENT):
+                    return "I2C_Invalid_Argument";
+                case (I2C_Result::CHECKSUM_ERROR):
+                    return "I2C_Checksum_Error";
+                default:
+                    return "Unimplemented value";
+                }
+            }
+
+            /* One transfer with slave. Buffers are owned by caller and must live until transfer finishes */
+            struct I2C_Transaction
+            {
+                // Slave address
+                uint8_t address;
+                // Bytes written to slave, may be empty
+                Utility::DataType::ByteView write;
+                // Buffer filled by bytes read from slave, may be empty
+                Utility::DataType::Span<uint8_t> read;
+                // Ticks to wait after write. Zero between write and read means repeated start
+                uint32_t delay;
+            };
+
+            /**
+             * @brief Master side of I2C bus. Transfers use caller provided buffers and never allocate
+             */
+            class I2C_BusInterface
+            {
+            public:
+                /**
+                 * @brief Class destructor
+                 */
+                virtual ~I2C_BusInterface() = default;
+
+                /**
+                 * @brief Write data
+                 *
+                 * @param[in] slaveAddress  : Slave address
+                 * @param[in] data          : Data to send
+                 *
+                 * @return I2C_Result       : WRITE_DATA_SUCCESSFUL - When all data was sent sussessfull
+                 */
+                virtual I2C_Result Write(const uint8_t slaveAddress, Utility::DataType::ByteView data) = 0;
+
+                /**
+                 * @brief Read data
+                 *
+                 * @param[in] slaveAddress  : Slave address
+                 * @param[out] data         : Buffer filled by received data
+                 *
+                 * @return I2C_Result       : READ_DATA_SUCCESSFUL - When all data was received sussessfull
+                 */
+                virtual I2C_Result Read(const uint8_t slaveAddress, Utility::DataType::Span<uint8_t> data) = 0;
+
+                /**
+                 * @brief Write data and read response in one transaction with repeated start
+                 *
+                 * @param[in] slaveAddress  : Slave address
+                 * @param[in] write         : Data to send
+                 * @param[out] read         : Buffer filled by received data
+                 *
+                 * @return I2C_Result       : I2C_OK - When whole transaction was successful
+                 */
+                virtual I2C_Result WriteRead(const uint8_t slaveAddress, Utility::DataType::ByteView write,
+                                             Utility::DataType::Span<uint8_t> read) = 0;
+
+                /**
+                 * @brief Run transactions back to back. Stops at the first failed transaction
+                 *
+                 * @param[in] transactions  : Transactions
+                 * @param[out] completed    : Number of successful transactions
+                 *
+                 * @return I2C_Result       : I2C_OK - When all transactions were successful
+                 */
+                virtual I2C_Result Execute(Utility::DataType::Span<const I2C_Transaction> transactions, size_t &completed) = 0;
+            };
+        } // namespace Communication
+    } // namespace Driver
+} // namespace Component
+
+#endif // I2C_BUS_INTERFACE_H
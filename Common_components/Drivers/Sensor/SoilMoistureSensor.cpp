@@ -11,6 +11,13 @@
 /* ESP log library */
 #include <esp_log.h>
 
+/* NVS library */
+#include <nvs.h>
+
+/* STD library */
+#include <array>
+#include <cstdio>
+
 using namespace Component::Driver::Sensor;
 
 /**
@@ -19,7 +26,8 @@ using namespace Component::Driver::Sensor;
  * @note No tested for now DR: 13/02/2023 08:31
  */
 SoilMoistureSensor::SoilMoistureSensor(adc1_channel_t adc_channel, adc_atten_t attenuation)
-    : mADC_type(ADC_TYPE::ADC1), mADC1_channel(new adc1_channel_t(adc_channel)), mADC2_channel(nullptr)
+    : mADC_type(ADC_TYPE::ADC1), mADC1_channel(new adc1_channel_t(adc_channel)), mADC2_channel(nullptr),
+      mCalibration{SENSOR_MAX, SENSOR_MIN}, mFilter(SOIL_FILTER_ALPHA), mMoisture(0.0f)
 {
   esp_err_t r = adc1_pad_get_io_num(adc_channel, &mSensorPin);
 
@@ -34,7 +42,8 @@ SoilMoistureSensor::SoilMoistureSensor(adc1_channel_t adc_channel, adc_atten_t a
  * @brief Class constructor
  */
 SoilMoistureSensor::SoilMoistureSensor(adc2_channel_t adc_channel, adc_bits_width_t width, adc_atten_t attenuation)
-    : mADC_type(ADC_TYPE::ADC2), mADC1_channel(nullptr), mADC2_channel(new adc2_channel_t(adc_channel)), mWidth(width)
+    : mADC_type(ADC_TYPE::ADC2), mADC1_channel(nullptr), mADC2_channel(new adc2_channel_t(adc_channel)), mWidth(width),
+      mCalibration{SENSOR_MAX, SENSOR_MIN}, mFilter(SOIL_FILTER_ALPHA), mMoisture(0.0f)
 {
 
   esp_err_t r = adc2_pad_get_io_num(adc_channel, &mSensorPin);
@@ -66,19 +75,32 @@ SoilMoistureSensor::~SoilMoistureSensor()
 }
 
 /**
- * @brief Read data from sensor
+ * @brief Read burst of samples, filter it by median and IIR filter and update cached value
  */
-float SoilMoistureSensor::Measure() const
+float SoilMoistureSensor::Measure()
 {
-  float raw_data = MeasureRawData();
-  auto sensor_output = (((raw_data - SENSOR_MIN) / (SENSOR_MAX - SENSOR_MIN)) * 100);
+  uint16_t median{0};
+  if (!MeasureBurst(median))
+    return mMoisture;
 
-  if (sensor_output < OUTPUT_MIN)
-    return OUTPUT_MAX;
-  else if (sensor_output > OUTPUT_MAX)
-    return OUTPUT_MIN;
-  else
-    return 100 - sensor_output;
+  mMoisture = ToMoisture(mFilter.Update(median));
+  return mMoisture;
+}
+
+/**
+ * @brief Get cached filtered moisture without reading ADC
+ */
+float SoilMoistureSensor::Moisture() const
+{
+  return mMoisture;
+}
+
+/**
+ * @brief Get cached filtered raw value without reading ADC
+ */
+uint16_t SoilMoistureSensor::FilteredRawData() const
+{
+  return static_cast<uint16_t>(mFilter.Value() + 0.5f);
 }
 
 /**
@@ -89,7 +111,17 @@ uint16_t SoilMoistureSensor::MeasureRawData() const
   switch (mADC_type)
   {
   case ADC_TYPE::ADC1:
-    return adc1_get_raw(*mADC1_channel);
+  {
+    int raw_data = adc1_get_raw(*mADC1_channel);
+
+    if (raw_data < 0)
+    {
+      ESP_LOGE(SOIL_MOISTURE_SENSOR_TAG, "Reading error from ADC1 on GPIO %d", static_cast<int>(mSensorPin));
+      return 0;
+    }
+
+    return raw_data;
+  }
   case ADC_TYPE::ADC2:
   {
     int raw_data{0};
@@ -108,4 +140,164 @@ uint16_t SoilMoistureSensor::MeasureRawData() const
   }
 
   return 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Load calibration of probe from NVS
+ */
+bool SoilMoistureSensor::LoadCalibration()
+{
+  nvs_handle_t handle;
+  if (nvs_open(SOIL_CALIBRATION_NAMESPACE, NVS_READONLY, &handle) != ESP_OK)
+    return false;
+
+  char key[NVS_KEY_NAME_MAX_SIZE];
+  CalibrationKey(key, sizeof(key));
+
+  SoilCalibration calibration;
+  size_t length = sizeof(calibration);
+  esp_err_t result = nvs_get_blob(handle, key, &calibration, &length);
+  nvs_close(handle);
+
+  if (result != ESP_OK || length != sizeof(calibration) || !IsCalibrationValid(calibration))
+    return false;
+
+  mCalibration = calibration;
+  if (mFilter.IsPrimed())
+    mMoisture = ToMoisture(mFilter.Value());
+
+  ESP_LOGI(SOIL_MOISTURE_SENSOR_TAG, "Calibration of GPIO %d loaded, dry: %u, wet: %u", static_cast<int>(mSensorPin),
+           mCalibration.dry, mCalibration.wet);
+  return true;
+}
+
+/**
+ * @brief Store calibration of probe to NVS and use it
+ */
+bool SoilMoistureSensor::StoreCalibration(const SoilCalibration &calibration)
+{
+  if (!IsCalibrationValid(calibration))
+  {
+    ESP_LOGE(SOIL_MOISTURE_SENSOR_TAG, "Invalid calibration, dry: %u, wet: %u", calibration.dry, calibration.wet);
+    return false;
+  }
+
+  nvs_handle_t handle;
+  if (nvs_open(SOIL_CALIBRATION_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK)
+  {
+    ESP_LOGE(SOIL_MOISTURE_SENSOR_TAG, "Unable to open calibration storage");
+    return false;
+  }
+
+  char key[NVS_KEY_NAME_MAX_SIZE];
+  CalibrationKey(key, sizeof(key));
+
+  esp_err_t result = nvs_set_blob(handle, key, &calibration, sizeof(calibration));
+  if (result == ESP_OK)
+    result = nvs_commit(handle);
+  nvs_close(handle);
+
+  if (result != ESP_OK)
+  {
+    ESP_LOGE(SOIL_MOISTURE_SENSOR_TAG, "Unable to store calibration: %s", esp_err_to_name(result));
+    return false;
+  }
+
+  mCalibration = calibration;
+  if (mFilter.IsPrimed())
+    mMoisture = ToMoisture(mFilter.Value());
+
+  return true;
+}
+
+/**
+ * @brief Measure dry probe and store its value as 0 % point
+ */
+bool SoilMoistureSensor::CalibrateDry()
+{
+  uint16_t median{0};
+  if (!MeasureBurst(median))
+    return false;
+
+  return StoreCalibration({median, mCalibration.wet});
+}
+
+/**
+ * @brief Measure probe in water and store its value as 100 % point
+ */
+bool SoilMoistureSensor::CalibrateWet()
+{
+  uint16_t median{0};
+  if (!MeasureBurst(median))
+    return false;
+
+  return StoreCalibration({mCalibration.dry, median});
+}
+
+/**
+ * @brief Get calibration used by sensor
+ */
+SoilCalibration SoilMoistureSensor::GetCalibration() const
+{
+  return mCalibration;
+}
+
+/**
+ * @brief Read burst of samples and get its median
+ */
+bool SoilMoistureSensor::MeasureBurst(uint16_t &median) const
+{
+  static_assert(SOIL_OVERSAMPLING > 0 && SOIL_OVERSAMPLING <= SOIL_MAX_OVERSAMPLING, "Invalid soil oversampling");
+
+  std::array<uint16_t, SOIL_OVERSAMPLING> samples;
+  size_t count{0};
+
+  for (size_t i = 0; i < samples.size(); ++i)
+  {
+    // Zero is returned for failed reading, it would pull median to wet side
+    const auto raw_data = MeasureRawData();
+    if (raw_data)
+      samples[count++] = raw_data;
+  }
+
+  if (!count)
+  {
+    ESP_LOGE(SOIL_MOISTURE_SENSOR_TAG, "No valid sample from GPIO %d", static_cast<int>(mSensorPin));
+    return false;
+  }
+
+  median = Utility::Filter::Median(Utility::DataType::Span<uint16_t>(samples.data(), count));
+  return true;
+}
+
+/**
+ * @brief Convert raw value to moisture by calibration
+ */
+float SoilMoistureSensor::ToMoisture(float raw) const
+{
+  // Higher raw value means drier soil
+  const float sensor_output = (mCalibration.dry - raw) / (mCalibration.dry - mCalibration.wet) * OUTPUT_MAX;
+
+  if (sensor_output < OUTPUT_MIN)
+    return OUTPUT_MIN;
+  else if (sensor_output > OUTPUT_MAX)
+    return OUTPUT_MAX;
+  else
+    return sensor_output;
+}
+
+/**
+ * @brief Check if calibration can be used
+ */
+bool SoilMoistureSensor::IsCalibrationValid(const SoilCalibration &calibration)
+{
+  return calibration.dry > calibration.wet;
+}
+
+/**
+ * @brief Get NVS key of probe
+ */
+void SoilMoistureSensor::CalibrationKey(char *key, size_t size) const
+{
+  snprintf(key, size, "gpio%d", static_cast<int>(mSensorPin));
+}
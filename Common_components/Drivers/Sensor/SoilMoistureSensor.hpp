@@ -5,20 +5,54 @@
 #include <driver/dac_common.h>
 #include <driver/adc.h>
 
+/* STD library */
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Utility/Filter/SignalFilter.hpp"
+
+/* SDK config */
+#include "sdkconfig.h"
+
 #define SOIL_MOISTURE_SENSOR_TAG "SoilMoistureSensor"
 
+// Default calibration, raw value of probe in water and on air
 #define SENSOR_MIN 800
 #define SENSOR_MAX 2900
 
 #define OUTPUT_MAX 100
 #define OUTPUT_MIN 0
 
+// Oversampling and filtering
+#ifdef CONFIG_SOIL_OVERSAMPLING
+#define SOIL_OVERSAMPLING CONFIG_SOIL_OVERSAMPLING
+#define SOIL_FILTER_ALPHA (CONFIG_SOIL_FILTER_ALPHA / 100.0f)
+#else
+#define SOIL_OVERSAMPLING 16
+#define SOIL_FILTER_ALPHA 0.25f
+#endif
+
+// Maximum number of samples in one burst
+#define SOIL_MAX_OVERSAMPLING 64
+
+// NVS namespace of probe calibrations
+#define SOIL_CALIBRATION_NAMESPACE "soil_cal"
+
 namespace Component
 {
   namespace Driver
   {
     namespace Sensor
     {
+      /* Calibration points of one probe in raw ADC values */
+      struct SoilCalibration
+      {
+        // Raw value of dry probe, 0 %
+        uint16_t dry;
+        // Raw value of probe in water, 100 %
+        uint16_t wet;
+      };
+
       class SoilMoistureSensor
       {
       public:
@@ -41,11 +75,25 @@ namespace Component
         ~SoilMoistureSensor();
 
         /**
-         * @brief Read data from sensor
+         * @brief Read burst of samples, filter it by median and IIR filter and update cached value
          *
-         * @return float      : Measured data in percentage
+         * @return float      : Filtered moisture in percentage
          */
-        float Measure() const;
+        float Measure();
+
+        /**
+         * @brief Get cached filtered moisture without reading ADC
+         *
+         * @return float      : Filtered moisture in percentage
+         */
+        float Moisture() const;
+
+        /**
+         * @brief Get cached filtered raw value without reading ADC
+         *
+         * @return uint16_t   : Filtered raw value
+         */
+        uint16_t FilteredRawData() const;
 
         /**
          * @brief Read raw data from sensor
@@ -54,7 +102,75 @@ namespace Component
          */
         uint16_t MeasureRawData() const;
 
+        /**
+         * @brief Load calibration of probe from NVS. Default calibration is kept when none is stored
+         *
+         * @return bool       : True when stored calibration was loaded
+         */
+        bool LoadCalibration();
+
+        /**
+         * @brief Store calibration of probe to NVS and use it
+         *
+         * @param[in] calibration : Calibration points
+         *
+         * @return bool           : True when calibration was stored
+         */
+        bool StoreCalibration(const SoilCalibration &calibration);
+
+        /**
+         * @brief Measure dry probe and store its value as 0 % point
+         *
+         * @return bool       : True when calibration was stored
+         */
+        bool CalibrateDry();
+
+        /**
+         * @brief Measure probe in water and store its value as 100 % point
+         *
+         * @return bool       : True when calibration was stored
+         */
+        bool CalibrateWet();
+
+        /**
+         * @brief Get calibration used by sensor
+         *
+         * @return SoilCalibration
+         */
+        SoilCalibration GetCalibration() const;
+
       private:
+        /**
+         * @brief Read burst of samples and get its median
+         *
+         * @param[out] median : Median of valid samples
+         *
+         * @return bool       : False when no sample could be read
+         */
+        bool MeasureBurst(uint16_t &median) const;
+
+        /**
+         * @brief Convert raw value to moisture by calibration
+         *
+         * @param[in] raw     : Raw value
+         *
+         * @return float      : Moisture in percentage
+         */
+        float ToMoisture(float raw) const;
+
+        /**
+         * @brief Check if calibration can be used
+         */
+        static bool IsCalibrationValid(const SoilCalibration &calibration);
+
+        /**
+         * @brief Get NVS key of probe
+         *
+         * @param[out] key    : Buffer for key
+         * @param[in] size    : Size of buffer
+         */
+        void CalibrationKey(char *key, size_t size) const;
+
         enum class ADC_TYPE
         {
           ADC1,
@@ -77,6 +193,15 @@ namespace Component
 
         /* ADC bits width */
         adc_bits_width_t mWidth;
+
+        /* Calibration of probe */
+        SoilCalibration mCalibration;
+
+        /* IIR filter of burst medians */
+        Utility::Filter::ExponentialFilter mFilter;
+
+        /* Cached filtered moisture */
+        float mMoisture;
       };
     } // namespace Sensor
 
@@ -1,12 +1,17 @@
 #include "WaterLevelSensor.hpp"
 
+/* ESP log library */
+#include <esp_log.h>
+
 using namespace Component::Driver::Sensor;
+using namespace Component::Driver::Communication;
 
 /**
  * @brief Class constructor
  */
-WaterLevelSensor::WaterLevelSensor(uint8_t i2c_address, Component::Driver::Communication::I2C *i2c)
-    : mWaterLevel(0u), mI2C_Address(i2c_address), mI2C(i2c)
+WaterLevelSensor::WaterLevelSensor(uint8_t i2c_address, Component::Driver::Communication::I2C_BusInterface *i2c)
+    : mWaterLevel(0u), mI2C_Address(i2c_address), mI2C(i2c), mThreshold(0u), mHysteresis(0u), mPeriod(0u),
+      mCallback(nullptr), mContext(nullptr), mFailures(0u), mLow(true), mMonitoring(false), mMonitorTask(nullptr)
 {
 }
 
@@ -15,14 +20,31 @@ WaterLevelSensor::WaterLevelSensor(uint8_t i2c_address, Component::Driver::Commu
  */
 WaterLevelSensor::~WaterLevelSensor()
 {
+  StopMonitoring();
 }
 
 /**
  * @brief Measure water level
  */
-uint8_t WaterLevelSensor::Measure()
+bool WaterLevelSensor::Measure()
 {
-  return 0;
+  std::array<uint8_t, WATER_LEVEL_LOW_SECTIONS> low;
+  std::array<uint8_t, WATER_LEVEL_HIGH_SECTIONS> high;
+
+  const I2C_Transaction transactions[] = {
+      {mI2C_Address, Utility::DataType::ByteView(), Utility::DataType::Span<uint8_t>(low.data(), low.size()), 0},
+      {static_cast<uint8_t>(mI2C_Address + 1), Utility::DataType::ByteView(), Utility::DataType::Span<uint8_t>(high.data(), high.size()), 0}};
+
+  size_t completed{0};
+  const auto result = mI2C->Execute(Utility::DataType::Span<const I2C_Transaction>(transactions, 2), completed);
+  if (result != I2C_Result::I2C_OK)
+  {
+    ESP_LOGW(WATER_LEVEL_SENSOR_TAG, "Reading of section %d failed: %s", static_cast<int>(completed), I2C_RESULT_TO_STRING(result));
+    return false;
+  }
+
+  mWaterLevel = ToLevel(low, high);
+  return true;
 }
 
 /**
@@ -31,4 +53,145 @@ uint8_t WaterLevelSensor::Measure()
 uint8_t WaterLevelSensor::WaterLevel() const
 {
   return mWaterLevel;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Sample level periodically in background task and report crossings of threshold
+ */
+bool WaterLevelSensor::StartMonitoring(uint8_t threshold, uint8_t hysteresis, TickType_t period, LevelCallback callback,
+                                       void *context, UBaseType_t priority)
+{
+  if (mMonitoring)
+    return true;
+
+  if (!callback || !period)
+    return false;
+
+  mThreshold = threshold;
+  mHysteresis = hysteresis;
+  mPeriod = period;
+  mCallback = callback;
+  mContext = context;
+
+  // Tank is low until the first successful reading proves otherwise
+  mFailures = 0;
+  mLow = true;
+  UpdateState(Measure());
+
+  mMonitoring = true;
+
+  TaskHandle_t task{nullptr};
+  if (xTaskCreate(&WaterLevelSensor::MonitorTask, "WaterLevel", WATER_LEVEL_MONITOR_STACK_SIZE, this, priority, &task) != pdPASS)
+  {
+    ESP_LOGE(WATER_LEVEL_SENSOR_TAG, "Unable to create monitor task");
+    mMonitoring = false;
+    mLow = true;
+    return false;
+  }
+
+  mMonitorTask = task;
+  ESP_LOGI(WATER_LEVEL_SENSOR_TAG, "Monitoring started, level %d %%, threshold %d %%", static_cast<int>(WaterLevel()),
+           static_cast<int>(mThreshold));
+  return true;
+}
+
+/**
+ * @brief Stop monitor task
+ */
+void WaterLevelSensor::StopMonitoring()
+{
+  if (!mMonitoring)
+    return;
+
+  mMonitoring = false;
+
+  // Task may be sleeping for the whole period
+  TaskHandle_t task = mMonitorTask;
+  if (task)
+    xTaskNotifyGive(task);
+
+  while (mMonitorTask)
+    vTaskDelay(1);
+}
+
+/**
+ * @brief Check if level is below threshold
+ */
+bool WaterLevelSensor::IsLow() const
+{
+  return mLow;
+}
+
+/**
+ * @brief Convert pad values to level
+ */
+uint8_t WaterLevelSensor::ToLevel(const std::array<uint8_t, WATER_LEVEL_LOW_SECTIONS> &low,
+                                  const std::array<uint8_t, WATER_LEVEL_HIGH_SECTIONS> &high)
+{
+  size_t covered{0};
+
+  // Drops left on pad above water surface must not count
+  while (covered < low.size() && low[covered] > WATER_LEVEL_TOUCH_THRESHOLD)
+    ++covered;
+
+  if (covered == low.size())
+  {
+    while (covered < WATER_LEVEL_SECTIONS && high[covered - low.size()] > WATER_LEVEL_TOUCH_THRESHOLD)
+      ++covered;
+  }
+
+  return static_cast<uint8_t>(covered * 100 / WATER_LEVEL_SECTIONS);
+}
+
+/**
+ * @brief Update low state by new result of measurement
+ */
+bool WaterLevelSensor::UpdateState(bool measured)
+{
+  bool low = mLow;
+
+  if (!measured)
+  {
+    // Dry run is worse than needless stop, so silent sensor means empty tank
+    if (mFailures < WATER_LEVEL_MAX_FAILURES && ++mFailures == WATER_LEVEL_MAX_FAILURES)
+      low = true;
+  }
+  else
+  {
+    mFailures = 0;
+
+    const auto level = WaterLevel();
+    if (level < mThreshold)
+      low = true;
+    else if (level >= mThreshold + mHysteresis)
+      low = false;
+  }
+
+  if (low == mLow)
+    return false;
+
+  mLow = low;
+  return true;
+}
+
+/**
+ * @brief Monitor task body
+ */
+void WaterLevelSensor::MonitorTask(void *arg)
+{
+  auto sensor = static_cast<WaterLevelSensor *>(arg);
+
+  while (sensor->mMonitoring)
+  {
+    // Stop request wakes task immediately
+    ulTaskNotifyTake(pdTRUE, sensor->mPeriod);
+    if (!sensor->mMonitoring)
+      break;
+
+    if (sensor->UpdateState(sensor->Measure()))
+      sensor->mCallback(sensor->mLow, sensor->WaterLevel(), sensor->mContext);
+  }
+
+  sensor->mMonitorTask = nullptr;
+  vTaskDelete(nullptr);
+}
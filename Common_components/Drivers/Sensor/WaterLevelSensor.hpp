@@ -3,9 +3,30 @@
 
 /* STD library */
 #include <stdint.h>
+#include <array>
+#include <atomic>
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 /* Communication */
-#include "I2C.hpp"
+#include "I2C_BusInterface.hpp"
+
+#define WATER_LEVEL_SENSOR_TAG "WaterLevelSensor"
+
+// Capacitive pads of lower and upper section, lower section answers on sensor address, upper one on next address
+#define WATER_LEVEL_LOW_SECTIONS 8
+#define WATER_LEVEL_HIGH_SECTIONS 12
+#define WATER_LEVEL_SECTIONS (WATER_LEVEL_LOW_SECTIONS + WATER_LEVEL_HIGH_SECTIONS)
+
+// Raw value of pad covered by water
+#define WATER_LEVEL_TOUCH_THRESHOLD 100
+
+// Consecutive failed readings after which tank is reported as low
+#define WATER_LEVEL_MAX_FAILURES 3
+
+#define WATER_LEVEL_MONITOR_STACK_SIZE 2560
 
 namespace Component
 {
@@ -13,46 +34,146 @@ namespace Component
   {
     namespace Sensor
     {
+      /**
+       * @brief Capacitive water level sensor with 20 pads on two I2C slaves (Grove Water Level Sensor)
+       */
       class WaterLevelSensor
       {
       public:
+        /**
+         * @brief Callback of level crossing threshold. Called from monitor task
+         *
+         * @param[in] low     : Level is below threshold
+         * @param[in] level   : Water level in percentage
+         * @param[in] context : Context passed to StartMonitoring
+         */
+        using LevelCallback = void (*)(bool low, uint8_t level, void *context);
+
         /**
          * @brief Class constructor
+         *
+         * @param[in] i2c_address : Address of lower section, upper section uses the next address
+         * @param[in] i2c         : I2C bus
          */
-        explicit WaterLevelSensor(uint8_t i2c_address, Component::Driver::Communication::I2C *i2c) __attribute__((nonnull));
+        explicit WaterLevelSensor(uint8_t i2c_address, Component::Driver::Communication::I2C_BusInterface *i2c) __attribute__((nonnull));
 
         /**
          * @brief Class destructor
          */
         ~WaterLevelSensor();
 
+        WaterLevelSensor(const WaterLevelSensor &) = delete;
+        WaterLevelSensor &operator=(const WaterLevelSensor &) = delete;
+
         /**
          * @brief Measure water level
          *
-         * @return uint8_t  : Measured water level
+         * @return bool     : True when level was measured, last level is kept otherwise
          */
-        uint8_t Measure();
+        bool Measure();
 
         /**
          * @brief Get last measured water level
          *
-         * @return uint8_t  : Water level
+         * @return uint8_t  : Water level in percentage
          */
         uint8_t WaterLevel() const;
 
+        /**
+         * @brief Sample level periodically in background task and report crossings of threshold.
+         *        Level is measured once before task starts, so IsLow is valid when method returns
+         *
+         * @param[in] threshold   : Level in percentage below which tank is low
+         * @param[in] hysteresis  : Level above threshold needed to leave low state
+         * @param[in] period      : Sample period in ticks
+         * @param[in] callback    : Callback of crossing
+         * @param[in] context     : Context passed to callback
+         * @param[in] priority    : Priority of monitor task
+         *
+         * @return bool           : True when monitor is running
+         */
+        bool StartMonitoring(uint8_t threshold, uint8_t hysteresis, TickType_t period, LevelCallback callback, void *context,
+                             UBaseType_t priority = tskIDLE_PRIORITY + 5);
+
+        /**
+         * @brief Stop monitor task
+         */
+        void StopMonitoring();
+
+        /**
+         * @brief Check if level is below threshold. Tank is low also when sensor does not respond
+         *
+         * @return bool
+         */
+        bool IsLow() const;
+
       private:
+        /**
+         * @brief Convert pad values to level. Pads are counted from the bottom while they are covered
+         *
+         * @param[in] low     : Pads of lower section
+         * @param[in] high    : Pads of upper section
+         *
+         * @return uint8_t    : Water level in percentage
+         */
+        static uint8_t ToLevel(const std::array<uint8_t, WATER_LEVEL_LOW_SECTIONS> &low,
+                               const std::array<uint8_t, WATER_LEVEL_HIGH_SECTIONS> &high);
+
+        /**
+         * @brief Update low state by new result of measurement
+         *
+         * @param[in] measured  : Measurement was successful
+         *
+         * @return bool         : True when low state changed
+         */
+        bool UpdateState(bool measured);
+
+        /**
+         * @brief Monitor task body
+         *
+         * @param[in] arg     : Pointer to sensor
+         */
+        static void MonitorTask(void *arg);
+
         /* Water level */
-        uint8_t mWaterLevel;
+        std::atomic<uint8_t> mWaterLevel;
 
         /* I2C address */
         uint8_t mI2C_Address;
 
-        /* I2C Driver*/
-        Component::Driver::Communication::I2C *mI2C;
+        /* I2C bus */
+        Component::Driver::Communication::I2C_BusInterface *mI2C;
+
+        /* Level below which tank is low */
+        uint8_t mThreshold;
+
+        /* Level above threshold needed to leave low state */
+        uint8_t mHysteresis;
+
+        /* Sample period of monitor */
+        TickType_t mPeriod;
+
+        /* Callback of crossing */
+        LevelCallback mCallback;
+
+        /* Context of callback */
+        void *mContext;
+
+        /* Number of consecutive failed readings */
+        uint8_t mFailures;
+
+        /* Tank is low */
+        std::atomic<bool> mLow;
+
+        /* Monitor should run */
+        std::atomic<bool> mMonitoring;
+
+        /* Monitor task handle, cleared by task when it ends */
+        std::atomic<TaskHandle_t> mMonitorTask;
       };
     } // namespace Sensor
 
   } // namespace Driver
 } // namespace Component
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,260 @@
+/**
+ * Deadband delta encoding of sensor samples
+ *
+ * Client sends only fields which moved beyond their deadband since the state last acknowledged
+ * by server. Periodic keyframe carries all fields, so both sides converge even after lost frames.
+ * Server keeps last known state of every client and rebuilds full samples from deltas.
+ *
+ * @author Dominik Regec
+ */
+#ifndef SENSOR_DELTA_H
+#define SENSOR_DELTA_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Protocol/SensorFrame.hpp"
+
+namespace Component
+{
+    namespace Protocol
+    {
+        /**
+         * @brief Client side of delta encoding. Reference state moves forward only when frame is acknowledged
+         *
+         * Usage for every frame:
+         *  BeginFrame(), then Prepare() and Accept() for every appended sample, FrameSent() when frame
+         *  was handed to bluetooth stack and Acknowledge() when result of write arrives.
+         *  Only one frame may wait for its result, so result always belongs to the frame it acknowledges.
+         *
+         * @tparam Schema   : Schema of sensor frame
+         */
+        template <typename Schema = GreenhouseSchema>
+        class DeltaEncoder
+        {
+        public:
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] deadband          : Deadband of every field stored in its member of sample
+             * @param[in] keyframeInterval  : Number of frames between keyframes. Zero disables delta encoding
+             */
+            DeltaEncoder(const SensorSample &deadband, uint16_t keyframeInterval)
+                : mDeadband(deadband),
+                  mAcknowledged(),
+                  mPending(),
+                  mKeyframeInterval(keyframeInterval),
+                  mFramesSinceKeyframe(0),
+                  mAcknowledgedValid(false),
+                  mPendingValid(false),
+                  mFrameHasKeyframe(false),
+                  mAwaitingAck(false)
+            {
+            }
+
+            /**
+             * @brief Start new frame from the last acknowledged state
+             *
+             * @return bool     : True  - frame was started
+             *                    False - previous frame still waits for its result, frame must not be sent
+             */
+            bool BeginFrame()
+            {
+                // Result of sent frame would be applied to the new one
+                if (mAwaitingAck)
+                    return false;
+
+                mPending = mAcknowledged;
+                mPendingValid = mAcknowledgedValid && mKeyframeInterval && mFramesSinceKeyframe < mKeyframeInterval;
+                mFrameHasKeyframe = false;
+                return true;
+            }
+
+            /**
+             * @brief Prepare sample for encoding
+             *
+             * @param[in] sample    : Measured sample
+             *
+             * @return SensorSample : Sample with content reduced to changed fields and delta flag,
+             *                        or full sample when keyframe is needed
+             */
+            SensorSample Prepare(const SensorSample &sample) const
+            {
+                SensorSample prepared = sample;
+                prepared.content = Schema::EncodableContent(sample) & Schema::MASK;
+
+                // Delta can not express field which disappeared
+                if (!mPendingValid || (mPending.content & ~prepared.content))
+                    return prepared;
+
+                prepared.content = Schema::ChangedContent(mPending, prepared, mDeadband) | SampleLayout::DELTA_FLAG;
+                return prepared;
+            }
+
+            /**
+             * @brief Move reference state by sample which was appended into frame
+             *
+             * @param[in] encoded   : Sample returned by Prepare and appended into frame
+             */
+            void Accept(const SensorSample &encoded)
+            {
+                if (encoded.content & SampleLayout::DELTA_FLAG)
+                {
+                    Schema::Merge(encoded, mPending);
+                }
+                else
+                {
+                    mPending = encoded;
+                    mFrameHasKeyframe = true;
+                }
+
+                mPending.content &= Schema::MASK;
+                mPendingValid = mKeyframeInterval != 0;
+            }
+
+            /**
+             * @brief Mark frame as handed to bluetooth stack
+             */
+            void FrameSent() { mAwaitingAck = true; }
+
+            /**
+             * @brief Apply result of frame write
+             *
+             * @param[in] acknowledged  : True  - server accepted frame
+             *                            False - frame was rejected or lost
+             */
+            void Acknowledge(bool acknowledged)
+            {
+                if (!mAwaitingAck)
+                    return;
+
+                mAwaitingAck = false;
+
+                // Server state is unknown, start again with keyframe
+                if (!acknowledged)
+                {
+                    Reset();
+                    return;
+                }
+
+                mAcknowledged = mPending;
+                mAcknowledgedValid = true;
+                mFramesSinceKeyframe = mFrameHasKeyframe ? 1 : mFramesSinceKeyframe + 1;
+            }
+
+            /**
+             * @brief Check if sent frame waits for its result
+             */
+            bool IsAwaitingAck() const { return mAwaitingAck; }
+
+            /**
+             * @brief Forget reference state. Next sample is keyframe
+             */
+            void Reset()
+            {
+                mAcknowledgedValid = false;
+                mPendingValid = false;
+                mAwaitingAck = false;
+                mFramesSinceKeyframe = 0;
+            }
+
+        private:
+            /* Deadband of fields */
+            const SensorSample mDeadband;
+
+            /* State acknowledged by server */
+            SensorSample mAcknowledged;
+
+            /* State after samples of current frame */
+            SensorSample mPending;
+
+            /* Number of frames between keyframes */
+            const uint16_t mKeyframeInterval;
+
+            /* Number of acknowledged frames since the last keyframe, including it */
+            uint16_t mFramesSinceKeyframe;
+
+            bool mAcknowledgedValid;
+            bool mPendingValid;
+            bool mFrameHasKeyframe;
+            bool mAwaitingAck;
+        };
+
+        /**
+         * @brief Server side of delta encoding. Holds last known state of every client
+         *
+         * @tparam Clients  : Number of client IDs
+         * @tparam Schema   : Schema of sensor frame
+         */
+        template <size_t Clients = HeaderLayout::MAX_CLIENT_ID + 1, typename Schema = GreenhouseSchema>
+        class DeltaStateCache
+        {
+        public:
+            /**
+             * @brief Class constructor
+             */
+            DeltaStateCache() : mStates{} {}
+
+            /**
+             * @brief Rebuild full sample from delta and update state of client. Keyframe replaces state
+             *
+             * @param[in] clientID      : Client ID
+             * @param[in,out] sample    : Decoded sample, replaced by full sample
+             *
+             * @return FrameResult      : FRAME_OK          - Sample holds full state
+             *                            MISSING_KEYFRAME  - Delta arrived before any keyframe of client
+             *                            INVALID_CONTENT   - Unknown client ID
+             */
+            FrameResult Apply(uint8_t clientID, SensorSample &sample)
+            {
+                if (clientID >= Clients)
+                    return FrameResult::INVALID_CONTENT;
+
+                auto &state = mStates[clientID];
+
+                if (!(sample.content & SampleLayout::DELTA_FLAG))
+                {
+                    state.sample = sample;
+                    state.valid = true;
+                    return FrameResult::FRAME_OK;
+                }
+
+                if (!state.valid)
+                    return FrameResult::MISSING_KEYFRAME;
+
+                Schema::Merge(sample, state.sample);
+                state.sample.age = sample.age;
+                sample = state.sample;
+
+                return FrameResult::FRAME_OK;
+            }
+
+            /**
+             * @brief Forget state of client
+             *
+             * @param[in] clientID  : Client ID
+             */
+            void Invalidate(uint8_t clientID)
+            {
+                if (clientID < Clients)
+                    mStates[clientID].valid = false;
+            }
+
+        private:
+            /* Last known state of client */
+            struct ClientState
+            {
+                SensorSample sample;
+                bool valid;
+            };
+
+            /* States indexed by client ID */
+            std::array<ClientState, Clients> mStates;
+        };
+    } // namespace Protocol
+} // namespace Component
+
+#endif // SENSOR_DELTA_H
@@ -0,0 +1,603 @@
+/**
+ * Binary frame used to transfer sensor measurements from greenhouse clients to server over BLE
+ *
+ * Frame layout (all multi-byte values are big endian):
+ *
+ *  | Version | Client ID << 2 | Position | Sample count | Sample ... |
+ *  |  1 byte |            1 byte         |    1 byte    |            |
+ *
+ * Sample layout:
+ *
+ *  | Age [s] | Content mask | Field ... |
+ *  | 2 bytes |    1 byte    |           |
+ *
+ * Samples are ordered from the oldest to the newest. Age is number of seconds between measurement
+ * and encoding of frame. Every field is signed or unsigned fixed-point number with its own scale.
+ * Fields are present in the sample only when their bit in content mask is set and they follow
+ * the order of schema. Schema and content bits are generated by sensor registry.
+ *
+ * Sample with delta flag set in content mask carries only fields which changed since the previous
+ * sample of the same client. Missing fields keep their previous values. Sample without delta flag
+ * is keyframe and replaces whole state of client.
+ *
+ * @author Dominik Regec
+ */
+#ifndef SENSOR_FRAME_H
+#define SENSOR_FRAME_H
+
+/* STD library */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/* Common components */
+#include "Common_components/Convertors/DataType/BytePacking.hpp"
+#include "Common_components/Utility/DataType/Span.hpp"
+
+/* Project specific includes */
+#include "SensorRegistry.hpp"
+
+#define SENSOR_FRAME_VERSION 0x03
+
+// Maximum number of samples in one frame
+#define SENSOR_FRAME_MAX_SAMPLES 32
+
+#define FRAME_RESULT_TO_STRING(resultValue) Component::Protocol::EnumToString(resultValue)
+
+namespace Component
+{
+    namespace Protocol
+    {
+        enum class FrameResult
+        {
+            FRAME_OK,
+            BUFFER_TOO_SMALL,
+            INVALID_VERSION,
+            INVALID_CONTENT,
+            TRUNCATED_FRAME,
+            MISSING_KEYFRAME,
+        };
+
+        inline const char *EnumToString(FrameResult value)
+        {
+            switch (value)
+            {
+            case (FrameResult::FRAME_OK):
+                return "Frame_OK";
+            case (FrameResult::BUFFER_TOO_SMALL):
+                return "Frame_Buffer_Too_Small";
+            case (FrameResult::INVALID_VERSION):
+                return "Frame_Invalid_Version";
+            case (FrameResult::INVALID_CONTENT):
+                return "Frame_Invalid_Content";
+            case (FrameResult::TRUNCATED_FRAME):
+                return "Frame_Truncated";
+            case (FrameResult::MISSING_KEYFRAME):
+                return "Frame_Missing_Keyframe";
+            default:
+                return "Unimplemented value";
+            }
+        }
+
+        // Alias for read only byte view
+        using ByteView = Utility::DataType::ByteView;
+
+        /* Values of one measurement. Only values with bit set in content mask are valid */
+        struct SensorSample
+        {
+            uint16_t age;
+            uint8_t content;
+            float temperature;
+            float humidity;
+            float co2;
+            float soilMoisture;
+        };
+
+        /* Frame header */
+        struct FrameHeader
+        {
+            uint8_t version;
+            uint8_t clientID;
+            uint8_t position;
+        };
+
+        /* Compile time description of header bytes */
+        struct HeaderLayout
+        {
+            static constexpr size_t VERSION_OFFSET = 0;
+            static constexpr size_t CLIENT_OFFSET = 1;
+            static constexpr size_t COUNT_OFFSET = 2;
+            static constexpr size_t SIZE = 3;
+
+            static constexpr uint8_t CLIENT_ID_SHIFT = 2;
+            static constexpr uint8_t POSITION_MASK = 0x03;
+            static constexpr uint8_t MAX_CLIENT_ID = 0xFF >> CLIENT_ID_SHIFT;
+        };
+
+        /* Compile time description of sample header bytes */
+        struct SampleLayout
+        {
+            static constexpr size_t AGE_OFFSET = 0;
+            static constexpr size_t CONTENT_OFFSET = 2;
+            static constexpr size_t SIZE = 3;
+
+            static constexpr uint8_t DELTA_FLAG = 0x01;
+        };
+
+        /**
+         * @brief Fixed-point field of frame. Content bit is assigned by sensor registry
+         *
+         * @tparam Storage  : Integer type used on the wire
+         * @tparam Scale    : Multiplier applied to value before rounding
+         * @tparam Member   : Member of sample holding the value
+         */
+        template <typename Storage, int32_t Scale, float SensorSample::*Member>
+        struct FixedPointField
+        {
+            static_assert(std::is_integral<Storage>::value, "Fixed-point storage must be integral type");
+            static_assert(sizeof(Storage) <= 4, "Fixed-point storage is limited to 4 bytes");
+            static_assert(Scale > 0, "Fixed-point scale must be positive");
+
+            static constexpr size_t SIZE = sizeof(Storage);
+
+            /**
+             * @brief Convert value to fixed-point representation with rounding half away from zero
+             *        and saturation to range of storage type
+             *
+             * @param[in] value     : Value to convert
+             *
+             * @return Storage      : Fixed-point value
+             */
+            static Storage Quantize(const float value)
+            {
+                const double scaled = static_cast<double>(value) * Scale;
+
+                if (scaled >= static_cast<double>(std::numeric_limits<Storage>::max()))
+                    return std::numeric_limits<Storage>::max();
+
+                if (scaled <= static_cast<double>(std::numeric_limits<Storage>::min()))
+                    return std::numeric_limits<Storage>::min();
+
+                return static_cast<Storage>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+            }
+
+            /**
+             * @brief Convert fixed-point representation back to value
+             *
+             * @param[in] raw       : Fixed-point value
+             *
+             * @return float        : Value
+             */
+            static float Dequantize(const Storage raw)
+            {
+                return static_cast<float>(static_cast<double>(raw) / Scale);
+            }
+
+            /**
+             * @brief Check if value of field in sample can be encoded
+             *
+             * @param[in] sample    : Sample with value
+             *
+             * @return bool         : True  - value is finite number
+             *                        False - otherwise
+             */
+            static bool IsEncodable(const SensorSample &sample)
+            {
+                return std::isfinite(sample.*Member);
+            }
+
+            /**
+             * @brief Check if value of field moved beyond deadband
+             *
+             * @param[in] reference : Sample with previous value
+             * @param[in] sample    : Sample with current value
+             * @param[in] deadband  : Sample with deadband of field
+             *
+             * @return bool         : True  - value changed more than deadband
+             *                        False - otherwise
+             */
+            static bool IsChanged(const SensorSample &reference, const SensorSample &sample, const SensorSample &deadband)
+            {
+                return std::fabs(sample.*Member - reference.*Member) > deadband.*Member;
+            }
+
+            /**
+             * @brief Copy value of field between samples
+             *
+             * @param[in] source        : Sample with value
+             * @param[out] destination  : Sample to fill
+             */
+            static void Copy(const SensorSample &source, SensorSample &destination)
+            {
+                destination.*Member = source.*Member;
+            }
+
+            /**
+             * @brief Write field from sample to output buffer
+             *
+             * @param[in] sample    : Sample with value
+             * @param[out] out      : Output buffer with at least SIZE bytes
+             */
+            static void Write(const SensorSample &sample, uint8_t *out)
+            {
+                Convertor::Store(Quantize(sample.*Member), Utility::DataType::Span<uint8_t>(out, SIZE));
+            }
+
+            /**
+             * @brief Read field from input buffer to sample
+             *
+             * @param[in] in        : Input buffer with at least SIZE bytes
+             * @param[out] sample   : Sample to fill
+             */
+            static void Read(const uint8_t *in, SensorSample &sample)
+            {
+                sample.*Member = Dequantize(Convertor::Unpack<Storage>(in));
+            }
+        };
+
+        /* Temperature in °C with resolution 0.01 °C */
+        using TemperatureField = FixedPointField<int16_t, 100, &SensorSample::temperature>;
+
+        /* Relative humidity in % with resolution 0.01 % */
+        using HumidityField = FixedPointField<int16_t, 100, &SensorSample::humidity>;
+
+        /* CO2 concentration in ppm */
+        using CO2Field = FixedPointField<uint16_t, 1, &SensorSample::co2>;
+
+        /* Soil moisture in % with resolution 0.01 % */
+        using SoilMoistureField = FixedPointField<int16_t, 100, &SensorSample::soilMoisture>;
+
+        /* Air sensor measuring temperature and humidity */
+        struct AirDescriptor
+        {
+            using Fields = FieldList<TemperatureField, HumidityField>;
+        };
+
+        /* CO2 sensor */
+        struct CO2Descriptor
+        {
+            using Fields = FieldList<CO2Field>;
+        };
+
+        /* Capacitive soil moisture probe */
+        struct SoilDescriptor
+        {
+            using Fields = FieldList<SoilMoistureField>;
+        };
+
+        /**
+         * @brief Ordered list of fields in frame
+         */
+        template <typename... Fields>
+        struct FrameSchema;
+
+        template <>
+        struct FrameSchema<>
+        {
+            static constexpr uint8_t MASK = 0x00;
+            static constexpr size_t MAX_SIZE = 0;
+
+            static constexpr size_t PayloadSize(const uint8_t) { return 0; }
+
+            static uint8_t EncodableContent(const SensorSample &sample) { return sample.content; }
+
+            static uint8_t ChangedContent(const SensorSample &, const SensorSample &, const SensorSample &) { return 0x00; }
+
+            static void Merge(const SensorSample &, SensorSample &) {}
+
+            static uint8_t *EncodeFields(const SensorSample &, uint8_t *out) { return out; }
+
+            static const uint8_t *DecodeFields(const uint8_t *in, SensorSample &) { return in; }
+        };
+
+        template <typename Field, typename... Rest>
+        struct FrameSchema<Field, Rest...>
+        {
+            static_assert((Field::MASK & FrameSchema<Rest...>::MASK) == 0, "Two fields of frame share the same content bit");
+
+            static constexpr uint8_t MASK = Field::MASK | FrameSchema<Rest...>::MASK;
+            static constexpr size_t MAX_SIZE = Field::SIZE + FrameSchema<Rest...>::MAX_SIZE;
+
+            /**
+             * @brief Get size of fields selected by content mask
+             */
+            static constexpr size_t PayloadSize(const uint8_t content)
+            {
+                return ((content & Field::MASK) ? Field::SIZE : 0) + FrameSchema<Rest...>::PayloadSize(content);
+            }
+
+            /**
+             * @brief Get content mask without fields which values can not be encoded
+             */
+            static uint8_t EncodableContent(const SensorSample &sample)
+            {
+                const uint8_t content = FrameSchema<Rest...>::EncodableContent(sample);
+
+                if ((content & Field::MASK) && !Field::IsEncodable(sample))
+                    return content & ~Field::MASK;
+
+                return content;
+            }
+
+            /**
+             * @brief Get content mask of fields which are missing in reference or moved beyond their deadband
+             */
+            static uint8_t ChangedContent(const SensorSample &reference, const SensorSample &sample, const SensorSample &deadband)
+            {
+                uint8_t content = FrameSchema<Rest...>::ChangedContent(reference, sample, deadband);
+
+                if ((sample.content & Field::MASK) && (!(reference.content & Field::MASK) || Field::IsChanged(reference, sample, deadband)))
+                    content |= Field::MASK;
+
+                return content;
+            }
+
+            /**
+             * @brief Copy fields selected by source content mask into state
+             */
+            static void Merge(const SensorSample &source, SensorSample &state)
+            {
+                if (source.content & Field::MASK)
+                {
+                    Field::Copy(source, state);
+                    state.content |= Field::MASK;
+                }
+
+                FrameSchema<Rest...>::Merge(source, state);
+            }
+
+            /**
+             * @brief Write fields selected by sample content mask. Caller checks space in buffer
+             */
+            static uint8_t *EncodeFields(const SensorSample &sample, uint8_t *out)
+            {
+                if (sample.content & Field::MASK)
+                {
+                    Field::Write(sample, out);
+                    out += Field::SIZE;
+                }
+
+                return FrameSchema<Rest...>::EncodeFields(sample, out);
+            }
+
+            /**
+             * @brief Read fields selected by sample content mask. Caller checks length of input
+             */
+            static const uint8_t *DecodeFields(const uint8_t *in, SensorSample &sample)
+            {
+                if (sample.content & Field::MASK)
+                {
+                    Field::Read(in, sample);
+                    in += Field::SIZE;
+                }
+
+                return FrameSchema<Rest...>::DecodeFields(in, sample);
+            }
+        };
+
+        /* Sensors of greenhouse, new sensor is appended at the end */
+        using GreenhouseRegistry = SensorRegistry<AirDescriptor, CO2Descriptor, SoilDescriptor>;
+
+        /* Schema of greenhouse sensor frame */
+        using GreenhouseSchema = GreenhouseRegistry::Schema;
+
+        /**
+         * @brief Get content bit of field
+         *
+         * @tparam Field    : Field declared by sensor of registry
+         * @tparam Registry : Sensor registry
+         *
+         * @return uint8_t  : Content bit
+         */
+        template <typename Field, typename Registry = GreenhouseRegistry>
+        constexpr uint8_t ContentBit()
+        {
+            return Registry::template Bit<Field>::VALUE;
+        }
+
+        template <typename Schema = GreenhouseSchema>
+        class SensorFrame
+        {
+            static_assert((Schema::MASK & SampleLayout::DELTA_FLAG) == 0, "Field of frame uses delta flag bit");
+
+        public:
+            /* Content bits which may appear in sample */
+            static constexpr uint8_t CONTENT_MASK = Schema::MASK | SampleLayout::DELTA_FLAG;
+
+            /* Maximum size of encoded sample */
+            static constexpr size_t MAX_SAMPLE_SIZE = SampleLayout::SIZE + Schema::MAX_SIZE;
+
+            /* Maximum size of encoded frame */
+            static constexpr size_t MAX_FRAME_SIZE = HeaderLayout::SIZE + SENSOR_FRAME_MAX_SAMPLES * MAX_SAMPLE_SIZE;
+
+            /**
+             * @brief Get size of encoded sample for given content mask
+             *
+             * @param[in] content   : Content mask
+             *
+             * @return size_t       : Size of sample in bytes
+             */
+            static constexpr size_t SampleSize(const uint8_t content)
+            {
+                return SampleLayout::SIZE + Schema::PayloadSize(content);
+            }
+
+            /**
+             * @brief Single-pass encoder appending samples into caller provided buffer
+             */
+            class Encoder
+            {
+            public:
+                /**
+                 * @brief Class constructor. Header is written immediately
+                 *
+                 * @param[in] header    : Frame header. Version is always set to SENSOR_FRAME_VERSION
+                 * @param[out] buffer   : Output buffer
+                 */
+                Encoder(const FrameHeader &header, Utility::DataType::Span<uint8_t> buffer)
+                    : mBuffer(buffer.data()), mCapacity(buffer.size()), mSize(0), mCount(0), mResult(FrameResult::FRAME_OK)
+                {
+                    if (header.clientID > HeaderLayout::MAX_CLIENT_ID || header.position > HeaderLayout::POSITION_MASK)
+                    {
+                        mResult = FrameResult::INVALID_CONTENT;
+                        return;
+                    }
+
+                    if (!mBuffer || mCapacity < HeaderLayout::SIZE)
+                    {
+                        mResult = FrameResult::BUFFER_TOO_SMALL;
+                        return;
+                    }
+
+                    mBuffer[HeaderLayout::VERSION_OFFSET] = SENSOR_FRAME_VERSION;
+                    mBuffer[HeaderLayout::CLIENT_OFFSET] = static_cast<uint8_t>((header.clientID << HeaderLayout::CLIENT_ID_SHIFT) | header.position);
+                    mBuffer[HeaderLayout::COUNT_OFFSET] = 0;
+                    mSize = HeaderLayout::SIZE;
+                }
+
+                /**
+                 * @brief Append sample at the end of frame
+                 *
+                 * @param[in] sample    : Sample to encode. Bits of values which are not finite are cleared
+                 *
+                 * @return FrameResult  : FRAME_OK          - Sample was appended
+                 *                        BUFFER_TOO_SMALL  - Sample does not fit into the frame
+                 */
+                FrameResult Append(const SensorSample &sample)
+                {
+                    if (mResult != FrameResult::FRAME_OK)
+                        return mResult;
+
+                    if (sample.content & ~CONTENT_MASK)
+                        return FrameResult::INVALID_CONTENT;
+
+                    const uint8_t content = Schema::EncodableContent(sample);
+                    const size_t size = SampleSize(content);
+
+                    if (mCount >= SENSOR_FRAME_MAX_SAMPLES || mCapacity - mSize < size)
+                        return FrameResult::BUFFER_TOO_SMALL;
+
+                    uint8_t *out = mBuffer + mSize;
+                    Convertor::Store(sample.age, Utility::DataType::Span<uint8_t>(out + SampleLayout::AGE_OFFSET, sizeof(sample.age)));
+                    out[SampleLayout::CONTENT_OFFSET] = content;
+
+                    SensorSample encodable = sample;
+                    encodable.content = content;
+                    Schema::EncodeFields(encodable, out + SampleLayout::SIZE);
+
+                    mSize += size;
+                    mBuffer[HeaderLayout::COUNT_OFFSET] = ++mCount;
+                    return FrameResult::FRAME_OK;
+                }
+
+                /**
+                 * @brief Get number of encoded samples
+                 */
+                uint8_t Count() const { return mCount; }
+
+                /**
+                 * @brief Get size of encoded frame in bytes
+                 */
+                size_t Size() const { return mSize; }
+
+            private:
+                /* Output buffer */
+                uint8_t *mBuffer;
+
+                /* Size of output buffer */
+                const size_t mCapacity;
+
+                /* Number of written bytes */
+                size_t mSize;
+
+                /* Number of encoded samples */
+                uint8_t mCount;
+
+                /* Result of header encoding */
+                FrameResult mResult;
+            };
+
+            /**
+             * @brief Decode frame header
+             *
+             * @param[in] data      : Received frame
+             * @param[out] header   : Decoded frame header
+             * @param[out] count    : Number of samples in frame
+             *
+             * @return FrameResult  : FRAME_OK - When header was decoded successfully
+             */
+            static FrameResult DecodeHeader(ByteView data, FrameHeader &header, uint8_t &count)
+            {
+                if (data.size() < HeaderLayout::SIZE)
+                    return FrameResult::TRUNCATED_FRAME;
+
+                header.version = data[HeaderLayout::VERSION_OFFSET];
+                if (header.version != SENSOR_FRAME_VERSION)
+                    return FrameResult::INVALID_VERSION;
+
+                header.clientID = data[HeaderLayout::CLIENT_OFFSET] >> HeaderLayout::CLIENT_ID_SHIFT;
+                header.position = data[HeaderLayout::CLIENT_OFFSET] & HeaderLayout::POSITION_MASK;
+                count = data[HeaderLayout::COUNT_OFFSET];
+
+                return FrameResult::FRAME_OK;
+            }
+
+            /**
+             * @brief Decode samples of frame without any copy or allocation
+             *
+             * @param[in] data      : Received frame
+             * @param[out] samples  : Storage for decoded samples
+             * @param[out] decoded  : Number of decoded samples
+             *
+             * @return FrameResult  : FRAME_OK - When all samples were decoded successfully
+             */
+            static FrameResult DecodeSamples(ByteView data, Utility::DataType::Span<SensorSample> samples, size_t &decoded)
+            {
+                decoded = 0;
+
+                FrameHeader header;
+                uint8_t count{0};
+
+                const auto result = DecodeHeader(data, header, count);
+                if (result != FrameResult::FRAME_OK)
+                    return result;
+
+                if (count > samples.size())
+                    return FrameResult::BUFFER_TOO_SMALL;
+
+                const uint8_t *in = data.begin() + HeaderLayout::SIZE;
+                const uint8_t *end = data.end();
+
+                for (uint8_t i = 0; i < count; ++i)
+                {
+                    if (static_cast<size_t>(end - in) < SampleLayout::SIZE)
+                        return FrameResult::TRUNCATED_FRAME;
+
+                    SensorSample &sample = samples[i];
+                    sample = SensorSample();
+                    sample.age = Convertor::Unpack<uint16_t>(in + SampleLayout::AGE_OFFSET);
+                    sample.content = in[SampleLayout::CONTENT_OFFSET];
+
+                    // Size of unknown field can not be determined
+                    if (sample.content & ~CONTENT_MASK)
+                        return FrameResult::INVALID_CONTENT;
+
+                    if (static_cast<size_t>(end - in) < SampleSize(sample.content))
+                        return FrameResult::TRUNCATED_FRAME;
+
+                    in = Schema::DecodeFields(in + SampleLayout::SIZE, sample);
+                    decoded = i + 1;
+                }
+
+                return FrameResult::FRAME_OK;
+            }
+        };
+
+        /* Frame codec used between greenhouse client and server */
+        using GreenhouseFrame = SensorFrame<>;
+    } // namespace Protocol
+} // namespace Component
+
+#endif // SENSOR_FRAME_H
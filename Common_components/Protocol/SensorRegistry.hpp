@@ -0,0 +1,203 @@
+/**
+ * Compile time registry of sensors transferred in sensor frame
+ *
+ * Every sensor declares list of fields it measures. Registry joins fields of all sensors in declaration
+ * order and assigns their content bits from the highest bit down, so bit 0 of content mask stays free
+ * for flags of sample. Schema of frame, its content mask, encoder and decoder are generated from registry.
+ *
+ * Order of sensors in registry defines wire format. New sensor is appended at the end, so bits of existing
+ * fields do not change. Subset of registry keeps bits of selected fields, so client which measures only some
+ * values generates code only for them and stays compatible with server decoding whole registry.
+ *
+ * @author Dominik Regec
+ */
+#ifndef SENSOR_REGISTRY_H
+#define SENSOR_REGISTRY_H
+
+/* STD library */
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Content bit of the first registered field
+#define SENSOR_REGISTRY_FIRST_BIT 0x80
+
+// Number of content bits usable by fields, the lowest bit is reserved for flags of sample
+#define SENSOR_REGISTRY_MAX_FIELDS 7
+
+namespace Component
+{
+    namespace Protocol
+    {
+        /* Ordered list of fields of frame, defined by frame codec */
+        template <typename... Fields>
+        struct FrameSchema;
+
+        /**
+         * @brief Ordered list of fields declared by sensor
+         */
+        template <typename... Fields>
+        struct FieldList
+        {
+            static constexpr size_t SIZE = sizeof...(Fields);
+        };
+
+        /**
+         * @brief Field with content bit assigned by registry
+         *
+         * @tparam Field    : Field declared by sensor
+         * @tparam Bit      : Bit of field in content mask
+         */
+        template <typename Field, uint8_t Bit>
+        struct BoundField : Field
+        {
+            /* Field declared by sensor */
+            using Declared = Field;
+
+            static constexpr uint8_t MASK = Bit;
+        };
+
+        namespace Detail
+        {
+            /**
+             * @brief Join lists of fields
+             */
+            template <typename... Lists>
+            struct Concat;
+
+            template <>
+            struct Concat<>
+            {
+                using Type = FieldList<>;
+            };
+
+            template <typename... Fields>
+            struct Concat<FieldList<Fields...>>
+            {
+                using Type = FieldList<Fields...>;
+            };
+
+            template <typename... First, typename... Second, typename... Rest>
+            struct Concat<FieldList<First...>, FieldList<Second...>, Rest...>
+            {
+                using Type = typename Concat<FieldList<First..., Second...>, Rest...>::Type;
+            };
+
+            /**
+             * @brief Assign content bits to fields, starting with Bit and going down
+             */
+            template <uint8_t Bit, typename List>
+            struct Bind;
+
+            template <uint8_t Bit>
+            struct Bind<Bit, FieldList<>>
+            {
+                using Type = FieldList<>;
+            };
+
+            template <uint8_t Bit, typename Field, typename... Rest>
+            struct Bind<Bit, FieldList<Field, Rest...>>
+            {
+                using Type = typename Concat<FieldList<BoundField<Field, Bit>>,
+                                             typename Bind<(Bit >> 1), FieldList<Rest...>>::Type>::Type;
+            };
+
+            /**
+             * @brief Keep bound fields which bits are set in content mask
+             */
+            template <uint8_t Content, typename List>
+            struct Filter;
+
+            template <uint8_t Content>
+            struct Filter<Content, FieldList<>>
+            {
+                using Type = FieldList<>;
+            };
+
+            template <uint8_t Content, typename Field, typename... Rest>
+            struct Filter<Content, FieldList<Field, Rest...>>
+            {
+                using Type = typename Concat<typename std::conditional<(Content & Field::MASK) != 0, FieldList<Field>, FieldList<>>::type,
+                                            typename Filter<Content, FieldList<Rest...>>::Type>::Type;
+            };
+
+            /**
+             * @brief Find content bit of declared field in list of bound fields
+             */
+            template <typename Field, typename List>
+            struct Find;
+
+            template <typename Field>
+            struct Find<Field, FieldList<>>
+            {
+                static constexpr uint8_t MASK = 0x00;
+                static constexpr size_t COUNT = 0;
+            };
+
+            template <typename Field, typename Bound, typename... Rest>
+            struct Find<Field, FieldList<Bound, Rest...>>
+            {
+                static constexpr bool MATCH = std::is_same<Field, typename Bound::Declared>::value;
+
+                static constexpr uint8_t MASK = MATCH ? Bound::MASK : Find<Field, FieldList<Rest...>>::MASK;
+                static constexpr size_t COUNT = (MATCH ? 1 : 0) + Find<Field, FieldList<Rest...>>::COUNT;
+            };
+
+            /**
+             * @brief Create frame schema from list of bound fields
+             */
+            template <typename List>
+            struct ToSchema;
+
+            template <typename... Fields>
+            struct ToSchema<FieldList<Fields...>>
+            {
+                using Type = FrameSchema<Fields...>;
+            };
+        } // namespace Detail
+
+        /**
+         * @brief Registry of sensors. Every sensor provides type Fields, list of its fields
+         *
+         * @tparam Sensors  : Sensors in order of wire format
+         */
+        template <typename... Sensors>
+        class SensorRegistry
+        {
+        public:
+            /* Fields of all sensors with assigned content bits */
+            using Fields = typename Detail::Bind<SENSOR_REGISTRY_FIRST_BIT, typename Detail::Concat<typename Sensors::Fields...>::Type>::Type;
+
+            static_assert(Fields::SIZE <= SENSOR_REGISTRY_MAX_FIELDS, "Sensor registry has more fields than content mask bits");
+
+            /* Schema of frame with all fields of registry */
+            using Schema = typename Detail::ToSchema<Fields>::Type;
+
+            /**
+             * @brief Content bit of field
+             *
+             * @tparam Field    : Field declared by sensor of registry
+             */
+            template <typename Field>
+            struct Bit
+            {
+                static_assert(Detail::Find<Field, Fields>::COUNT == 1, "Field must be declared exactly once in sensor registry");
+
+                static constexpr uint8_t VALUE = Detail::Find<Field, Fields>::MASK;
+            };
+
+            /**
+             * @brief Schema of frame with fields selected by content mask. Fields keep bits of registry
+             *
+             * @tparam Content  : Content mask of selected fields
+             */
+            template <uint8_t Content>
+            struct Subset
+            {
+                using Schema = typename Detail::ToSchema<typename Detail::Filter<Content, Fields>::Type>::Type;
+            };
+        };
+    } // namespace Protocol
+} // namespace Component
+
+#endif // SENSOR_REGISTRY_H
@@ -2,6 +2,7 @@
 #define BASE_PUBLISHER_DEFINITIONS
 
 /* STL includes  */
+#include <cstddef>
 #include <string>
 
 namespace Component
@@ -10,9 +11,25 @@ namespace Component
     {
         enum class Events
         {
-            BLUETOOTH_DATA_RECEIVED // Received new bluetooth data
+            BLUETOOTH_DATA_RECEIVED, // Received new bluetooth data
+            WATER_LEVEL_CHANGED,     // Water level crossed threshold of tank
+            EVENTS_COUNT             // Number of events. Keep it last
         };
 
+        /* Dispatch lanes ordered from the highest priority */
+        enum class EventLane
+        {
+            CONTROL,   // Events which drive actuators
+            TELEMETRY, // Bulk measurement data
+            LANES_COUNT
+        };
+
+        /* Number of events */
+        static constexpr size_t EVENTS_COUNT = static_cast<size_t>(Events::EVENTS_COUNT);
+
+        /* Number of lanes */
+        static constexpr size_t LANES_COUNT = static_cast<size_t>(EventLane::LANES_COUNT);
+
         static std::string EnumToString(Events event)
         {
             switch (event)
@@ -20,6 +37,9 @@ namespace Component
             case (Events::BLUETOOTH_DATA_RECEIVED):
                 return "Bluetooth data received";
 
+            case (Events::WATER_LEVEL_CHANGED):
+                return "Water level changed";
+
             default:
                 return "";
             }
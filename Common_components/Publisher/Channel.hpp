@@ -0,0 +1,307 @@
+#ifndef PUBLISHER_CHANNEL_H
+#define PUBLISHER_CHANNEL_H
+
+/* Common components includes */
+#include "Common_components/Publisher/BasePublisherDefinitions.hpp"
+#include "Common_components/Utility/Concurrency/MPMCQueue.hpp"
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/* STD library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace Component
+{
+    namespace Publisher
+    {
+        /**
+         * @brief Compile-time description of event. Every event published through channel
+         *        must specialize it with:
+         *          Payload_T   - payload type. Moved through queue, so it should be cheap to move
+         *          LANE        - dispatch lane of event
+         *          DEPTH       - maximum number of queued payloads, power of two
+         *          SUBSCRIBERS - maximum number of subscribers
+         *
+         * @tparam Event    : Event
+         */
+        template <Events Event>
+        struct EventTraits;
+
+        /**
+         * @brief Queue and subscribers of one event. Payload type is checked at compile time
+         *        and subscribers are plain function pointers, so dispatch does not need virtual calls.
+         *
+         * @tparam Event    : Event
+         */
+        template <Events Event>
+        class Channel
+        {
+        public:
+            // Alias for event traits
+            using Traits = EventTraits<Event>;
+
+            // Alias for payload type
+            using Payload_T = typename Traits::Payload_T;
+
+            /* Subscriber callback. Subscriber may move payload out to take ownership of it */
+            using Handler_T = void (*)(Payload_T &payload, void *context);
+
+            /**
+             * @brief Class constructor
+             */
+            explicit Channel() : mReaders(0), mDropped(0)
+            {
+                mLists[0].count = 0;
+                mLists[1].count = 0;
+                mActive.store(&mLists[0]);
+            }
+
+            /**
+             * @brief Class destructor
+             */
+            ~Channel() {}
+
+            Channel(const Channel &) = delete;
+            Channel &operator=(const Channel &) = delete;
+
+            /**
+             * @brief Subscribe callback to channel. Must not be called from subscriber callback
+             *
+             * @param[in] handler   : Subscriber callback
+             * @param[in] context   : Context passed to callback
+             *
+             * @return bool         : True  - subscriber is registered
+             *                        False - subscriber table is full
+             */
+            bool Subscribe(Handler_T handler, void *context)
+            {
+                if (!handler)
+                    return false;
+
+                std::lock_guard<std::mutex> lock(mWriterMutex);
+
+                const auto active = mActive.load();
+                if (active->Find({handler, context}) != active->count)
+                    return true;
+
+                if (active->count >= active->delegates.size())
+                    return false;
+
+                auto list = PrepareInactiveList();
+                list->delegates[list->count++] = {handler, context};
+                mActive.store(list);
+
+                return true;
+            }
+
+            /**
+             * @brief Unsubscribe callback from channel. Must not be called from subscriber callback
+             *
+             * @param[in] handler   : Subscriber callback
+             * @param[in] context   : Context passed to callback
+             */
+            void Unsubscribe(Handler_T handler, void *context)
+            {
+                std::lock_guard<std::mutex> lock(mWriterMutex);
+
+                const auto active = mActive.load();
+                if (active->Find({handler, context}) == active->count)
+                    return;
+
+                auto list = PrepareInactiveList();
+                const auto index = list->Find({handler, context});
+                for (size_t i = index + 1; i < list->count; ++i)
+                    list->delegates[i - 1] = list->delegates[i];
+
+                --list->count;
+                mActive.store(list);
+            }
+
+            /**
+             * @brief Queue payload for dispatch. Takes constant time and never blocks
+             *
+             * @param[in] payload   : Payload. It is moved only when it was queued
+             *
+             * @return bool         : True  - payload was queued
+             *                        False - channel has no subscribers or its queue is full
+             */
+            bool Publish(Payload_T &&payload)
+            {
+                if (!mActive.load()->count)
+                    return false;
+
+                if (!mQueue.TryPush(std::move(payload)))
+                {
+                    ++mDropped;
+                    return false;
+                }
+
+                return true;
+            }
+
+            /**
+             * @brief Dispatch one queued payload to all subscribers
+             *
+             * @return bool         : True  - payload was dispatched
+             *                        False - queue is empty
+             */
+            bool DispatchOne()
+            {
+                Payload_T payload;
+                if (!mQueue.TryPop(payload))
+                    return false;
+
+                ++mReaders;
+                const auto list = mActive.load();
+                for (size_t i = 0; i < list->count; ++i)
+                    list->delegates[i].handler(payload, list->delegates[i].context);
+                --mReaders;
+
+                return true;
+            }
+
+            /**
+             * @brief Get number of payloads rejected because of full queue
+             */
+            uint32_t GetDropped() const { return mDropped.load(); }
+
+        private:
+            /* Subscriber callback with its context */
+            struct Delegate
+            {
+                Handler_T handler;
+                void *context;
+            };
+
+            /* Flat list of subscribers */
+            struct DelegateList
+            {
+                std::array<Delegate, Traits::SUBSCRIBERS> delegates;
+                size_t count;
+
+                /**
+                 * @brief Get index of delegate or count when it is not in list
+                 */
+                size_t Find(const Delegate &delegate) const
+                {
+                    size_t index = 0;
+                    while (index < count && (delegates[index].handler != delegate.handler || delegates[index].context != delegate.context))
+                        ++index;
+
+                    return index;
+                }
+            };
+
+            /**
+             * @brief Prepare inactive list for writing. Caller holds mWriterMutex
+             *
+             * @return DelegateList*    : Inactive list filled with copy of active one
+             */
+            DelegateList *PrepareInactiveList()
+            {
+                auto active = mActive.load();
+                auto inactive = active == &mLists[0] ? &mLists[1] : &mLists[0];
+
+                // Dispatcher may still iterate inactive list if it loaded it before the last swap
+                while (mReaders.load())
+                    vTaskDelay(1);
+
+                *inactive = *active;
+                return inactive;
+            }
+
+            /* Queued payloads */
+            Utility::Concurrency::MPMCQueue<Payload_T, Traits::DEPTH> mQueue;
+
+            /* Copy-on-write buffers of subscribers, one is active and the other one is prepared by writer */
+            std::array<DelegateList, 2> mLists;
+
+            /* Active list of subscribers */
+            std::atomic<DelegateList *> mActive;
+
+            /* Number of dispatchers reading active list */
+            std::atomic<uint32_t> mReaders;
+
+            /* Payloads dropped due to full queue */
+            std::atomic<uint32_t> mDropped;
+
+            /* Serialize subscriber list writers */
+            std::mutex mWriterMutex;
+        };
+
+        /**
+         * @brief Set of channels for listed events. Lookup of channel is resolved at compile time
+         *
+         * @tparam Events   : Events with channel
+         */
+        template <Events... List>
+        class ChannelTable;
+
+        template <>
+        class ChannelTable<>
+        {
+        public:
+            /* Number of channels in table */
+            static constexpr size_t SIZE = 0;
+
+            /**
+             * @brief Dispatch one queued payload of given lane
+             */
+            bool DispatchNext(EventLane) { return false; }
+        };
+
+        template <Events Head, Events... Tail>
+        class ChannelTable<Head, Tail...> : private ChannelTable<Tail...>
+        {
+            // Alias for the rest of table
+            using Base = ChannelTable<Tail...>;
+
+        public:
+            /* Number of channels in table */
+            static constexpr size_t SIZE = Base::SIZE + 1;
+
+            /**
+             * @brief Get channel of event
+             *
+             * @tparam Event        : Event
+             *
+             * @return Channel&     : Channel of event
+             */
+            template <Events Event>
+            typename std::enable_if<Event == Head, Channel<Event> &>::type Get() { return mChannel; }
+
+            template <Events Event>
+            typename std::enable_if<Event != Head, Channel<Event> &>::type Get() { return Base::template Get<Event>(); }
+
+            /**
+             * @brief Dispatch one queued payload of given lane. Channels are scanned in order of table
+             *
+             * @param[in] lane      : Dispatch lane
+             *
+             * @return bool         : True  - payload was dispatched
+             *                        False - all queues of lane are empty
+             */
+            bool DispatchNext(EventLane lane)
+            {
+                if (EventTraits<Head>::LANE == lane && mChannel.DispatchOne())
+                    return true;
+
+                return Base::DispatchNext(lane);
+            }
+
+        private:
+            /* Channel of head event */
+            Channel<Head> mChannel;
+        };
+    } // namespace Publisher
+} // namespace Component
+
+#endif // PUBLISHER_CHANNEL_H
@@ -2,74 +2,48 @@
 #define EVENT_DATA_H
 
 /* STD library*/
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 /* Common components */
 #include "Common_components/Utility/DataType/DataTypeUtility.hpp"
+#include "Common_components/Utility/DataType/Span.hpp"
+#include "Common_components/Protocol/SensorFrame.hpp"
 
 namespace Component
 {
     namespace Publisher
     {
-        class EventData
+        /* Water level crossed threshold of tank */
+        struct WaterLevelEventData
         {
-        public:
-            /**
-             * @brief Class constructor
-             */
-            EventData() {}
-
-            /**
-             * @brief Class destructor
-             */
-            virtual ~EventData() {}
+            // Water level in percentage
+            uint8_t level;
+            // Level is below threshold
+            bool low;
         };
 
-        class ClientBluetoothEventData_Greenhouse : public EventData
+        class ClientBluetoothEventData_Greenhouse
         {
         public:
+            // Alias for sensor sample
+            using Sample = Component::Protocol::SensorSample;
+
             /**
              * @brief Class constructor
              */
             ClientBluetoothEventData_Greenhouse(uint8_t clientID, uint8_t position)
                 : mClientID(clientID),
                   mPosition(position),
-                  mTemperature(nullptr),
-                  mHumidity(nullptr),
-                  mCO2(nullptr),
-                  mSoilMoisture(nullptr)
+                  mSampleCount(0)
             {
             }
 
             /**
              * @brief Class destructor
              */
-            ~ClientBluetoothEventData_Greenhouse()
-            {
-                if (mTemperature)
-                {
-                    delete mTemperature;
-                    mTemperature = nullptr;
-                }
-
-                if (mHumidity)
-                {
-                    delete mHumidity;
-                    mHumidity = nullptr;
-                }
-
-                if (mCO2)
-                {
-                    delete mCO2;
-                    mCO2 = nullptr;
-                }
-
-                if (mSoilMoisture)
-                {
-                    delete mSoilMoisture;
-                    mSoilMoisture = nullptr;
-                }
-            }
+            ~ClientBluetoothEventData_Greenhouse() {}
 
             /**
              * @brief Get client ID
@@ -86,92 +60,34 @@ namespace Component
             uint8_t GetPosition() const { return mPosition.Get(); }
 
             /**
-             * @brief Check if temperature is set
-             *
-             * @return bool     : True  - temperature is set
-             *                    False - otherwise
-             */
-            bool IsTemperatureSet() const { return mTemperature != nullptr; }
-
-            /**
-             * @brief Get temperature
-             *
-             * @return float    : Temperature value
-             */
-            float GetTemperature() const { return mTemperature->Get(); }
-
-            /**
-             * @brief Set temperature
-             *
-             * @param[in] temperature    : Temperature value
-             */
-            void SetTemperature(float temperature) { mTemperature = new Value<float>(temperature); }
-
-            /**
-             * @brief Check if humidity is set
-             *
-             * @return bool     : True  - humidity is set
-             *                    False - otherwise
-             */
-            bool IsHumiditySet() const { return mHumidity != nullptr; }
-
-            /**
-             * @brief Get humidity
-             *
-             * @return float    : Humidity value
-             */
-            float GetHumidity() const { return mHumidity->Get(); }
-
-            /**
-             * @brief Set humidity
-             *
-             * @param[in] humidity    : Humidity value
-             */
-            void SetHumidity(float humidity) { mHumidity = new Value<float>(humidity); }
-
-            /**
-             * @brief Check if co2 is set
+             * @brief Get number of samples
              *
-             * @return bool     : True  - co2 is set
-             *                    False - otherwise
+             * @return size_t       : Number of samples
              */
-            bool IsCO2Set() const { return mCO2 != nullptr; }
+            size_t GetSampleCount() const { return mSampleCount; }
 
             /**
-             * @brief Get co2
+             * @brief Get sample. Samples are ordered from the oldest to the newest
              *
-             * @return uint16_t    : CO2 value
-             */
-            uint16_t GetCO2() const { return mCO2->Get(); }
-
-            /**
-             * @brief Set co2
+             * @param[in] index     : Index of sample
              *
-             * @param[in] co2    : CO2 value
+             * @return const Sample&    : Sample
              */
-            void SetCO2(uint16_t co2) { mCO2 = new Value<uint16_t>(co2); }
+            const Sample &GetSample(const size_t index) const { return mSamples.at(index); }
 
             /**
-             * @brief Check if soil moisture is set
+             * @brief Get storage for samples to decode frame into
              *
-             * @return bool     : True  - soil moisture is set
-             *                    False - otherwise
+             * @return Span<Sample>     : View over whole sample storage
              */
-            bool IsSoilMoistureSet() const { return mSoilMoisture != nullptr; }
+            Utility::DataType::Span<Sample> GetSampleStorage() { return Utility::DataType::Span<Sample>(mSamples); }
 
             /**
-             * @brief Get soil moisture
+             * @brief Set number of valid samples in storage
              *
-             * @return float    : Soil moisture value
+             * @param[in] count     : Number of samples
              */
-            float GetSoilMoisture() const { return mSoilMoisture->Get(); }
-
-            /**
-             * @brief Set soil moisture
-             *
-             * @param[in] soilMoisture    : Soil moisture value
-             */
-            void SetSoilMoisture(float soilMoisture) { mSoilMoisture = new Value<float>(soilMoisture); }
+            void SetSampleCount(const size_t count) { mSampleCount = count < mSamples.size() ? count : mSamples.size(); }
 
         private:
             // Alias for Value utility
@@ -184,17 +100,11 @@ namespace Component
             // Position
             const Value<uint8_t> mPosition;
 
-            // Temperature
-            Value<float> *mTemperature;
-
-            // Humidity
-            Value<float> *mHumidity;
-
-            // CO2
-            Value<uint16_t> *mCO2;
+            // Samples
+            std::array<Sample, SENSOR_FRAME_MAX_SAMPLES> mSamples;
 
-            // Soil moisture
-            Value<float> *mSoilMoisture;
+            // Number of valid samples
+            size_t mSampleCount;
         };
     } // namespace Publisher
 } // namespace Greenhouse
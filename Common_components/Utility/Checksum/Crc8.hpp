@@ -0,0 +1,125 @@
+/**
+ * Table driven CRC-8
+ *
+ * Lookup table is generated at compile time from polynomial, so every byte costs one table access.
+ * Sensirion sensors protect every 16-bit word of response by CRC-8 with polynomial 0x31 and
+ * initial value 0xFF, CRC of 0xBEEF is 0x92.
+ *
+ * @author Dominik Regec
+ */
+#ifndef CRC8_H
+#define CRC8_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* Common components */
+#include "Common_components/Utility/DataType/IndexSequence.hpp"
+#include "Common_components/Utility/DataType/Span.hpp"
+
+namespace Utility
+{
+    namespace Checksum
+    {
+        /**
+         * @brief CRC-8 without reflection and final XOR
+         *
+         * @tparam Polynomial   : Generator polynomial without the highest bit
+         * @tparam Init         : Initial value of CRC
+         */
+        template <uint8_t Polynomial, uint8_t Init>
+        class Crc8
+        {
+        public:
+            /* Lookup table indexed by CRC xor input byte */
+            using Table = std::array<uint8_t, 256>;
+
+            /**
+             * @brief Compute CRC of data
+             *
+             * @param[in] data  : Data
+             *
+             * @return uint8_t  : CRC
+             */
+            static uint8_t Compute(DataType::ByteView data)
+            {
+                uint8_t crc = Init;
+                for (const auto byte : data)
+                    crc = TABLE[crc ^ byte];
+
+                return crc;
+            }
+
+            /**
+             * @brief Compute CRC of data at compile time, bit by bit
+             *
+             * @param[in] data      : Data
+             * @param[in] length    : Length of data
+             *
+             * @return uint8_t      : CRC
+             */
+            static constexpr uint8_t ComputeConstexpr(const uint8_t *data, size_t length)
+            {
+                return Update(Init, data, length);
+            }
+
+            /**
+             * @brief Check data followed by its CRC
+             *
+             * @param[in] data  : Data
+             * @param[in] crc   : Received CRC
+             *
+             * @return bool     : True when CRC matches
+             */
+            static bool Check(DataType::ByteView data, uint8_t crc) { return Compute(data) == crc; }
+
+            /* Lookup table, constant initialized so it is placed in read only memory */
+            static const Table TABLE;
+
+        private:
+            /**
+             * @brief Process one bit of CRC register
+             */
+            static constexpr uint8_t Step(uint8_t crc)
+            {
+                return static_cast<uint8_t>(crc & 0x80 ? (crc << 1) ^ Polynomial : crc << 1);
+            }
+
+            /**
+             * @brief Process remaining bits of CRC register
+             */
+            static constexpr uint8_t Entry(uint8_t crc, uint8_t bits = 8)
+            {
+                return bits ? Entry(Step(crc), static_cast<uint8_t>(bits - 1)) : crc;
+            }
+
+            /**
+             * @brief Process remaining bytes of data
+             */
+            static constexpr uint8_t Update(uint8_t crc, const uint8_t *data, size_t length)
+            {
+                return length ? Update(Entry(static_cast<uint8_t>(crc ^ *data)), data + 1, length - 1) : crc;
+            }
+
+            /**
+             * @brief Generate lookup table
+             */
+            template <size_t... Indexes>
+            static constexpr Table Generate(DataType::IndexSequence<Indexes...>)
+            {
+                return {{Entry(static_cast<uint8_t>(Indexes))...}};
+            }
+        };
+
+        template <uint8_t Polynomial, uint8_t Init>
+        const typename Crc8<Polynomial, Init>::Table Crc8<Polynomial, Init>::TABLE =
+            Crc8<Polynomial, Init>::Generate(typename DataType::MakeIndexSequence<256>::Type());
+
+        /* CRC-8 of Sensirion sensors */
+        using SensirionCrc8 = Crc8<0x31, 0xFF>;
+    } // namespace Checksum
+} // namespace Utility
+
+#endif // CRC8_H
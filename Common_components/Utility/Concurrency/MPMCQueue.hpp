@@ -0,0 +1,155 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+/* STD library */
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Utility
+{
+    namespace Concurrency
+    {
+        /**
+         * @brief Bounded lock-free multi-producer multi-consumer queue.
+         *
+         *        Every cell carries sequence number which tells producers and consumers whether
+         *        the cell is free for given position, so push and pop need one compare-and-swap
+         *        on success and never block or allocate.
+         *
+         * @tparam T        : Item type. Should be cheap to move, e.g. pointer or handle
+         * @tparam Capacity : Maximum number of items. Must be power of two
+         */
+        template <class T, size_t Capacity>
+        class MPMCQueue
+        {
+            static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MPMC queue capacity must be power of two");
+
+        public:
+            /**
+             * @brief Class constructor
+             */
+            explicit MPMCQueue() : mEnqueuePosition(0), mDequeuePosition(0)
+            {
+                for (size_t i = 0; i < Capacity; ++i)
+                    mCells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Class destructor
+             */
+            ~MPMCQueue() {}
+
+            MPMCQueue(const MPMCQueue &) = delete;
+            MPMCQueue &operator=(const MPMCQueue &) = delete;
+
+            /**
+             * @brief Try to push item at the end of queue
+             *
+             * @param[in] item  : Item to push. Item is moved only when it was pushed
+             *
+             * @return bool     : True  - item was pushed
+             *                    False - queue is full
+             */
+            template <class U>
+            bool TryPush(U &&item)
+            {
+                size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+
+                while (true)
+                {
+                    Cell &cell = mCells[position & MASK];
+                    const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                    if (difference == 0)
+                    {
+                        if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            cell.data = std::forward<U>(item);
+                            cell.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (difference < 0)
+                        return false;
+                    else
+                        position = mEnqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            /**
+             * @brief Try to pop item from the beginning of queue
+             *
+             * @param[out] item : Popped item
+             *
+             * @return bool     : True  - item was popped
+             *                    False - queue is empty
+             */
+            bool TryPop(T &item)
+            {
+                size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+
+                while (true)
+                {
+                    Cell &cell = mCells[position & MASK];
+                    const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+                    if (difference == 0)
+                    {
+                        if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            item = std::move(cell.data);
+                            cell.sequence.store(position + MASK + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (difference < 0)
+                        return false;
+                    else
+                        position = mDequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            /**
+             * @brief Get approximate number of queued items
+             */
+            size_t SizeApprox() const
+            {
+                const size_t enqueue = mEnqueuePosition.load(std::memory_order_relaxed);
+                const size_t dequeue = mDequeuePosition.load(std::memory_order_relaxed);
+
+                return enqueue > dequeue ? enqueue - dequeue : 0;
+            }
+
+            /**
+             * @brief Get capacity of queue
+             */
+            static constexpr size_t GetCapacity() { return Capacity; }
+
+        private:
+            /* Mask to map position to cell index */
+            static constexpr size_t MASK = Capacity - 1;
+
+            struct Cell
+            {
+                std::atomic<size_t> sequence;
+                T data;
+            };
+
+            /* Queue cells */
+            std::array<Cell, Capacity> mCells;
+
+            /* Position of next push */
+            std::atomic<size_t> mEnqueuePosition;
+
+            /* Position of next pop */
+            std::atomic<size_t> mDequeuePosition;
+        };
+    } // namespace Concurrency
+} // namespace Utility
+
+#endif // MPMC_QUEUE_H
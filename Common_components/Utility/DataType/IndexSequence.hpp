@@ -0,0 +1,35 @@
+#ifndef INDEX_SEQUENCE_H
+#define INDEX_SEQUENCE_H
+
+/* STD library */
+#include <cstddef>
+
+namespace Utility
+{
+    namespace DataType
+    {
+        /**
+         * @brief Compile time sequence of indexes, used to expand constexpr arrays element by element
+         */
+        template <size_t... Indexes>
+        struct IndexSequence
+        {
+        };
+
+        /**
+         * @brief Build IndexSequence<0, ..., Count - 1>
+         */
+        template <size_t Count, size_t... Indexes>
+        struct MakeIndexSequence : MakeIndexSequence<Count - 1, Count - 1, Indexes...>
+        {
+        };
+
+        template <size_t... Indexes>
+        struct MakeIndexSequence<0, Indexes...>
+        {
+            using Type = IndexSequence<Indexes...>;
+        };
+    } // namespace DataType
+} // namespace Utility
+
+#endif // INDEX_SEQUENCE_H
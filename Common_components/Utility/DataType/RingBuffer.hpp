@@ -0,0 +1,138 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+
+namespace Utility
+{
+    namespace DataType
+    {
+        /**
+         * @brief Fixed capacity ring buffer. When buffer is full the oldest item is overwritten.
+         *        Buffer is not thread safe, caller is responsible for locking.
+         *
+         * @tparam T        : Item type
+         * @tparam Capacity : Maximum number of items
+         */
+        template <class T, size_t Capacity>
+        class RingBuffer
+        {
+            static_assert(Capacity > 0, "Ring buffer capacity must be greater than zero");
+
+        public:
+            /**
+             * @brief Class constructor
+             */
+            explicit RingBuffer() : mHead(0), mSize(0) {}
+
+            /**
+             * @brief Class destructor
+             */
+            ~RingBuffer() {}
+
+            /**
+             * @brief Push item at the end of buffer
+             *
+             * @param[in] item  : Item to push
+             *
+             * @return bool     : True  - the oldest item was overwritten
+             *                    False - otherwise
+             */
+            bool Push(const T &item)
+            {
+                mBuffer[(mHead + mSize) % Capacity] = item;
+
+                if (mSize < Capacity)
+                {
+                    ++mSize;
+                    return false;
+                }
+
+                mHead = (mHead + 1) % Capacity;
+                return true;
+            }
+
+            /**
+             * @brief Remove items from the beginning of buffer
+             *
+             * @param[in] count : Number of items to remove
+             */
+            void PopFront(size_t count = 1)
+            {
+                if (count > mSize)
+                    count = mSize;
+
+                mHead = (mHead + count) % Capacity;
+                mSize -= count;
+            }
+
+            /**
+             * @brief Get item on position counted from the oldest one
+             *
+             * @param[in] index : Position of item
+             *
+             * @return T&       : Reference to item
+             */
+            T &At(const size_t index) { return mBuffer[(mHead + index) % Capacity]; }
+
+            /**
+             * @brief Get item on position counted from the oldest one
+             *
+             * @param[in] index : Position of item
+             *
+             * @return const T& : Const reference to item
+             */
+            const T &At(const size_t index) const { return mBuffer[(mHead + index) % Capacity]; }
+
+            /**
+             * @brief Get the newest item
+             *
+             * @return const T& : Const reference to item
+             */
+            const T &Back() const { return At(mSize - 1); }
+
+            /**
+             * @brief Remove all items
+             */
+            void Clear()
+            {
+                mHead = 0;
+                mSize = 0;
+            }
+
+            /**
+             * @brief Get number of stored items
+             */
+            size_t Size() const { return mSize; }
+
+            /**
+             * @brief Check if buffer is empty
+             */
+            bool Empty() const { return mSize == 0; }
+
+            /**
+             * @brief Check if buffer is full
+             */
+            bool Full() const { return mSize == Capacity; }
+
+            /**
+             * @brief Get capacity of buffer
+             */
+            static constexpr size_t GetCapacity() { return Capacity; }
+
+        private:
+            /* Item storage */
+            std::array<T, Capacity> mBuffer;
+
+            /* Position of the oldest item */
+            size_t mHead;
+
+            /* Number of stored items */
+            size_t mSize;
+        };
+    } // namespace DataType
+} // namespace Utility
+
+#endif // RING_BUFFER_H
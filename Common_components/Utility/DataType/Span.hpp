@@ -0,0 +1,124 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Utility
+{
+    namespace DataType
+    {
+        /**
+         * @brief Non-owning view over contiguous sequence of items
+         *
+         * @tparam T    : Item type. Use const type for read only view
+         */
+        template <class T>
+        class Span
+        {
+        public:
+            using element_type = T;
+            using value_type = typename std::remove_cv<T>::type;
+            using iterator = T *;
+
+            /**
+             * @brief Class constructor of empty view
+             */
+            constexpr Span() : mData(nullptr), mSize(0) {}
+
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] data  : Pointer to first item
+             * @param[in] size  : Number of items
+             */
+            constexpr Span(T *data, size_t size) : mData(data), mSize(data ? size : 0) {}
+
+            /**
+             * @brief Class constructor from C array
+             */
+            template <size_t N>
+            constexpr Span(T (&array)[N]) : mData(array), mSize(N) {}
+
+            /**
+             * @brief Class constructor from std::array
+             */
+            template <size_t N>
+            Span(std::array<value_type, N> &array) : mData(array.data()), mSize(N) {}
+
+            /**
+             * @brief Class constructor from const std::array
+             */
+            template <size_t N>
+            Span(const std::array<value_type, N> &array) : mData(array.data()), mSize(N) {}
+
+            /**
+             * @brief Class constructor from vector
+             */
+            Span(std::vector<value_type> &vector) : mData(vector.data()), mSize(vector.size()) {}
+
+            /**
+             * @brief Class constructor from const vector
+             */
+            Span(const std::vector<value_type> &vector) : mData(vector.data()), mSize(vector.size()) {}
+
+            /**
+             * @brief Conversion from span of non-const items to span of const items
+             */
+            template <class U, class = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+            constexpr Span(const Span<U> &other) : mData(other.data()), mSize(other.size()) {}
+
+            constexpr T *data() const { return mData; }
+            constexpr size_t size() const { return mSize; }
+            constexpr bool empty() const { return mSize == 0; }
+
+            constexpr iterator begin() const { return mData; }
+            constexpr iterator end() const { return mData + mSize; }
+
+            /**
+             * @brief Access item without bounds checking
+             */
+            constexpr T &operator[](const size_t index) const { return mData[index]; }
+
+            /**
+             * @brief Get view starting at offset. Result is clamped to the end of view
+             *
+             * @param[in] offset    : First item of new view
+             * @param[in] count     : Maximum number of items in new view
+             *
+             * @return Span         : New view
+             */
+            Span Subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const
+            {
+                if (offset > mSize)
+                    offset = mSize;
+
+                if (count > mSize - offset)
+                    count = mSize - offset;
+
+                return Span(mData + offset, count);
+            }
+
+            /**
+             * @brief Get view of first items
+             */
+            Span First(const size_t count) const { return Subspan(0, count); }
+
+        private:
+            /* Pointer to first item */
+            T *mData;
+
+            /* Number of items */
+            size_t mSize;
+        };
+
+        /* Read only view over bytes */
+        using ByteView = Span<const uint8_t>;
+    } // namespace DataType
+} // namespace Utility
+
+#endif // SPAN_H
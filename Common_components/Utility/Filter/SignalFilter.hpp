@@ -0,0 +1,92 @@
+#ifndef SIGNAL_FILTER_H
+#define SIGNAL_FILTER_H
+
+/* STD library */
+#include <algorithm>
+#include <cstddef>
+
+/* Common components */
+#include "Common_components/Utility/DataType/Span.hpp"
+
+namespace Utility
+{
+    namespace Filter
+    {
+        /**
+         * @brief Get median of samples. Samples are reordered, upper median is returned for even count
+         *
+         * @param[in/out] samples   : Samples, must not be empty
+         *
+         * @return T                : Median
+         */
+        template <class T>
+        T Median(DataType::Span<T> samples)
+        {
+            const auto middle = samples.begin() + samples.size() / 2;
+            std::nth_element(samples.begin(), middle, samples.end());
+
+            return *middle;
+        }
+
+        /**
+         * @brief First order IIR low pass filter, y += alpha * (x - y). The first sample initializes output
+         */
+        class ExponentialFilter
+        {
+        public:
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] alpha : Weight of new sample in range (0, 1>
+             */
+            explicit ExponentialFilter(float alpha) : mAlpha(alpha), mValue(0.0f), mPrimed(false) {}
+
+            /**
+             * @brief Add sample
+             *
+             * @param[in] sample    : New sample
+             *
+             * @return float        : Filtered value
+             */
+            float Update(float sample)
+            {
+                if (!mPrimed)
+                {
+                    mValue = sample;
+                    mPrimed = true;
+                }
+                else
+                    mValue += mAlpha * (sample - mValue);
+
+                return mValue;
+            }
+
+            /**
+             * @brief Get filtered value
+             */
+            float Value() const { return mValue; }
+
+            /**
+             * @brief Check if filter has received any sample
+             */
+            bool IsPrimed() const { return mPrimed; }
+
+            /**
+             * @brief Forget filtered value, next sample initializes output
+             */
+            void Reset() { mPrimed = false; }
+
+        private:
+            /* Weight of new sample */
+            float mAlpha;
+
+            /* Filtered value */
+            float mValue;
+
+            /* Filter has received sample */
+            bool mPrimed;
+        };
+    } // namespace Filter
+} // namespace Utility
+
+#endif // SIGNAL_FILTER_H
@@ -0,0 +1,272 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Utility
+{
+    namespace Memory
+    {
+        /**
+         * @brief Fixed capacity pool of objects. Storage for all objects is reserved up front,
+         *        so acquiring and releasing object never touch the heap.
+         *
+         * @tparam T        : Object type
+         * @tparam Capacity : Maximum number of living objects
+         */
+        template <class T, size_t Capacity>
+        class ObjectPool
+        {
+            static_assert(Capacity > 0, "Object pool capacity must be greater than zero");
+            static_assert(Capacity <= UINT16_MAX, "Object pool capacity is limited to 65535 objects");
+
+        public:
+            /**
+             * @brief Move-only owner of object acquired from pool. Object is returned to pool
+             *        when handle is destroyed or reset
+             */
+            class Handle
+            {
+            public:
+                /**
+                 * @brief Class constructor of empty handle
+                 */
+                Handle() : mPool(nullptr), mObject(nullptr) {}
+
+                /**
+                 * @brief Class constructor
+                 *
+                 * @param[in] pool      : Pool which owns object
+                 * @param[in] object    : Object acquired from pool
+                 */
+                Handle(ObjectPool *pool, T *object) : mPool(pool), mObject(object) {}
+
+                /**
+                 * @brief Move constructor
+                 */
+                Handle(Handle &&other) : mPool(other.mPool), mObject(other.Detach()) {}
+
+                /**
+                 * @brief Move assignment operator
+                 */
+                Handle &operator=(Handle &&other)
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        mPool = other.mPool;
+                        mObject = other.Detach();
+                    }
+
+                    return *this;
+                }
+
+                /**
+                 * @brief Class destructor
+                 */
+                ~Handle() { Reset(); }
+
+                Handle(const Handle &) = delete;
+                Handle &operator=(const Handle &) = delete;
+
+                /**
+                 * @brief Get owned object
+                 */
+                T *Get() const { return mObject; }
+
+                T *operator->() const { return mObject; }
+                T &operator*() const { return *mObject; }
+                explicit operator bool() const { return mObject != nullptr; }
+
+                /**
+                 * @brief Give up ownership without releasing object. Caller must release it to pool
+                 *
+                 * @return T*   : Previously owned object
+                 */
+                T *Detach()
+                {
+                    auto object = mObject;
+                    mObject = nullptr;
+                    return object;
+                }
+
+                /**
+                 * @brief Release owned object back to pool
+                 */
+                void Reset()
+                {
+                    if (mObject && mPool)
+                        mPool->Release(mObject);
+
+                    mObject = nullptr;
+                }
+
+            private:
+                /* Pool which owns object */
+                ObjectPool *mPool;
+
+                /* Owned object */
+                T *mObject;
+            };
+
+            /**
+             * @brief Class constructor
+             */
+            explicit ObjectPool() : mFreeCount(Capacity), mPeak(0), mFailed(0)
+            {
+                for (size_t i = 0; i < Capacity; ++i)
+                    mFreeSlots[i] = static_cast<uint16_t>(Capacity - 1 - i);
+            }
+
+            /**
+             * @brief Class destructor. Objects which were not released are not destroyed
+             */
+            ~ObjectPool() {}
+
+            ObjectPool(const ObjectPool &) = delete;
+            ObjectPool &operator=(const ObjectPool &) = delete;
+
+            /**
+             * @brief Construct object in free slot of pool
+             *
+             * @param[in] args  : Arguments passed to object constructor
+             *
+             * @return T*       : Pointer to constructed object
+             *                    nullptr - when pool is exhausted
+             */
+            template <typename... Args>
+            T *Acquire(Args &&...args)
+            {
+                uint16_t slot;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (!mFreeCount)
+                    {
+                        ++mFailed;
+                        return nullptr;
+                    }
+
+                    slot = mFreeSlots[--mFreeCount];
+
+                    if (Capacity - mFreeCount > mPeak)
+                        mPeak = Capacity - mFreeCount;
+                }
+
+                return new (&mStorage[slot]) T(std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Construct object in free slot of pool and wrap it into owning handle
+             *
+             * @param[in] args  : Arguments passed to object constructor
+             *
+             * @return Handle   : Handle of constructed object. Empty when pool is exhausted
+             */
+            template <typename... Args>
+            Handle AcquireHandle(Args &&...args)
+            {
+                return Handle(this, Acquire(std::forward<Args>(args)...));
+            }
+
+            /**
+             * @brief Destroy object and return its slot to pool
+             *
+             * @param[in] object    : Object acquired from this pool
+             *
+             * @return bool         : True  - object was released
+             *                        False - object does not belong to pool
+             */
+            bool Release(T *object)
+            {
+                if (!Owns(object))
+                    return false;
+
+                object->~T();
+
+                std::lock_guard<std::mutex> lock(mMutex);
+                mFreeSlots[mFreeCount++] = static_cast<uint16_t>(reinterpret_cast<Storage *>(object) - mStorage.data());
+                return true;
+            }
+
+            /**
+             * @brief Check if object lives in storage of pool
+             *
+             * @param[in] object    : Object to check
+             *
+             * @return bool         : True  - object belongs to pool
+             *                        False - otherwise
+             */
+            bool Owns(const T *object) const
+            {
+                const auto address = reinterpret_cast<uintptr_t>(object);
+                const auto begin = reinterpret_cast<uintptr_t>(mStorage.data());
+                const auto end = reinterpret_cast<uintptr_t>(mStorage.data() + Capacity);
+
+                return address >= begin && address < end && (address - begin) % sizeof(Storage) == 0;
+            }
+
+            /**
+             * @brief Get number of acquired objects
+             */
+            size_t InUse() const
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return Capacity - mFreeCount;
+            }
+
+            /**
+             * @brief Get the highest number of objects acquired at the same time
+             */
+            size_t Peak() const
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mPeak;
+            }
+
+            /**
+             * @brief Get number of acquisitions failed due to exhausted pool
+             */
+            size_t Failed() const
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mFailed;
+            }
+
+            /**
+             * @brief Get capacity of pool
+             */
+            static constexpr size_t GetCapacity() { return Capacity; }
+
+        private:
+            /* Raw storage for one object */
+            using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+            /* Object storage */
+            std::array<Storage, Capacity> mStorage;
+
+            /* Stack of free slot indexes */
+            std::array<uint16_t, Capacity> mFreeSlots;
+
+            /* Number of free slots */
+            size_t mFreeCount;
+
+            /* Highest number of acquired objects */
+            size_t mPeak;
+
+            /* Number of failed acquisitions */
+            size_t mFailed;
+
+            /* Mutex to protect free slots */
+            mutable std::mutex mMutex;
+        };
+    } // namespace Memory
+} // namespace Utility
+
+#endif // OBJECT_POOL_H
@@ -82,6 +82,14 @@ int MQTT_Client::Publish(const std::string &topic, const std::string &data, int
   return esp_mqtt_client_publish(mClient, topic.c_str(), data.c_str(), data.size(), QoS, retain);
 }
 
+/**
+ * @brief Client publish message from raw buffer to MQTT broker
+ */
+int MQTT_Client::Publish(const std::string &topic, const char *data, size_t length, int QoS, bool retain)
+{
+  return esp_mqtt_client_publish(mClient, topic.c_str(), data, length, QoS, retain);
+}
+
 /**
  * @brief Client subscribe defined topic
  */
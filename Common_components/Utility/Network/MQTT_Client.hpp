@@ -73,6 +73,19 @@ namespace Utility
        */
       int Publish(const std::string &topic, const std::string &data, int QoS, bool retain = false);
 
+      /**
+       * @brief Client publish message from raw buffer to MQTT broker
+       *
+       * @param[in] topic  : MQTT topic
+       * @param[in] data   : Data
+       * @param[in] length : Length of data
+       * @param[in] QoS    : Quality of Service
+       * @param[in] retain : Retain flag (Default false)
+       *
+       * @return int  : Message ID
+       */
+      int Publish(const std::string &topic, const char *data, size_t length, int QoS, bool retain = false);
+
       /**
        * @brief Client subscribe defined topic
        *
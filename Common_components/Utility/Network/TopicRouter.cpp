@@ -0,0 +1,193 @@
+#include "TopicRouter.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
+
+/* STD library */
+#include <cstring>
+
+// Index of missing node or route
+#define TOPIC_ROUTER_NONE static_cast<size_t>(-1)
+
+using namespace Utility::Network;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Find child of node with given level or create it
+ */
+size_t TopicRouter::GetChild(size_t parent, const char *level, size_t length)
+{
+  Level kind = Level::EXACT;
+  if (length == 1 && *level == '+')
+    kind = Level::SINGLE_WILDCARD;
+  else if (length == 1 && *level == '#')
+    kind = Level::MULTI_WILDCARD;
+
+  auto last = TOPIC_ROUTER_NONE;
+  for (auto child = mNodes[parent].firstChild; child != TOPIC_ROUTER_NONE; child = mNodes[child].nextSibling)
+  {
+    const auto &node = mNodes[child];
+    if (node.kind == kind && (kind != Level::EXACT ||
+                              (node.length == length && !mLevels.compare(node.text, length, level, length))))
+      return child;
+
+    last = child;
+  }
+
+  mNodes.push_back({kind, mLevels.size(), length, TOPIC_ROUTER_NONE, TOPIC_ROUTER_NONE, TOPIC_ROUTER_NONE});
+  if (kind == Level::EXACT)
+    mLevels.append(level, length);
+
+  const auto index = mNodes.size() - 1;
+  if (last == TOPIC_ROUTER_NONE)
+    mNodes[parent].firstChild = index;
+  else
+    mNodes[last].nextSibling = index;
+
+  return index;
+}
+
+/**
+ * @brief Match levels of topic from position against children of node
+ */
+size_t TopicRouter::Match(size_t parent, TopicView topic, size_t position, TopicView payload) const
+{
+  auto end = position;
+  while (end < topic.size() && topic[end] != '/')
+    ++end;
+
+  const bool last = end == topic.size();
+
+  // Wildcard at first level does not match topics starting with '$'
+  const bool system = !position && topic.size() && topic[0] == '$';
+
+  size_t called = 0;
+  for (auto child = mNodes[parent].firstChild; child != TOPIC_ROUTER_NONE; child = mNodes[child].nextSibling)
+  {
+    const auto &node = mNodes[child];
+    switch (node.kind)
+    {
+    case (Level::MULTI_WILDCARD):
+      if (!system)
+        called += Invoke(node, topic, payload);
+      continue;
+    case (Level::SINGLE_WILDCARD):
+      if (system)
+        continue;
+      break;
+    case (Level::EXACT):
+      if (node.length != end - position || mLevels.compare(node.text, node.length, topic.data() + position, node.length))
+        continue;
+      break;
+    }
+
+    if (!last)
+    {
+      called += Match(child, topic, end + 1, payload);
+      continue;
+    }
+
+    called += Invoke(node, topic, payload);
+
+    // "level/#" matches the level itself as well
+    for (auto next = node.firstChild; next != TOPIC_ROUTER_NONE; next = mNodes[next].nextSibling)
+    {
+      if (mNodes[next].kind == Level::MULTI_WILDCARD)
+        called += Invoke(mNodes[next], topic, payload);
+    }
+  }
+
+  return called;
+}
+
+/**
+ * @brief Call handler of route ending in node
+ */
+size_t TopicRouter::Invoke(const Node &node, TopicView topic, TopicView payload) const
+{
+  if (node.route == TOPIC_ROUTER_NONE)
+    return 0;
+
+  const auto &route = mRoutes[node.route];
+  route.handler(topic, payload, route.context);
+  return 1;
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+TopicRouter::TopicRouter()
+{
+  mNodes.push_back({Level::EXACT, 0, 0, TOPIC_ROUTER_NONE, TOPIC_ROUTER_NONE, TOPIC_ROUTER_NONE});
+}
+
+/**
+ * @brief Class destructor
+ */
+TopicRouter::~TopicRouter()
+{
+}
+
+/**
+ * @brief Register handler for topic filter
+ */
+bool TopicRouter::Register(const char *filter, Handler_T handler, void *context)
+{
+  if (!filter || !*filter || !handler)
+    return false;
+
+  const auto length = strlen(filter);
+
+  // Validate wildcards before trie is modified
+  for (size_t i = 0; i < length; ++i)
+  {
+    if (filter[i] != '+' && filter[i] != '#')
+      continue;
+
+    const bool alone = (!i || filter[i - 1] == '/') && (i + 1 == length || filter[i + 1] == '/');
+    if (!alone || (filter[i] == '#' && i + 1 != length))
+    {
+      ESP_LOGE(TOPIC_ROUTER_TAG, "Invalid topic filter \"%s\"", filter);
+      return false;
+    }
+  }
+
+  size_t node = 0;
+  size_t begin = 0;
+  for (size_t end = 0; end <= length; ++end)
+  {
+    if (end != length && filter[end] != '/')
+      continue;
+
+    node = GetChild(node, filter + begin, end - begin);
+    begin = end + 1;
+  }
+
+  if (mNodes[node].route != TOPIC_ROUTER_NONE)
+  {
+    ESP_LOGE(TOPIC_ROUTER_TAG, "Topic filter \"%s\" is already registered", filter);
+    return false;
+  }
+
+  mNodes[node].route = mRoutes.size();
+  mRoutes.push_back({filter, handler, context});
+  return true;
+}
+
+/**
+ * @brief Dispatch message to handlers of all matching filters
+ */
+size_t TopicRouter::Dispatch(TopicView topic, TopicView payload) const
+{
+  if (!topic.data() || !topic.size())
+    return 0;
+
+  return Match(0, topic, 0, payload);
+}
@@ -0,0 +1,132 @@
+#ifndef TOPIC_ROUTER_H
+#define TOPIC_ROUTER_H
+
+/* STD library */
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/* Common components */
+#include "Common_components/Utility/DataType/Span.hpp"
+
+#define TOPIC_ROUTER_TAG "Topic router"
+
+namespace Utility
+{
+  namespace Network
+  {
+    /* View of topic or payload in buffer of received message */
+    using TopicView = Utility::DataType::Span<const char>;
+
+    /**
+     * @brief Router of received MQTT messages to handlers registered for topic filters.
+     *        Filters are stored in trie with one node per topic level and support MQTT wildcards:
+     *        "+" matches exactly one level and "#" as the last level matches any number of levels,
+     *        including the parent level. Filters are registered once at startup, dispatch does not allocate.
+     */
+    class TopicRouter
+    {
+    public:
+      /* Handler of message. Topic and payload are valid only during call */
+      using Handler_T = void (*)(TopicView topic, TopicView payload, void *context);
+
+      /**
+       * @brief Class constructor
+       */
+      explicit TopicRouter();
+
+      /**
+       * @brief Class destructor
+       */
+      ~TopicRouter();
+
+      /**
+       * @brief Register handler for topic filter
+       *
+       * @param[in] filter  : Topic filter, may contain wildcards
+       * @param[in] handler : Handler called for every message matching filter
+       * @param[in] context : Context passed to handler
+       *
+       * @return bool       : True  - Handler was registered
+       *                      False - Filter is invalid or already registered
+       */
+      bool Register(const char *filter, Handler_T handler, void *context);
+
+      /**
+       * @brief Dispatch message to handlers of all matching filters
+       *
+       * @param[in] topic   : Topic of message
+       * @param[in] payload : Payload of message
+       *
+       * @return size_t     : Number of called handlers
+       */
+      size_t Dispatch(TopicView topic, TopicView payload) const;
+
+      /**
+       * @brief Get number of registered filters
+       */
+      size_t GetFilterCount() const { return mRoutes.size(); }
+
+      /**
+       * @brief Get registered filter, used to subscribe all filters at broker
+       *
+       * @param[in] index   : Index of filter
+       */
+      const std::string &GetFilter(size_t index) const { return mRoutes[index].filter; }
+
+    private:
+      /* Kind of topic level */
+      enum class Level
+      {
+        EXACT,
+        SINGLE_WILDCARD, // <- "+"
+        MULTI_WILDCARD,  // <- "#"
+      };
+
+      /* Node of trie */
+      struct Node
+      {
+        Level kind;
+        size_t text;        // Offset of level text in mLevels
+        size_t length;      // Length of level text
+        size_t firstChild;  // Index of first child node
+        size_t nextSibling; // Index of next node with the same parent
+        size_t route;       // Index of route ending in node
+      };
+
+      /* Registered filter */
+      struct Route
+      {
+        std::string filter;
+        Handler_T handler;
+        void *context;
+      };
+
+      /**
+       * @brief Find child of node with given level or create it
+       */
+      size_t GetChild(size_t parent, const char *level, size_t length);
+
+      /**
+       * @brief Match levels of topic from position against children of node
+       */
+      size_t Match(size_t parent, TopicView topic, size_t position, TopicView payload) const;
+
+      /**
+       * @brief Call handler of route ending in node
+       */
+      size_t Invoke(const Node &node, TopicView topic, TopicView payload) const;
+
+      /* Nodes of trie, the first one is root */
+      std::vector<Node> mNodes;
+
+      /* Text of all exact levels */
+      std::string mLevels;
+
+      /* Registered filters */
+      std::vector<Route> mRoutes;
+    };
+  } // namespace Network
+} // namespace Utility
+
+#endif // TOPIC_ROUTER_H
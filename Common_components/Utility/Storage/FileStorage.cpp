@@ -0,0 +1,118 @@
+/* Project specific includes */
+#include "FileStorage.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
+
+/* STD library */
+#include <cstdint>
+#include <vector>
+
+using namespace Utility::Storage;
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+FileStorage::FileStorage(const char *path, size_t sectorSize, size_t sectorCount)
+    : mFile(fopen(path, "r+b")),
+      mSectorSize(sectorSize),
+      mSectorCount(sectorCount)
+{
+    if (mFile)
+    {
+        // Storage grown by configuration is extended by erased sectors
+        fseek(mFile, 0, SEEK_END);
+        const auto size = static_cast<size_t>(ftell(mFile));
+        for (size_t sector = size / mSectorSize; sector < mSectorCount; ++sector)
+            EraseSector(sector);
+
+        return;
+    }
+
+    mFile = fopen(path, "w+b");
+    if (!mFile)
+    {
+        ESP_LOGE(FILE_STORAGE_TAG, "File \"%s\" can not be opened.", path);
+        return;
+    }
+
+    for (size_t sector = 0; sector < mSectorCount; ++sector)
+        EraseSector(sector);
+}
+
+/**
+ * @brief Class destructor
+ */
+FileStorage::~FileStorage()
+{
+    if (mFile)
+        fclose(mFile);
+}
+
+/**
+ * @brief Read data from storage
+ */
+esp_err_t FileStorage::Read(size_t offset, void *data, size_t length)
+{
+    if (!mFile)
+        return ESP_ERR_INVALID_STATE;
+
+    if (offset + length > mSectorSize * mSectorCount)
+        return ESP_ERR_INVALID_SIZE;
+
+    if (fseek(mFile, offset, SEEK_SET) || fread(data, 1, length, mFile) != length)
+        return ESP_FAIL;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Write data into storage
+ */
+esp_err_t FileStorage::Write(size_t offset, const void *data, size_t length)
+{
+    if (!mFile)
+        return ESP_ERR_INVALID_STATE;
+
+    if (offset + length > mSectorSize * mSectorCount)
+        return ESP_ERR_INVALID_SIZE;
+
+    // Flash write only clears bits
+    std::vector<uint8_t> merged(length);
+    if (Read(offset, merged.data(), length) != ESP_OK)
+        return ESP_FAIL;
+
+    const auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < length; ++i)
+        merged[i] &= bytes[i];
+
+    if (fseek(mFile, offset, SEEK_SET) || fwrite(merged.data(), 1, length, mFile) != length)
+        return ESP_FAIL;
+
+    // Written data has to survive crash of application
+    fflush(mFile);
+    return ESP_OK;
+}
+
+/**
+ * @brief Erase one sector
+ */
+esp_err_t FileStorage::EraseSector(size_t sector)
+{
+    if (!mFile)
+        return ESP_ERR_INVALID_STATE;
+
+    if (sector >= mSectorCount)
+        return ESP_ERR_INVALID_ARG;
+
+    const std::vector<uint8_t> erased(mSectorSize, 0xFF);
+    if (fseek(mFile, sector * mSectorSize, SEEK_SET) || fwrite(erased.data(), 1, mSectorSize, mFile) != mSectorSize)
+        return ESP_FAIL;
+
+    fflush(mFile);
+    return ESP_OK;
+}
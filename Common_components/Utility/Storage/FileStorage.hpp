@@ -0,0 +1,65 @@
+#ifndef FILE_STORAGE_H
+#define FILE_STORAGE_H
+
+/* Project specific includes */
+#include "StorageInterface.hpp"
+
+/* STD library */
+#include <cstdio>
+
+#define FILE_STORAGE_TAG "FileStorage"
+
+namespace Utility
+{
+    namespace Storage
+    {
+        /**
+         * @brief Storage backed by file. Emulates flash for host builds,
+         *        so the same data survive restart of host application
+         */
+        class FileStorage : public StorageInterface
+        {
+        public:
+            /**
+             * @brief Class constructor. Missing file is created as erased storage
+             *
+             * @param[in] path          : Path to file
+             * @param[in] sectorSize    : Size of one sector in bytes
+             * @param[in] sectorCount   : Number of sectors
+             */
+            explicit FileStorage(const char *path, size_t sectorSize, size_t sectorCount);
+
+            /**
+             * @brief Class destructor
+             */
+            ~FileStorage();
+
+            /**
+             * @brief Check if file is opened
+             */
+            bool IsValid() const { return mFile != nullptr; }
+
+            esp_err_t Read(size_t offset, void *data, size_t length) override;
+
+            esp_err_t Write(size_t offset, const void *data, size_t length) override;
+
+            esp_err_t EraseSector(size_t sector) override;
+
+            size_t GetSectorSize() const override { return mSectorSize; }
+
+            size_t GetSectorCount() const override { return mSectorCount; }
+
+        private:
+            /* Backing file */
+            FILE *mFile;
+
+            /* Size of one sector */
+            const size_t mSectorSize;
+
+            /* Number of sectors */
+            const size_t mSectorCount;
+        };
+    } // namespace Storage
+} // namespace Utility
+
+#endif // FILE_STORAGE_H
@@ -0,0 +1,427 @@
+/* Project specific includes */
+#include "Outbox.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
+
+/* STD library */
+#include <cstring>
+
+// Magic number of used sector "OBX1"
+#define OUTBOX_SECTOR_MAGIC 0x3158424F
+
+// States of record, every transition only clears bits
+#define OUTBOX_RECORD_EMPTY 0xFF
+#define OUTBOX_RECORD_WRITING 0xFE
+#define OUTBOX_RECORD_VALID 0xFC
+#define OUTBOX_RECORD_CONSUMED 0xF8
+
+// Longest record, length 0xFFFF is reserved for erased flash
+#define OUTBOX_MAX_RECORD_LENGTH 0xFFFE
+
+using namespace Utility::Storage;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Read header of sector
+ */
+bool Outbox::ReadSectorHeader(size_t sector, SectorHeader &header)
+{
+    if (mStorage.Read(sector * mSectorSize, &header, sizeof(header)) != ESP_OK)
+        return false;
+
+    return header.magic == OUTBOX_SECTOR_MAGIC;
+}
+
+/**
+ * @brief Read header of record
+ */
+bool Outbox::ReadRecordHeader(const Position &position, RecordHeader &header)
+{
+    if (position.offset + sizeof(RecordHeader) > mSectorSize)
+        return false;
+
+    if (mStorage.Read(position.sector * mSectorSize + position.offset, &header, sizeof(header)) != ESP_OK)
+        return false;
+
+    if (header.state != OUTBOX_RECORD_WRITING && header.state != OUTBOX_RECORD_VALID && header.state != OUTBOX_RECORD_CONSUMED)
+        return false;
+
+    return position.offset + RecordSize(header.length) <= mSectorSize;
+}
+
+/**
+ * @brief Erase sector and start it with next sequence number
+ */
+esp_err_t Outbox::OpenSector(size_t sector)
+{
+    auto err = mStorage.EraseSector(sector);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(OUTBOX_TAG, "Erase of sector %d failed: %s", static_cast<int>(sector), esp_err_to_name(err));
+        return err;
+    }
+
+    ++mStatistics.erases;
+
+    const SectorHeader header{OUTBOX_SECTOR_MAGIC, mHeadSequence + 1};
+    err = mStorage.Write(sector * mSectorSize, &header, sizeof(header));
+    if (err != ESP_OK)
+        return err;
+
+    mHeadSequence = header.sequence;
+    mHead = {sector, sizeof(SectorHeader)};
+    return ESP_OK;
+}
+
+/**
+ * @brief Drop all valid records of sector
+ */
+void Outbox::DropSector(size_t sector)
+{
+    size_t end, first;
+    uint32_t records, bytes;
+    ScanSector(sector, end, first, records, bytes);
+
+    if (records)
+        ESP_LOGW(OUTBOX_TAG, "Outbox is full, %d oldest records dropped", static_cast<int>(records));
+
+    mStatistics.backlog -= records;
+    mStatistics.backlogBytes -= bytes;
+    mStatistics.dropped += records;
+
+    if (mTail.sector == sector)
+        mTail = {NextSector(sector), sizeof(SectorHeader)};
+}
+
+/**
+ * @brief Scan written part of sector
+ */
+void Outbox::ScanSector(size_t sector, size_t &end, size_t &first, uint32_t &records, uint32_t &bytes)
+{
+    Position position{sector, sizeof(SectorHeader)};
+    RecordHeader header;
+
+    first = mSectorSize;
+    records = 0;
+    bytes = 0;
+
+    while (ReadRecordHeader(position, header))
+    {
+        if (header.state == OUTBOX_RECORD_VALID)
+        {
+            if (first == mSectorSize)
+                first = position.offset;
+
+            ++records;
+            bytes += header.length;
+        }
+
+        position.offset += RecordSize(header.length);
+    }
+
+    end = position.offset;
+
+    // Header torn by power loss, nothing can be written after it until sector is erased
+    if (end + sizeof(RecordHeader) <= mSectorSize)
+    {
+        uint8_t raw[sizeof(RecordHeader)];
+        if (mStorage.Read(sector * mSectorSize + end, raw, sizeof(raw)) != ESP_OK)
+        {
+            end = mSectorSize;
+            return;
+        }
+
+        for (const auto byte : raw)
+        {
+            if (byte != 0xFF)
+            {
+                end = mSectorSize;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Move tail to the oldest valid record
+ */
+bool Outbox::SeekTail(RecordHeader &header)
+{
+    if (!mStatistics.backlog)
+        return false;
+
+    for (;;)
+    {
+        if (ReadRecordHeader(mTail, header))
+        {
+            if (header.state == OUTBOX_RECORD_VALID)
+                return true;
+
+            // Consumed or unfinished record
+            mTail.offset += RecordSize(header.length);
+            continue;
+        }
+
+        if (mTail.sector == mHead.sector)
+            break;
+
+        mTail = {NextSector(mTail.sector), sizeof(SectorHeader)};
+    }
+
+    // Counters do not match storage
+    ESP_LOGE(OUTBOX_TAG, "No record found for backlog of %d records", static_cast<int>(mStatistics.backlog));
+    mStatistics.backlog = 0;
+    mStatistics.backlogBytes = 0;
+    return false;
+}
+
+/**
+ * @brief Compute CRC-32 of data
+ */
+uint32_t Outbox::Crc32(const uint8_t *data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+Outbox::Outbox(StorageInterface &storage)
+    : mStorage(storage),
+      mSectorSize(storage.GetSectorSize()),
+      mSectorCount(storage.GetSectorCount()),
+      mHead{0, 0},
+      mHeadSequence(0),
+      mTail{0, 0},
+      mStatistics{},
+      mInitialized(false)
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+Outbox::~Outbox()
+{
+}
+
+/**
+ * @brief Recover records left in storage
+ */
+esp_err_t Outbox::Init()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mSectorCount < 2 || mSectorSize <= sizeof(SectorHeader) + sizeof(RecordHeader))
+        return ESP_ERR_INVALID_SIZE;
+
+    mStatistics = {};
+    mInitialized = false;
+
+    // Head is sector with the highest sequence number
+    bool found{false};
+    SectorHeader header;
+    for (size_t sector = 0; sector < mSectorCount; ++sector)
+    {
+        if (!ReadSectorHeader(sector, header))
+            continue;
+
+        if (!found || static_cast<int32_t>(header.sequence - mHeadSequence) > 0)
+        {
+            mHead = {sector, 0};
+            mHeadSequence = header.sequence;
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        ESP_LOGI(OUTBOX_TAG, "Formatting outbox of %d sectors", static_cast<int>(mSectorCount));
+
+        mHeadSequence = 0;
+        const auto err = OpenSector(0);
+        if (err != ESP_OK)
+            return err;
+
+        mTail = mHead;
+        mInitialized = true;
+        return ESP_OK;
+    }
+
+    // Walk sectors of ring from the oldest to head
+    bool tailFound{false};
+    const auto headSector = mHead.sector;
+    for (size_t i = 1; i <= mSectorCount; ++i)
+    {
+        const auto sector = (headSector + i) % mSectorCount;
+        if (!ReadSectorHeader(sector, header) || header.sequence != mHeadSequence - (mSectorCount - i))
+            continue;
+
+        size_t end, first;
+        uint32_t records, bytes;
+        ScanSector(sector, end, first, records, bytes);
+
+        mStatistics.backlog += records;
+        mStatistics.backlogBytes += bytes;
+
+        if (!tailFound && records)
+        {
+            mTail = {sector, first};
+            tailFound = true;
+        }
+
+        if (sector == headSector)
+            mHead.offset = end;
+    }
+
+    if (!tailFound)
+        mTail = mHead;
+
+    ESP_LOGI(OUTBOX_TAG, "Recovered %d records", static_cast<int>(mStatistics.backlog));
+
+    mInitialized = true;
+    return ESP_OK;
+}
+
+/**
+ * @brief Append record
+ */
+esp_err_t Outbox::Push(const void *data, size_t length)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mInitialized)
+        return ESP_ERR_INVALID_STATE;
+
+    if (!data || !length || length > GetMaxRecordSize())
+        return ESP_ERR_INVALID_SIZE;
+
+    const auto size = RecordSize(length);
+    if (mHead.offset + size > mSectorSize)
+    {
+        const auto next = NextSector(mHead.sector);
+        if (mStatistics.backlog && mTail.sector == next)
+            DropSector(next);
+
+        const auto err = OpenSector(next);
+        if (err != ESP_OK)
+            return err;
+    }
+
+    // Empty outbox starts at new record
+    if (!mStatistics.backlog)
+        mTail = mHead;
+
+    const auto address = mHead.sector * mSectorSize + mHead.offset;
+    const RecordHeader header{OUTBOX_RECORD_WRITING, 0xFF, static_cast<uint16_t>(length),
+                              Crc32(static_cast<const uint8_t *>(data), length)};
+
+    // Space is consumed even by failed write, flash can not be written twice
+    mHead.offset += size;
+
+    auto err = mStorage.Write(address, &header, sizeof(header));
+    if (err == ESP_OK)
+        err = mStorage.Write(address + sizeof(header), data, length);
+
+    // Record becomes valid only when whole payload is written
+    const uint8_t state{OUTBOX_RECORD_VALID};
+    if (err == ESP_OK)
+        err = mStorage.Write(address, &state, sizeof(state));
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(OUTBOX_TAG, "Write of record failed: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    ++mStatistics.stored;
+    ++mStatistics.backlog;
+    mStatistics.backlogBytes += length;
+    return ESP_OK;
+}
+
+/**
+ * @brief Read the oldest record without removing it
+ */
+size_t Outbox::Peek(void *buffer, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    RecordHeader header;
+    while (SeekTail(header))
+    {
+        if (header.length > size)
+            return 0;
+
+        const auto address = mTail.sector * mSectorSize + mTail.offset + sizeof(RecordHeader);
+        if (mStorage.Read(address, buffer, header.length) == ESP_OK &&
+            Crc32(static_cast<const uint8_t *>(buffer), header.length) == header.crc)
+            return header.length;
+
+        // Damaged record is skipped and stays in storage until its sector is erased
+        ESP_LOGW(OUTBOX_TAG, "Skipping damaged record");
+        mTail.offset += RecordSize(header.length);
+        --mStatistics.backlog;
+        mStatistics.backlogBytes -= header.length;
+        ++mStatistics.corrupted;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Remove the oldest record
+ */
+esp_err_t Outbox::Pop()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    RecordHeader header;
+    if (!SeekTail(header))
+        return ESP_ERR_NOT_FOUND;
+
+    // Record is delivered again after restart when mark is not written
+    const uint8_t state{OUTBOX_RECORD_CONSUMED};
+    const auto err = mStorage.Write(mTail.sector * mSectorSize + mTail.offset, &state, sizeof(state));
+
+    mTail.offset += RecordSize(header.length);
+    --mStatistics.backlog;
+    mStatistics.backlogBytes -= header.length;
+    ++mStatistics.drained;
+
+    return err;
+}
+
+/**
+ * @brief Get largest record which can be stored
+ */
+size_t Outbox::GetMaxRecordSize() const
+{
+    const auto space = mSectorSize - sizeof(SectorHeader) - sizeof(RecordHeader);
+    return space < OUTBOX_MAX_RECORD_LENGTH ? space : OUTBOX_MAX_RECORD_LENGTH;
+}
+
+/**
+ * @brief Get counters of outbox
+ */
+OutboxStatistics Outbox::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStatistics;
+}
@@ -0,0 +1,229 @@
+/**
+ * Store-and-forward outbox persisted in sector based storage
+ *
+ * Records are appended sequentially into ring of sectors. Every sector starts with header holding its
+ * sequence number, so the oldest and the newest sector can be found after restart. Record is valid only
+ * after its state was committed, record torn by power loss is skipped. Consumed record is marked by
+ * clearing bits of its state, sector is erased only when write position wraps onto it again, so every
+ * sector is erased once per pass of the ring.
+ *
+ * @author Dominik Regec
+ */
+#ifndef OUTBOX_H
+#define OUTBOX_H
+
+/* Project specific includes */
+#include "StorageInterface.hpp"
+
+/* STD library */
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#define OUTBOX_TAG "Outbox"
+
+namespace Utility
+{
+    namespace Storage
+    {
+        /* Counters of outbox */
+        struct OutboxStatistics
+        {
+            // Records waiting in outbox
+            uint32_t backlog;
+            // Payload bytes waiting in outbox
+            uint32_t backlogBytes;
+            // Records stored into outbox
+            uint32_t stored;
+            // Records taken out of outbox
+            uint32_t drained;
+            // Records overwritten because outbox was full
+            uint32_t dropped;
+            // Records skipped due to checksum mismatch
+            uint32_t corrupted;
+            // Sectors erased since start
+            uint32_t erases;
+        };
+
+        class Outbox
+        {
+        public:
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] storage   : Storage with at least two sectors
+             */
+            explicit Outbox(StorageInterface &storage);
+
+            /**
+             * @brief Class destructor
+             */
+            ~Outbox();
+
+            /**
+             * @brief Recover records left in storage. Storage without valid sectors is formatted
+             *
+             * @return esp_err_t    ESP_OK                  : Success
+             *                      ESP_ERR_INVALID_SIZE    : Storage is too small
+             *                      Error of storage otherwise
+             */
+            esp_err_t Init();
+
+            /**
+             * @brief Append record. When outbox is full the oldest sector is dropped
+             *
+             * @param[in] data      : Record data
+             * @param[in] length    : Length of record
+             *
+             * @return esp_err_t    ESP_OK                  : Record was stored
+             *                      ESP_ERR_INVALID_STATE   : Outbox is not initialized
+             *                      ESP_ERR_INVALID_SIZE    : Record does not fit into one sector
+             *                      Error of storage otherwise
+             */
+            esp_err_t Push(const void *data, size_t length);
+
+            /**
+             * @brief Read the oldest record without removing it
+             *
+             * @param[out] buffer   : Output buffer
+             * @param[in] size      : Size of output buffer
+             *
+             * @return size_t       : Length of record, zero when outbox is empty or record does not fit into buffer
+             */
+            size_t Peek(void *buffer, size_t size);
+
+            /**
+             * @brief Remove the oldest record. Should be called after record returned by Peek was delivered
+             *
+             * @return esp_err_t    ESP_OK              : Record was removed
+             *                      ESP_ERR_NOT_FOUND   : Outbox is empty
+             */
+            esp_err_t Pop();
+
+            /**
+             * @brief Check if outbox is empty
+             */
+            bool IsEmpty() const { return !mStatistics.backlog; }
+
+            /**
+             * @brief Get largest record which can be stored
+             */
+            size_t GetMaxRecordSize() const;
+
+            /**
+             * @brief Get counters of outbox
+             */
+            OutboxStatistics GetStatistics();
+
+        private:
+            /* Header at start of every used sector */
+            struct SectorHeader
+            {
+                uint32_t magic;
+                uint32_t sequence;
+            };
+
+            /* Header of every record */
+            struct RecordHeader
+            {
+                uint8_t state;
+                uint8_t reserved;
+                uint16_t length;
+                uint32_t crc;
+            };
+
+            /* Position in storage */
+            struct Position
+            {
+                size_t sector;
+                size_t offset;
+            };
+
+            /**
+             * @brief Read header of sector
+             *
+             * @return bool : True when sector holds valid header
+             */
+            bool ReadSectorHeader(size_t sector, SectorHeader &header);
+
+            /**
+             * @brief Read header of record
+             *
+             * @return bool : True when record header is present at position
+             */
+            bool ReadRecordHeader(const Position &position, RecordHeader &header);
+
+            /**
+             * @brief Erase sector and start it with next sequence number
+             */
+            esp_err_t OpenSector(size_t sector);
+
+            /**
+             * @brief Drop all valid records of sector
+             */
+            void DropSector(size_t sector);
+
+            /**
+             * @brief Scan written part of sector
+             *
+             * @param[in] sector    : Sector index
+             * @param[out] end      : Offset where next record can be written, sector size when sector is full
+             * @param[out] first    : Offset of the first valid record, sector size when there is none
+             * @param[out] records  : Number of valid records
+             * @param[out] bytes    : Payload bytes of valid records
+             */
+            void ScanSector(size_t sector, size_t &end, size_t &first, uint32_t &records, uint32_t &bytes);
+
+            /**
+             * @brief Move tail to the oldest valid record
+             *
+             * @return bool : True when valid record was found
+             */
+            bool SeekTail(RecordHeader &header);
+
+            /**
+             * @brief Get next sector in ring
+             */
+            size_t NextSector(size_t sector) const { return (sector + 1) % mSectorCount; }
+
+            /**
+             * @brief Get size of record in storage
+             */
+            static size_t RecordSize(size_t length) { return sizeof(RecordHeader) + ((length + 3) & ~static_cast<size_t>(3)); }
+
+            /**
+             * @brief Compute CRC-32 of data
+             */
+            static uint32_t Crc32(const uint8_t *data, size_t length);
+
+            /* Backing storage */
+            StorageInterface &mStorage;
+
+            /* Size of one sector */
+            const size_t mSectorSize;
+
+            /* Number of sectors */
+            const size_t mSectorCount;
+
+            /* Position of next written record */
+            Position mHead;
+
+            /* Sequence number of head sector */
+            uint32_t mHeadSequence;
+
+            /* Position of the oldest record */
+            Position mTail;
+
+            /* Counters */
+            OutboxStatistics mStatistics;
+
+            /* True when outbox was initialized */
+            bool mInitialized;
+
+            /* Mutex to protect outbox from multithread access */
+            std::mutex mMutex;
+        };
+    } // namespace Storage
+} // namespace Utility
+
+#endif // OUTBOX_H
@@ -0,0 +1,76 @@
+/* Project specific includes */
+#include "PartitionStorage.hpp"
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+
+/* ESP log library */
+#include <esp_log.h>
+
+using namespace Utility::Storage;
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+PartitionStorage::PartitionStorage(const char *label, size_t maxSectors)
+    : mPartition(esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label)),
+      mSectorCount(0)
+{
+    if (!mPartition)
+    {
+        ESP_LOGE(PARTITION_STORAGE_TAG, "Partition \"%s\" not found.", label);
+        return;
+    }
+
+    mSectorCount = mPartition->size / SPI_FLASH_SEC_SIZE;
+    if (maxSectors && maxSectors < mSectorCount)
+        mSectorCount = maxSectors;
+}
+
+/**
+ * @brief Class destructor
+ */
+PartitionStorage::~PartitionStorage()
+{
+}
+
+/**
+ * @brief Read data from storage
+ */
+esp_err_t PartitionStorage::Read(size_t offset, void *data, size_t length)
+{
+    if (!mPartition)
+        return ESP_ERR_INVALID_STATE;
+
+    return esp_partition_read(mPartition, offset, data, length);
+}
+
+/**
+ * @brief Write data into storage
+ */
+esp_err_t PartitionStorage::Write(size_t offset, const void *data, size_t length)
+{
+    if (!mPartition)
+        return ESP_ERR_INVALID_STATE;
+
+    return esp_partition_write(mPartition, offset, data, length);
+}
+
+/**
+ * @brief Erase one sector
+ */
+esp_err_t PartitionStorage::EraseSector(size_t sector)
+{
+    if (!mPartition)
+        return ESP_ERR_INVALID_STATE;
+
+    if (sector >= mSectorCount)
+        return ESP_ERR_INVALID_ARG;
+
+    return esp_partition_erase_range(mPartition, sector * SPI_FLASH_SEC_SIZE, SPI_FLASH_SEC_SIZE);
+}
+
+#endif // CONFIG_IDF_TARGET_LINUX
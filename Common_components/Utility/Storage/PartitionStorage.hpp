@@ -0,0 +1,67 @@
+#ifndef PARTITION_STORAGE_H
+#define PARTITION_STORAGE_H
+
+/* Project specific includes */
+#include "StorageInterface.hpp"
+
+/* SDK config */
+#include "sdkconfig.h"
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+
+/* ESP partition */
+#include "esp_partition.h"
+
+#define PARTITION_STORAGE_TAG "PartitionStorage"
+
+namespace Utility
+{
+    namespace Storage
+    {
+        /**
+         * @brief Storage backed by data partition in flash
+         */
+        class PartitionStorage : public StorageInterface
+        {
+        public:
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] label         : Label of data partition
+             * @param[in] maxSectors    : Maximum number of used sectors. Zero uses whole partition
+             */
+            explicit PartitionStorage(const char *label, size_t maxSectors = 0);
+
+            /**
+             * @brief Class destructor
+             */
+            ~PartitionStorage();
+
+            /**
+             * @brief Check if partition was found
+             */
+            bool IsValid() const { return mPartition != nullptr; }
+
+            esp_err_t Read(size_t offset, void *data, size_t length) override;
+
+            esp_err_t Write(size_t offset, const void *data, size_t length) override;
+
+            esp_err_t EraseSector(size_t sector) override;
+
+            size_t GetSectorSize() const override { return SPI_FLASH_SEC_SIZE; }
+
+            size_t GetSectorCount() const override { return mSectorCount; }
+
+        private:
+            /* Data partition */
+            const esp_partition_t *mPartition;
+
+            /* Number of used sectors */
+            size_t mSectorCount;
+        };
+    } // namespace Storage
+} // namespace Utility
+
+#endif // CONFIG_IDF_TARGET_LINUX
+
+#endif // PARTITION_STORAGE_H
@@ -0,0 +1,70 @@
+#ifndef STORAGE_INTERFACE_H
+#define STORAGE_INTERFACE_H
+
+/* ESP error codes */
+#include "esp_err.h"
+
+/* STD library */
+#include <cstddef>
+
+namespace Utility
+{
+    namespace Storage
+    {
+        /**
+         * @brief Sector based storage with flash semantics. Erased sector reads as 0xFF and write
+         *        can only clear bits, so already written byte may be written again only with subset of its bits
+         */
+        class StorageInterface
+        {
+        public:
+            /**
+             * @brief Class destructor
+             */
+            virtual ~StorageInterface() = default;
+
+            /**
+             * @brief Read data from storage
+             *
+             * @param[in] offset    : Offset from start of storage
+             * @param[out] data     : Output buffer
+             * @param[in] length    : Number of bytes to read
+             *
+             * @return esp_err_t    : ESP_OK on success
+             */
+            virtual esp_err_t Read(size_t offset, void *data, size_t length) = 0;
+
+            /**
+             * @brief Write data into storage
+             *
+             * @param[in] offset    : Offset from start of storage
+             * @param[in] data      : Data
+             * @param[in] length    : Number of bytes to write
+             *
+             * @return esp_err_t    : ESP_OK on success
+             */
+            virtual esp_err_t Write(size_t offset, const void *data, size_t length) = 0;
+
+            /**
+             * @brief Erase one sector
+             *
+             * @param[in] sector    : Index of sector
+             *
+             * @return esp_err_t    : ESP_OK on success
+             */
+            virtual esp_err_t EraseSector(size_t sector) = 0;
+
+            /**
+             * @brief Get size of one sector in bytes
+             */
+            virtual size_t GetSectorSize() const = 0;
+
+            /**
+             * @brief Get number of sectors
+             */
+            virtual size_t GetSectorCount() const = 0;
+        };
+    } // namespace Storage
+} // namespace Utility
+
+#endif // STORAGE_INTERFACE_H
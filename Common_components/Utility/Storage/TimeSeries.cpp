@@ -0,0 +1,495 @@
+/* Project specific includes */
+#include "TimeSeries.hpp"
+
+/* STD library */
+#include <cstring>
+#include <limits>
+
+using namespace Utility::Storage;
+
+// Bits of the first sample of block, raw timestamp and value
+static constexpr uint16_t FIRST_SAMPLE_BITS = 64;
+
+// The longest encoded sample, '1111' with 32 bits of delta of delta and '11' with window and 32 bits of XOR
+static constexpr uint16_t MAX_SAMPLE_BITS = 4 + 32 + 2 + 5 + 5 + 32;
+
+// Capacity of block in bits
+static constexpr uint16_t BLOCK_BITS = TIMESERIES_BLOCK_SIZE * 8;
+
+static_assert(BLOCK_BITS >= FIRST_SAMPLE_BITS + MAX_SAMPLE_BITS, "Time series block must hold at least two samples");
+static_assert(TIMESERIES_BLOCKS < TIMESERIES_NONE && TIMESERIES_MAX_SERIES < TIMESERIES_NONE, "Time series indexes must differ from TIMESERIES_NONE");
+
+/**
+ * @brief Write the lowest bits of value into zeroed buffer, the most significant bit first
+ */
+static void WriteBits(uint8_t *data, uint16_t &position, uint32_t value, uint8_t bits)
+{
+    while (bits)
+    {
+        const uint8_t room = 8 - (position & 7);
+        const uint8_t take = bits < room ? bits : room;
+        const uint32_t chunk = (value >> (bits - take)) & ((1u << take) - 1);
+
+        data[position >> 3] |= static_cast<uint8_t>(chunk << (room - take));
+        position += take;
+        bits -= take;
+    }
+}
+
+/**
+ * @brief Read bits from buffer, the most significant bit first
+ */
+static uint32_t ReadBits(const uint8_t *data, uint16_t &position, uint8_t bits)
+{
+    uint32_t value{0};
+
+    while (bits)
+    {
+        const uint8_t room = 8 - (position & 7);
+        const uint8_t take = bits < room ? bits : room;
+        const uint32_t chunk = (data[position >> 3] >> (room - take)) & ((1u << take) - 1);
+
+        value = (value << take) | chunk;
+        position += take;
+        bits -= take;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Extend sign of value stored in the lowest bits
+ */
+static uint32_t SignExtend(uint32_t value, uint8_t bits)
+{
+    const uint32_t sign = 1u << (bits - 1);
+    return (value ^ sign) - sign;
+}
+
+/**
+ * @brief Get bits of float
+ */
+static uint32_t ToBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/**
+ * @brief Get float from its bits
+ */
+static float FromBits(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Find series
+ */
+size_t TimeSeriesStore::Find(const SeriesKey &key) const
+{
+    for (size_t i = 0; i < mSeries.size(); ++i)
+    {
+        const auto &series = mSeries[i];
+        if (series.head != TIMESERIES_NONE && series.key.clientID == key.clientID &&
+            series.key.position == key.position && series.key.metric == key.metric)
+            return i;
+    }
+
+    return TIMESERIES_NONE;
+}
+
+/**
+ * @brief Take block from pool, the oldest block of all series is reused when pool is empty
+ */
+uint16_t TimeSeriesStore::AllocateBlock()
+{
+    uint16_t index = mFreeBlocks;
+
+    if (index != TIMESERIES_NONE)
+    {
+        mFreeBlocks = mBlocks[index].next;
+    }
+    else
+    {
+        // Head block of every series holds its oldest data, so only heads are compared
+        Series *oldest{nullptr};
+        for (auto &series : mSeries)
+        {
+            if (series.head == TIMESERIES_NONE)
+                continue;
+
+            if (!oldest || mBlocks[series.head].last < mBlocks[oldest->head].last)
+                oldest = &series;
+        }
+
+        if (!oldest)
+            return TIMESERIES_NONE;
+
+        index = oldest->head;
+        oldest->head = mBlocks[index].next;
+        if (oldest->head == TIMESERIES_NONE)
+            oldest->tail = TIMESERIES_NONE;
+
+        ++mEvictedBlocks;
+    }
+
+    auto &block = mBlocks[index];
+    block.next = TIMESERIES_NONE;
+    block.count = 0;
+    block.bits = 0;
+    block.data.fill(0);
+
+    return index;
+}
+
+/**
+ * @brief Write sample into block of series
+ */
+bool TimeSeriesStore::Encode(Series &series, Block &block, uint32_t timestamp, float value)
+{
+    const uint32_t bits = ToBits(value);
+
+    if (!block.count)
+    {
+        // Block starts compression again, so it can be decoded without previous blocks
+        WriteBits(block.data.data(), block.bits, timestamp, 32);
+        WriteBits(block.data.data(), block.bits, bits, 32);
+
+        series.delta = 0;
+        series.value = bits;
+        series.leading = TIMESERIES_NO_WINDOW;
+        series.trailing = 0;
+
+        block.first = timestamp;
+        block.min = value;
+        block.max = value;
+        block.sum = 0.0;
+    }
+    else
+    {
+        if (block.count == std::numeric_limits<uint16_t>::max() || block.bits + MAX_SAMPLE_BITS > BLOCK_BITS)
+            return false;
+
+        // Arithmetic modulo 2^32 keeps any delta of delta exact
+        const uint32_t delta = timestamp - block.last;
+        const int32_t deltaOfDelta = static_cast<int32_t>(delta - series.delta);
+
+        if (deltaOfDelta == 0)
+            WriteBits(block.data.data(), block.bits, 0x0, 1);
+        else if (deltaOfDelta >= -64 && deltaOfDelta <= 63)
+        {
+            WriteBits(block.data.data(), block.bits, 0x2, 2);
+            WriteBits(block.data.data(), block.bits, static_cast<uint32_t>(deltaOfDelta), 7);
+        }
+        else if (deltaOfDelta >= -256 && deltaOfDelta <= 255)
+        {
+            WriteBits(block.data.data(), block.bits, 0x6, 3);
+            WriteBits(block.data.data(), block.bits, static_cast<uint32_t>(deltaOfDelta), 9);
+        }
+        else if (deltaOfDelta >= -2048 && deltaOfDelta <= 2047)
+        {
+            WriteBits(block.data.data(), block.bits, 0xE, 4);
+            WriteBits(block.data.data(), block.bits, static_cast<uint32_t>(deltaOfDelta), 12);
+        }
+        else
+        {
+            WriteBits(block.data.data(), block.bits, 0xF, 4);
+            WriteBits(block.data.data(), block.bits, static_cast<uint32_t>(deltaOfDelta), 32);
+        }
+
+        series.delta = delta;
+
+        const uint32_t xorValue = bits ^ series.value;
+        if (!xorValue)
+            WriteBits(block.data.data(), block.bits, 0x0, 1);
+        else
+        {
+            const uint8_t leading = static_cast<uint8_t>(__builtin_clz(xorValue));
+            const uint8_t trailing = static_cast<uint8_t>(__builtin_ctz(xorValue));
+
+            if (series.leading != TIMESERIES_NO_WINDOW && leading >= series.leading && trailing >= series.trailing)
+            {
+                // Meaningful bits fit into window of previous value
+                WriteBits(block.data.data(), block.bits, 0x2, 2);
+                WriteBits(block.data.data(), block.bits, xorValue >> series.trailing, 32 - series.leading - series.trailing);
+            }
+            else
+            {
+                const uint8_t length = 32 - leading - trailing;
+
+                WriteBits(block.data.data(), block.bits, 0x3, 2);
+                WriteBits(block.data.data(), block.bits, leading, 5);
+                WriteBits(block.data.data(), block.bits, length - 1, 5);
+                WriteBits(block.data.data(), block.bits, xorValue >> trailing, length);
+
+                series.leading = leading;
+                series.trailing = trailing;
+            }
+        }
+
+        series.value = bits;
+
+        if (value < block.min)
+            block.min = value;
+        if (value > block.max)
+            block.max = value;
+    }
+
+    ++block.count;
+    block.last = timestamp;
+    block.lastValue = value;
+    block.sum += value;
+
+    return true;
+}
+
+/**
+ * @brief Merge samples of block in window into summary by decoding block
+ */
+void TimeSeriesStore::Decode(const Block &block, uint32_t from, uint32_t to, SeriesSummary &summary, double &sum)
+{
+    const uint8_t *data = block.data.data();
+    uint16_t position{0};
+
+    uint32_t timestamp = ReadBits(data, position, 32);
+    uint32_t bits = ReadBits(data, position, 32);
+    uint32_t delta{0};
+    uint8_t leading{0};
+    uint8_t trailing{0};
+
+    for (uint16_t i = 0; i < block.count; ++i)
+    {
+        if (i)
+        {
+            // Length of delta of delta is given by number of leading ones
+            uint8_t prefix{0};
+            while (prefix < 4 && ReadBits(data, position, 1))
+                ++prefix;
+
+            static constexpr uint8_t DELTA_OF_DELTA_BITS[] = {0, 7, 9, 12, 32};
+            if (prefix)
+                delta += SignExtend(ReadBits(data, position, DELTA_OF_DELTA_BITS[prefix]), DELTA_OF_DELTA_BITS[prefix]);
+
+            timestamp += delta;
+
+            if (ReadBits(data, position, 1))
+            {
+                if (ReadBits(data, position, 1))
+                {
+                    leading = static_cast<uint8_t>(ReadBits(data, position, 5));
+                    trailing = 32 - leading - static_cast<uint8_t>(ReadBits(data, position, 5) + 1);
+                }
+
+                bits ^= ReadBits(data, position, 32 - leading - trailing) << trailing;
+            }
+        }
+
+        // Samples are ordered, rest of block is after window
+        if (timestamp > to)
+            break;
+
+        if (timestamp >= from)
+            Merge(summary, sum, timestamp, FromBits(bits));
+    }
+}
+
+/**
+ * @brief Merge sample into summary
+ */
+void TimeSeriesStore::Merge(SeriesSummary &summary, double &sum, uint32_t timestamp, float value)
+{
+    if (!summary.count || value < summary.min)
+        summary.min = value;
+    if (!summary.count || value > summary.max)
+        summary.max = value;
+
+    ++summary.count;
+    sum += value;
+    summary.last = value;
+    summary.lastTimestamp = timestamp;
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+TimeSeriesStore::TimeSeriesStore()
+    : mBlocks{},
+      mSeries{},
+      mFreeBlocks(TIMESERIES_NONE),
+      mEvictedBlocks(0),
+      mRejected(0)
+{
+    Clear();
+}
+
+/**
+ * @brief Class destructor
+ */
+TimeSeriesStore::~TimeSeriesStore()
+{
+}
+
+/**
+ * @brief Append sample to series
+ */
+bool TimeSeriesStore::Append(const SeriesKey &key, uint32_t timestamp, float value)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    size_t index = Find(key);
+    if (index == TIMESERIES_NONE)
+    {
+        for (size_t i = 0; i < mSeries.size() && index == TIMESERIES_NONE; ++i)
+        {
+            if (mSeries[i].head == TIMESERIES_NONE)
+                index = i;
+        }
+
+        if (index == TIMESERIES_NONE)
+        {
+            ++mRejected;
+            return false;
+        }
+    }
+
+    auto &series = mSeries[index];
+    if (series.head != TIMESERIES_NONE)
+    {
+        if (timestamp < mBlocks[series.tail].last)
+        {
+            ++mRejected;
+            return false;
+        }
+
+        if (Encode(series, mBlocks[series.tail], timestamp, value))
+            return true;
+    }
+
+    // Reused block may be the head of this series, even its only block
+    const uint16_t block = AllocateBlock();
+    if (block == TIMESERIES_NONE)
+    {
+        ++mRejected;
+        return false;
+    }
+
+    if (series.head == TIMESERIES_NONE)
+    {
+        series.key = key;
+        series.head = block;
+    }
+    else
+    {
+        mBlocks[series.tail].next = block;
+    }
+
+    series.tail = block;
+    return Encode(series, mBlocks[block], timestamp, value);
+}
+
+/**
+ * @brief Get summary of samples in window
+ */
+bool TimeSeriesStore::Query(const SeriesKey &key, uint32_t from, uint32_t to, SeriesSummary &summary) const
+{
+    summary = {0, 0.0f, 0.0f, 0.0f, 0.0f, 0};
+    double sum{0.0};
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const size_t index = Find(key);
+    if (index == TIMESERIES_NONE)
+        return false;
+
+    for (uint16_t i = mSeries[index].head; i != TIMESERIES_NONE; i = mBlocks[i].next)
+    {
+        const auto &block = mBlocks[i];
+        if (block.last < from)
+            continue;
+
+        if (block.first > to)
+            break;
+
+        if (block.first < from || block.last > to)
+        {
+            // Only blocks on edges of window are decoded
+            Decode(block, from, to, summary, sum);
+            continue;
+        }
+
+        if (!summary.count || block.min < summary.min)
+            summary.min = block.min;
+        if (!summary.count || block.max > summary.max)
+            summary.max = block.max;
+
+        summary.count += block.count;
+        sum += block.sum;
+        summary.last = block.lastValue;
+        summary.lastTimestamp = block.last;
+    }
+
+    if (!summary.count)
+        return false;
+
+    summary.avg = static_cast<float>(sum / summary.count);
+    return true;
+}
+
+/**
+ * @brief Remove all series
+ */
+void TimeSeriesStore::Clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (auto &series : mSeries)
+    {
+        series.head = TIMESERIES_NONE;
+        series.tail = TIMESERIES_NONE;
+    }
+
+    for (uint16_t i = 0; i < mBlocks.size(); ++i)
+        mBlocks[i].next = static_cast<size_t>(i + 1) < mBlocks.size() ? static_cast<uint16_t>(i + 1) : TIMESERIES_NONE;
+
+    mFreeBlocks = 0;
+}
+
+/**
+ * @brief Get counters of store
+ */
+TimeSeriesStatistics TimeSeriesStore::GetStatistics() const
+{
+    TimeSeriesStatistics statistics = {0, 0, 0, 0, 0, 0};
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const auto &series : mSeries)
+    {
+        if (series.head == TIMESERIES_NONE)
+            continue;
+
+        ++statistics.series;
+        for (uint16_t i = series.head; i != TIMESERIES_NONE; i = mBlocks[i].next)
+        {
+            ++statistics.usedBlocks;
+            statistics.samples += mBlocks[i].count;
+            statistics.usedBytes += (mBlocks[i].bits + 7) / 8;
+        }
+    }
+
+    statistics.evictedBlocks = mEvictedBlocks;
+    statistics.rejected = mRejected;
+    return statistics;
+}
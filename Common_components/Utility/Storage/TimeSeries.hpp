@@ -0,0 +1,246 @@
+/**
+ * Compressed in-RAM time series of sensor values
+ *
+ * Samples are compressed in the way of Gorilla: timestamp is stored as delta of delta with variable
+ * length prefix and value as XOR with the previous value, where only meaningful bits are written.
+ * Regular sample with slowly changing value takes few bits.
+ *
+ * Series are stored in chain of fixed size blocks taken from one pool shared by all series. Every block
+ * starts compression again, so it can be decoded alone, and keeps summary of its samples. Query over
+ * window merges summaries of blocks inside window and decodes only the blocks on its edges. When pool
+ * is exhausted the block with the oldest data of all series is reused.
+ *
+ * @author Dominik Regec
+ */
+#ifndef TIME_SERIES_H
+#define TIME_SERIES_H
+
+/* STD library */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/* SDK config */
+#include "sdkconfig.h"
+
+// Memory of time series
+#ifdef CONFIG_TIMESERIES_BLOCKS
+#define TIMESERIES_BLOCKS CONFIG_TIMESERIES_BLOCKS
+#define TIMESERIES_MAX_SERIES CONFIG_TIMESERIES_MAX_SERIES
+#else
+#define TIMESERIES_BLOCKS 128
+#define TIMESERIES_MAX_SERIES 32
+#endif
+
+// Size of compressed data in one block
+#define TIMESERIES_BLOCK_SIZE 128
+
+// Index of missing block or series
+#define TIMESERIES_NONE 0xFFFF
+
+// Encoder has no window of meaningful bits to reuse
+#define TIMESERIES_NO_WINDOW 0xFF
+
+namespace Utility
+{
+    namespace Storage
+    {
+        /* Identification of series */
+        struct SeriesKey
+        {
+            // Client ID
+            uint8_t clientID;
+            // Position of client
+            uint8_t position;
+            // Measured value, e.g. content bit of frame field
+            uint8_t metric;
+        };
+
+        /* Result of query over window */
+        struct SeriesSummary
+        {
+            // Number of samples in window
+            uint32_t count;
+            // Minimal value
+            float min;
+            // Maximal value
+            float max;
+            // Average value
+            float avg;
+            // The newest value
+            float last;
+            // Timestamp of the newest value
+            uint32_t lastTimestamp;
+        };
+
+        /* Counters of time series store */
+        struct TimeSeriesStatistics
+        {
+            // Samples held in store
+            uint32_t samples;
+            // Series held in store
+            uint32_t series;
+            // Blocks used by series
+            uint32_t usedBlocks;
+            // Compressed bytes of used blocks
+            uint32_t usedBytes;
+            // Blocks reused because pool was exhausted
+            uint32_t evictedBlocks;
+            // Samples rejected because they were older than the newest sample of series
+            uint32_t rejected;
+        };
+
+        /**
+         * @brief Fixed memory store of compressed time series. Methods are thread safe
+         */
+        class TimeSeriesStore
+        {
+        public:
+            /**
+             * @brief Class constructor
+             */
+            explicit TimeSeriesStore();
+
+            /**
+             * @brief Class destructor
+             */
+            ~TimeSeriesStore();
+
+            TimeSeriesStore(const TimeSeriesStore &) = delete;
+            TimeSeriesStore &operator=(const TimeSeriesStore &) = delete;
+
+            /**
+             * @brief Append sample to series. Series is created for the first sample
+             *
+             * @param[in] key       : Series
+             * @param[in] timestamp : Time of sample in seconds, not older than the newest sample of series
+             * @param[in] value     : Value of sample
+             *
+             * @return bool         : True when sample was stored
+             */
+            bool Append(const SeriesKey &key, uint32_t timestamp, float value);
+
+            /**
+             * @brief Get summary of samples in window
+             *
+             * @param[in] key       : Series
+             * @param[in] from      : The first second of window
+             * @param[in] to        : The last second of window
+             * @param[out] summary  : Summary of samples
+             *
+             * @return bool         : True when window contains any sample
+             */
+            bool Query(const SeriesKey &key, uint32_t from, uint32_t to, SeriesSummary &summary) const;
+
+            /**
+             * @brief Remove all series
+             */
+            void Clear();
+
+            /**
+             * @brief Get counters of store
+             *
+             * @return TimeSeriesStatistics
+             */
+            TimeSeriesStatistics GetStatistics() const;
+
+        private:
+            /* Chunk of one series compressed independently of other blocks */
+            struct Block
+            {
+                // Next block of series
+                uint16_t next;
+                // Number of samples
+                uint16_t count;
+                // Number of written bits
+                uint16_t bits;
+                // Timestamp of the first sample
+                uint32_t first;
+                // Timestamp of the last sample
+                uint32_t last;
+                // Minimal value
+                float min;
+                // Maximal value
+                float max;
+                // The last value
+                float lastValue;
+                // Sum of values
+                double sum;
+                // Compressed samples
+                std::array<uint8_t, TIMESERIES_BLOCK_SIZE> data;
+            };
+
+            /* Series with state of encoder of its tail block */
+            struct Series
+            {
+                // Identification of series
+                SeriesKey key;
+                // The oldest block, TIMESERIES_NONE for free series
+                uint16_t head;
+                // The newest block
+                uint16_t tail;
+                // Delta of the last two timestamps
+                uint32_t delta;
+                // Bits of the last value
+                uint32_t value;
+                // Leading zeros of the last meaningful XOR, TIMESERIES_NO_WINDOW before the first one
+                uint8_t leading;
+                // Trailing zeros of the last meaningful XOR
+                uint8_t trailing;
+            };
+
+            /**
+             * @brief Find series. Caller holds mutex
+             *
+             * @return size_t   : Index of series, TIMESERIES_NONE when series does not exist
+             */
+            size_t Find(const SeriesKey &key) const;
+
+            /**
+             * @brief Take block from pool, the oldest block of all series is reused when pool is empty.
+             *        Caller holds mutex
+             *
+             * @return uint16_t : Index of block, TIMESERIES_NONE when no block can be reused
+             */
+            uint16_t AllocateBlock();
+
+            /**
+             * @brief Write sample into block of series. Caller holds mutex
+             *
+             * @return bool     : False when block is full
+             */
+            static bool Encode(Series &series, Block &block, uint32_t timestamp, float value);
+
+            /**
+             * @brief Merge samples of block in window into summary by decoding block
+             */
+            static void Decode(const Block &block, uint32_t from, uint32_t to, SeriesSummary &summary, double &sum);
+
+            /**
+             * @brief Merge sample into summary
+             */
+            static void Merge(SeriesSummary &summary, double &sum, uint32_t timestamp, float value);
+
+            /* Pool of blocks */
+            std::array<Block, TIMESERIES_BLOCKS> mBlocks;
+
+            /* Series */
+            std::array<Series, TIMESERIES_MAX_SERIES> mSeries;
+
+            /* The first free block */
+            uint16_t mFreeBlocks;
+
+            /* Blocks reused because pool was exhausted */
+            uint32_t mEvictedBlocks;
+
+            /* Rejected samples */
+            uint32_t mRejected;
+
+            /* Serialize access of workers and readers */
+            mutable std::mutex mMutex;
+        };
+    } // namespace Storage
+} // namespace Utility
+
+#endif // TIME_SERIES_H
@@ -0,0 +1,193 @@
+/* Project specific includes */
+#include "WorkerPool.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
+
+using namespace Utility::Task;
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+WorkerPool::WorkerPool(const char *name, size_t workers, size_t depth, OverflowPolicy policy,
+                       Handler_T handler, DropHandler_T dropHandler, void *context,
+                       uint32_t stackSize, UBaseType_t priority)
+    : mName(name),
+      mWorkers(workers),
+      mDepth(depth),
+      mPolicy(policy),
+      mHandler(handler),
+      mDropHandler(dropHandler),
+      mContext(context),
+      mStackSize(stackSize),
+      mPriority(priority),
+      mQueue(nullptr),
+      mEnqueued(0),
+      mDropped(0),
+      mProcessed(0)
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+WorkerPool::~WorkerPool()
+{
+    for (auto &task : mTasks)
+        vTaskDelete(task);
+
+    if (mQueue)
+    {
+        // Release items which were never processed
+        void *item{nullptr};
+        while (xQueueReceive(mQueue, &item, 0) == pdTRUE)
+            Drop(item);
+
+        vQueueDelete(mQueue);
+    }
+}
+
+/**
+ * @brief Create queue and worker tasks
+ */
+bool WorkerPool::Start()
+{
+    if (mQueue)
+        return true;
+
+    if (!mHandler || !mWorkers || !mDepth)
+    {
+        ESP_LOGE(WORKER_POOL_TAG, "Invalid configuration of worker pool %s", mName);
+        return false;
+    }
+
+    mQueue = xQueueCreate(mDepth, sizeof(void *));
+    if (!mQueue)
+    {
+        ESP_LOGE(WORKER_POOL_TAG, "Unable to create queue for worker pool %s", mName);
+        return false;
+    }
+
+    mTasks.reserve(mWorkers);
+    for (size_t i = 0; i < mWorkers; ++i)
+    {
+        TaskHandle_t task{nullptr};
+        if (xTaskCreate(&WorkerPool::WorkerTask, mName, mStackSize, this, mPriority, &task) != pdPASS)
+        {
+            ESP_LOGE(WORKER_POOL_TAG, "Unable to create worker %d of pool %s", static_cast<int>(i), mName);
+            break;
+        }
+
+        mTasks.push_back(task);
+    }
+
+    if (mTasks.empty())
+        return false;
+
+    ESP_LOGI(WORKER_POOL_TAG, "Worker pool %s started with %d workers, queue depth %d and policy %s", mName,
+             static_cast<int>(mTasks.size()), static_cast<int>(mDepth), OVERFLOW_POLICY_TO_STRING(mPolicy));
+    return true;
+}
+
+/**
+ * @brief Submit item for processing
+ */
+bool WorkerPool::Submit(void *item)
+{
+    if (!mQueue)
+    {
+        Drop(item);
+        return false;
+    }
+
+    switch (mPolicy)
+    {
+    case (OverflowPolicy::BLOCK):
+    {
+        if (xQueueSend(mQueue, &item, portMAX_DELAY) != pdTRUE)
+        {
+            Drop(item);
+            return false;
+        }
+        break;
+    }
+    case (OverflowPolicy::DROP_OLDEST):
+    {
+        // Other producers or workers may change queue between attempts
+        while (xQueueSend(mQueue, &item, 0) != pdTRUE)
+        {
+            void *oldest{nullptr};
+            if (xQueueReceive(mQueue, &oldest, 0) == pdTRUE)
+                Drop(oldest);
+        }
+        break;
+    }
+    case (OverflowPolicy::DROP_NEWEST):
+    default:
+    {
+        if (xQueueSend(mQueue, &item, 0) != pdTRUE)
+        {
+            Drop(item);
+            return false;
+        }
+        break;
+    }
+    }
+
+    ++mEnqueued;
+    return true;
+}
+
+/**
+ * @brief Get counters of pool
+ */
+WorkerPoolStatistics WorkerPool::GetStatistics() const
+{
+    return {mEnqueued.load(), mDropped.load(), mProcessed.load()};
+}
+
+/**
+ * @brief Get number of items waiting in queue
+ */
+size_t WorkerPool::Pending() const
+{
+    return mQueue ? uxQueueMessagesWaiting(mQueue) : 0;
+}
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Worker task body
+ */
+void WorkerPool::WorkerTask(void *arg)
+{
+    auto pool = static_cast<WorkerPool *>(arg);
+    void *item{nullptr};
+
+    while (true)
+    {
+        if (xQueueReceive(pool->mQueue, &item, portMAX_DELAY) != pdTRUE)
+            continue;
+
+        pool->mHandler(item, pool->mContext);
+        ++pool->mProcessed;
+    }
+}
+
+/**
+ * @brief Call drop handler and count dropped item
+ */
+void WorkerPool::Drop(void *item)
+{
+    ++mDropped;
+    ESP_LOGW(WORKER_POOL_TAG, "Item dropped by worker pool %s", mName);
+
+    if (mDropHandler)
+        mDropHandler(item, mContext);
+}
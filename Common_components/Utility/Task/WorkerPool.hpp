@@ -0,0 +1,178 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+/* STD library */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define WORKER_POOL_TAG "WorkerPool"
+
+#define OVERFLOW_POLICY_TO_STRING(policyValue) Utility::Task::EnumToString(policyValue)
+
+namespace Utility
+{
+    namespace Task
+    {
+        enum class OverflowPolicy
+        {
+            DROP_OLDEST, // <- Oldest queued item is dropped to make space for new one
+            DROP_NEWEST, // <- New item is dropped
+            BLOCK,       // <- Producer waits until space is available
+        };
+
+        inline const char *EnumToString(OverflowPolicy value)
+        {
+            switch (value)
+            {
+            case (OverflowPolicy::DROP_OLDEST):
+                return "Drop_Oldest";
+            case (OverflowPolicy::DROP_NEWEST):
+                return "Drop_Newest";
+            case (OverflowPolicy::BLOCK):
+                return "Block";
+            default:
+                return "Unimplemented value";
+            }
+        }
+
+        /* Counters of worker pool */
+        struct WorkerPoolStatistics
+        {
+            // Items accepted into queue
+            uint32_t enqueued;
+            // Items dropped due to full queue
+            uint32_t dropped;
+            // Items handled by workers
+            uint32_t processed;
+        };
+
+        class WorkerPool
+        {
+        public:
+            /* Handler called by worker for every item */
+            using Handler_T = void (*)(void *item, void *context);
+
+            /* Handler called for every dropped item to release its resources */
+            using DropHandler_T = void (*)(void *item, void *context);
+
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] name          : Name of worker tasks
+             * @param[in] workers       : Number of worker tasks
+             * @param[in] depth         : Maximum number of queued items
+             * @param[in] policy        : Policy applied when queue is full
+             * @param[in] handler       : Item handler
+             * @param[in] dropHandler   : Handler of dropped items. Can be nullptr
+             * @param[in] context       : Context passed to handlers
+             * @param[in] stackSize     : Stack size of worker task
+             * @param[in] priority      : Priority of worker task
+             */
+            explicit WorkerPool(const char *name, size_t workers, size_t depth, OverflowPolicy policy,
+                                Handler_T handler, DropHandler_T dropHandler, void *context,
+                                uint32_t stackSize = 4096, UBaseType_t priority = tskIDLE_PRIORITY + 1);
+
+            /**
+             * @brief Class destructor
+             */
+            ~WorkerPool();
+
+            WorkerPool(const WorkerPool &) = delete;
+            WorkerPool &operator=(const WorkerPool &) = delete;
+
+            /**
+             * @brief Create queue and worker tasks
+             *
+             * @return bool     true    : Pool is running
+             *                  false   : Otherwise
+             */
+            bool Start();
+
+            /**
+             * @brief Submit item for processing
+             *
+             * @param[in] item  : Item passed to handler
+             *
+             * @return bool     true    : Item was queued
+             *                  false   : Item was dropped
+             */
+            bool Submit(void *item);
+
+            /**
+             * @brief Get counters of pool
+             *
+             * @return WorkerPoolStatistics
+             */
+            WorkerPoolStatistics GetStatistics() const;
+
+            /**
+             * @brief Get number of items waiting in queue
+             *
+             * @return size_t
+             */
+            size_t Pending() const;
+
+        private:
+            /**
+             * @brief Worker task body
+             *
+             * @param[in] arg   : Pointer to worker pool
+             */
+            static void WorkerTask(void *arg);
+
+            /**
+             * @brief Call drop handler and count dropped item
+             *
+             * @param[in] item  : Dropped item
+             */
+            void Drop(void *item);
+
+            /* Name of worker tasks */
+            const char *mName;
+
+            /* Number of worker tasks */
+            const size_t mWorkers;
+
+            /* Queue depth */
+            const size_t mDepth;
+
+            /* Overflow policy */
+            const OverflowPolicy mPolicy;
+
+            /* Item handler */
+            Handler_T mHandler;
+
+            /* Dropped item handler */
+            DropHandler_T mDropHandler;
+
+            /* Handlers context */
+            void *mContext;
+
+            /* Worker stack size */
+            const uint32_t mStackSize;
+
+            /* Worker priority */
+            const UBaseType_t mPriority;
+
+            /* Queue of item pointers */
+            QueueHandle_t mQueue;
+
+            /* Worker task handles */
+            std::vector<TaskHandle_t> mTasks;
+
+            /* Counters */
+            std::atomic<uint32_t> mEnqueued;
+            std::atomic<uint32_t> mDropped;
+            std::atomic<uint32_t> mProcessed;
+        };
+    } // namespace Task
+} // namespace Utility
+
+#endif // WORKER_POOL_H
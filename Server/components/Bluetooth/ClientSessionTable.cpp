@@ -0,0 +1,118 @@
+/* Project specific includes */
+#include "ClientSessionTable.hpp"
+
+/* Common components */
+#include "Bluetooth/BluetoothDefinitions.hpp"
+
+/* ESP includes */
+#include "esp_log.h"
+#include "esp_timer.h"
+
+/* STD library includes */
+#include <cstring>
+
+using namespace Greenhouse::Bluetooth;
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+ClientSessionTable::ClientSessionTable() : mSessions{}, mActiveCount(0)
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+ClientSessionTable::~ClientSessionTable()
+{
+}
+
+/**
+ * @brief Open session for new connection
+ */
+ClientSession *ClientSessionTable::Open(uint16_t connID, const esp_bd_addr_t bda)
+{
+    // Connection ID may be reused by stack without disconnect event
+    Close(connID);
+
+    const auto slot = GetSlot(connID);
+    for (size_t i = 0; i < mSessions.size(); ++i)
+    {
+        auto &session = mSessions[(slot + i) % mSessions.size()];
+        if (session.active)
+            continue;
+
+        const auto now = esp_timer_get_time();
+
+        session = {};
+        session.active = true;
+        session.connID = connID;
+        memcpy(session.bda, bda, sizeof(esp_bd_addr_t));
+        session.clientID = CLIENT_SESSION_UNKNOWN_ID;
+        session.mtu = GATT_DEFAULT_MTU;
+        session.connectedAt = now;
+        session.lastSeen = now;
+
+        ++mActiveCount;
+        return &session;
+    }
+
+    ESP_LOGE(CLIENT_SESSION_TABLE_TAG, "No free session for connection %d", connID);
+    return nullptr;
+}
+
+/**
+ * @brief Close session of connection
+ */
+bool ClientSessionTable::Close(uint16_t connID)
+{
+    auto session = Find(connID);
+    if (!session)
+        return false;
+
+    ESP_LOGI(CLIENT_SESSION_TABLE_TAG, "Session of client %d closed after %d s: %d writes, %d bytes, %d frames, %d rejected",
+             session->clientID, static_cast<int>((session->lastSeen - session->connectedAt) / 1000000),
+             static_cast<int>(session->counters.writes), static_cast<int>(session->counters.bytes),
+             static_cast<int>(session->counters.frames), static_cast<int>(session->counters.rejectedFrames));
+
+    session->active = false;
+    --mActiveCount;
+    return true;
+}
+
+/**
+ * @brief Find session by connection ID and refresh its last seen time
+ */
+ClientSession *ClientSessionTable::Find(uint16_t connID)
+{
+    const auto slot = GetSlot(connID);
+    for (size_t i = 0; i < mSessions.size(); ++i)
+    {
+        auto &session = mSessions[(slot + i) % mSessions.size()];
+        if (session.active && session.connID == connID)
+        {
+            session.lastSeen = esp_timer_get_time();
+            return &session;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Find session by remote bluetooth device address
+ */
+ClientSession *ClientSessionTable::Find(const esp_bd_addr_t bda)
+{
+    for (auto &session : mSessions)
+    {
+        if (session.active && !memcmp(session.bda, bda, sizeof(esp_bd_addr_t)))
+            return &session;
+    }
+
+    return nullptr;
+}
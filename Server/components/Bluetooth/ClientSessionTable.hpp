@@ -0,0 +1,142 @@
+/**
+ * Definition of ClientSessionTable to track connected bluetooth clients
+ *
+ * @author Dominik Regec
+ */
+#ifndef CLIENT_SESSION_TABLE_H
+#define CLIENT_SESSION_TABLE_H
+
+/* ESP bluetooth includes */
+#include "esp_bt_defs.h"
+
+/* SDK config */
+#include "sdkconfig.h"
+
+/* STD library includes */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*************         DEFINES        *************/
+#define CLIENT_SESSION_TABLE_TAG "ClientSessionTable"
+
+// Maximum number of simultaneous BLE links allowed by controller
+#define CLIENT_SESSION_TABLE_SIZE CONFIG_BTDM_CTRL_BLE_MAX_CONN_EFF
+
+// Client ID of session which did not send any frame yet
+#define CLIENT_SESSION_UNKNOWN_ID 0xFF
+
+namespace Greenhouse
+{
+    namespace Bluetooth
+    {
+        /* Negotiated connection parameters */
+        struct ConnectionParameters
+        {
+            uint16_t interval; // Connection interval in 1.25 ms units
+            uint16_t latency;  // Slave latency in connection events
+            uint16_t timeout;  // Supervision timeout in 10 ms units
+        };
+
+        /* Counters of one client */
+        struct SessionCounters
+        {
+            uint32_t writes;         // Write requests received
+            uint32_t bytes;          // Bytes received in write requests
+            uint32_t frames;         // Sensor frames decoded and published
+            uint32_t rejectedFrames; // Sensor frames which could not be decoded or published
+        };
+
+        /* State of one connected client */
+        struct ClientSession
+        {
+            bool active;
+            uint16_t connID;
+            esp_bd_addr_t bda;
+            uint8_t clientID;
+            uint16_t mtu;
+            ConnectionParameters parameters;
+            int64_t connectedAt; // Time of connection in microseconds since boot
+            int64_t lastSeen;    // Time of last activity in microseconds since boot
+            SessionCounters counters;
+        };
+
+        class ClientSessionTable
+        {
+        public:
+            /**
+             * @brief Class constructor
+             */
+            explicit ClientSessionTable();
+
+            /**
+             * @brief Class destructor
+             */
+            ~ClientSessionTable();
+
+            /**
+             * @brief Open session for new connection
+             *
+             * @param[in] connID    : Connection ID
+             * @param[in] bda       : Remote bluetooth device address
+             *
+             * @return ClientSession*   : Opened session
+             *                            nullptr - table is full
+             */
+            ClientSession *Open(uint16_t connID, const esp_bd_addr_t bda);
+
+            /**
+             * @brief Close session of connection
+             *
+             * @param[in] connID    : Connection ID
+             *
+             * @return bool         : True  - session was closed
+             *                        False - no session for connection
+             */
+            bool Close(uint16_t connID);
+
+            /**
+             * @brief Find session by connection ID and refresh its last seen time.
+             *        Takes constant time while connection IDs stay below table size.
+             *
+             * @param[in] connID    : Connection ID
+             *
+             * @return ClientSession*   : Session or nullptr when connection is unknown
+             */
+            ClientSession *Find(uint16_t connID);
+
+            /**
+             * @brief Find session by remote bluetooth device address
+             *
+             * @param[in] bda       : Remote bluetooth device address
+             *
+             * @return ClientSession*   : Session or nullptr when device is not connected
+             */
+            ClientSession *Find(const esp_bd_addr_t bda);
+
+            /**
+             * @brief Get number of active sessions
+             */
+            size_t GetActiveCount() const { return mActiveCount; }
+
+            /**
+             * @brief Get capacity of table
+             */
+            static constexpr size_t GetCapacity() { return CLIENT_SESSION_TABLE_SIZE; }
+
+        private:
+            /**
+             * @brief Get preferred slot of connection ID
+             */
+            static size_t GetSlot(uint16_t connID) { return connID % CLIENT_SESSION_TABLE_SIZE; }
+
+            /* Sessions. Connection is stored in its preferred slot or the next free one */
+            std::array<ClientSession, CLIENT_SESSION_TABLE_SIZE> mSessions;
+
+            /* Number of active sessions */
+            size_t mActiveCount;
+        };
+    } // namespace Bluetooth
+} // namespace Greenhouse
+
+#endif // CLIENT_SESSION_TABLE_H
@@ -2,6 +2,7 @@
 #include "ServerBluetoothHandler.hpp"
 #include "GreenhouseManager.hpp"
 #include "Managers/EventManager.hpp"
+#include "Managers/EventDataPool.hpp"
 
 /* ESP log library */
 #include "esp_log.h"
@@ -91,7 +92,18 @@ void ServerBluetoothHandler::HandleGapEvent(esp_gap_ble_cb_event_t event, esp_bl
         break;
     }
     case (ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT):
+    {
+        if (param->update_conn_params.status != ESP_BT_STATUS_SUCCESS)
+            break;
+
+        if (auto session = mSessions.Find(param->update_conn_params.bda))
+        {
+            session->parameters.interval = param->update_conn_params.conn_int;
+            session->parameters.latency = param->update_conn_params.latency;
+            session->parameters.timeout = param->update_conn_params.timeout;
+        }
         break;
+    }
     default:
     {
         ESP_LOGW(SERVER_BLUETOOTH_HANDLER_TAG, "Unhandled event [%s] in function %s", Component::Bluetooth::EnumToString(event).c_str(), __func__);
@@ -221,22 +233,33 @@ void ServerBluetoothHandler::GreenhouseEventHandler(esp_gatts_cb_event_t event,
             return;
         }
 
-        if (param->write.need_rsp)
-            controller->SendResponse(gatts_if, param->write.conn_id, param->write.trans_id, ESP_GATT_OK);
-
-        std::vector<uint8_t> sensorData(param->write.value, param->write.value + param->write.len);
-        if (sensorData.empty())
+        auto session = mSessions.Find(param->write.conn_id);
+        if (session)
         {
-            ESP_LOGE(SERVER_BLUETOOTH_HANDLER_TAG, "No sensor data to parse");
-            break;
+            ++session->counters.writes;
+            session->counters.bytes += param->write.len;
         }
 
-        auto eventData = new Component::Publisher::ClientBluetoothEventData_Greenhouse((sensorData.at(0) >> 2), (sensorData.at(0) & 0x03));
+        // Frame is decoded directly from BLE stack buffer
+        auto eventData = ParseData(Component::Protocol::ByteView(param->write.value, param->write.len));
+        const auto clientID = eventData ? eventData->GetClientID() : CLIENT_SESSION_UNKNOWN_ID;
+
+        // Rejected event data goes back to pool when handle leaves scope
+        const bool published = eventData && Greenhouse::Manager::EventManager::GetInstance()->Notify<Component::Publisher::Events::BLUETOOTH_DATA_RECEIVED>(std::move(eventData));
+
+        // Error response makes client send keyframe, so delta state of both sides stays in sync
+        if (param->write.need_rsp)
+            controller->SendResponse(gatts_if, param->write.conn_id, param->write.trans_id, published ? ESP_GATT_OK : ESP_GATT_ERROR);
 
-        if (ParseData(sensorData, eventData))
+        if (session)
         {
-            auto eventManager = Greenhouse::Manager::EventManager::GetInstance();
-            eventManager->Notify(Greenhouse::Manager::EventManager::Event_T::BLUETOOTH_DATA_RECEIVED, eventData);
+            if (clientID != CLIENT_SESSION_UNKNOWN_ID)
+                session->clientID = clientID;
+
+            if (published)
+                ++session->counters.frames;
+            else
+                ++session->counters.rejectedFrames;
         }
 
         break;
@@ -244,8 +267,13 @@ void ServerBluetoothHandler::GreenhouseEventHandler(esp_gatts_cb_event_t event,
     case ESP_GATTS_EXEC_WRITE_EVT:
         break;
     case ESP_GATTS_MTU_EVT:
-        ESP_LOGI(SERVER_BLUETOOTH_HANDLER_TAG, "MTU set to %d.", param->mtu.mtu);
+    {
+        ESP_LOGI(SERVER_BLUETOOTH_HANDLER_TAG, "MTU of connection %d set to %d.", param->mtu.conn_id, param->mtu.mtu);
+
+        if (auto session = mSessions.Find(param->mtu.conn_id))
+            session->mtu = param->mtu.mtu;
         break;
+    }
     case ESP_GATTS_UNREG_EVT:
         break;
     case ESP_GATTS_CREATE_EVT:
@@ -310,7 +338,16 @@ void ServerBluetoothHandler::GreenhouseEventHandler(esp_gatts_cb_event_t event,
                  param->connect.conn_id,
                  param->connect.remote_bda[0], param->connect.remote_bda[1], param->connect.remote_bda[2],
                  param->connect.remote_bda[3], param->connect.remote_bda[4], param->connect.remote_bda[5]);
-        mProfilesMap.at(GREENHOUSE_PROFILE).conn_id = param->connect.conn_id;
+
+        if (auto session = mSessions.Open(param->connect.conn_id, param->connect.remote_bda))
+        {
+            session->parameters.interval = param->connect.conn_params.interval;
+            session->parameters.latency = param->connect.conn_params.latency;
+            session->parameters.timeout = param->connect.conn_params.timeout;
+        }
+
+        ESP_LOGI(SERVER_BLUETOOTH_HANDLER_TAG, "Connected clients: %d/%d", static_cast<int>(mSessions.GetActiveCount()),
+                 static_cast<int>(mSessions.GetCapacity()));
 
         auto connector = GetBluetoothController().lock();
         if (!connector)
@@ -319,13 +356,16 @@ void ServerBluetoothHandler::GreenhouseEventHandler(esp_gatts_cb_event_t event,
         // Start sent the update connection parameters to the peer device.
         connector->UpdateConParameteres(&conn_params);
 
-        // Start advertising for other clients
-        connector->StartAdvertising(&adv_params);
+        // Start advertising for other clients while controller accepts another link
+        if (mSessions.GetActiveCount() < mSessions.GetCapacity())
+            connector->StartAdvertising(&adv_params);
 
         break;
     }
     case ESP_GATTS_DISCONNECT_EVT:
-        ESP_LOGI(SERVER_BLUETOOTH_HANDLER_TAG, "Client disconnected. The reason is 0x%x", param->disconnect.reason);
+        ESP_LOGI(SERVER_BLUETOOTH_HANDLER_TAG, "Client on connection %d disconnected. The reason is 0x%x", param->disconnect.conn_id, param->disconnect.reason);
+
+        mSessions.Close(param->disconnect.conn_id);
 
         if (auto connector = GetBluetoothController().lock())
             connector->StartAdvertising(&adv_params);
@@ -344,70 +384,77 @@ void ServerBluetoothHandler::GreenhouseEventHandler(esp_gatts_cb_event_t event,
 }
 
 /**
- * @brief Extract data from vector during parsing bluetooth data
- */
-template <typename T>
-void ServerBluetoothHandler::ExtractData(std::vector<uint8_t> &data, GreenhouseBluetoothEventData *eventDataClass, void (GreenhouseBluetoothEventData::*SetFunction)(T)) const
-{
-    (eventDataClass->*SetFunction)(*(data.end() - 2) + (static_cast<T>(data.back()) / 100));
-    data.resize(data.size() - 2);
-}
-
-/**
- * @brief Parse data from bluettoth wrte event
+ * @brief Decode sensor frame from bluetooth write event into new event data structure
  */
-bool ServerBluetoothHandler::ParseData(const std::vector<uint8_t> &sensorData, Component::Publisher::ClientBluetoothEventData_Greenhouse *eventData) const
+Greenhouse::Manager::EventDataPool::Handle ServerBluetoothHandler::ParseData(Component::Protocol::ByteView sensorData)
 {
-    if (!eventData)
-        return false;
+    using namespace Component::Protocol;
 
 #ifdef CONFIG_LOG_DEFAULT_LEVEL_DEBUG
-    auto PrintContent = [&sensorData]()
-    {
-        ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Sensor data: ");
-        for (const auto &value : sensorData)
-            ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "0x%x", value);
-    };
+    ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Sensor data: ");
+    ESP_LOG_BUFFER_HEX_LEVEL(SERVER_BLUETOOTH_HANDLER_TAG, sensorData.data(), sensorData.size(), ESP_LOG_DEBUG);
 #endif
-    std::vector<uint8_t> sensorDataCopy(sensorData);
 
-#ifdef CONFIG_LOG_DEFAULT_LEVEL_DEBUG
-    PrintContent();
-#endif
+    FrameHeader header;
+    uint8_t count{0};
 
-    const auto &content = sensorDataCopy.at(1);
+    auto result = GreenhouseFrame::DecodeHeader(sensorData, header, count);
+    if (result != FrameResult::FRAME_OK)
+    {
+        ESP_LOGE(SERVER_BLUETOOTH_HANDLER_TAG, "Unable to decode sensor frame header: %s", FRAME_RESULT_TO_STRING(result));
+        return {};
+    }
 
-    // Check if Soil moisture block is in data vector
-    if (content & 0x10)
-        ExtractData<float>(sensorDataCopy, eventData, &GreenhouseBluetoothEventData::SetSoilMoisture);
+    auto pool = Greenhouse::Manager::EventDataPool::GetInstance();
 
-    // Check if CO2 block is in data vector
-    if (content & 0x20)
+    auto eventData = pool->AcquireHandle(header.clientID, header.position);
+    if (!eventData)
     {
-        eventData->SetCO2((*(sensorDataCopy.end() - 2) << 8) + (sensorDataCopy.back()));
-        sensorDataCopy.resize(sensorDataCopy.size() - 2);
+        ESP_LOGE(SERVER_BLUETOOTH_HANDLER_TAG, "Event data pool is exhausted. Frame from client %d dropped", header.clientID);
+        return {};
     }
 
-    // Check if Humidity block is in data vector
-    if (content & 0x40)
-        ExtractData<float>(sensorDataCopy, eventData, &GreenhouseBluetoothEventData::SetHumidity);
+    size_t decoded{0};
+    result = GreenhouseFrame::DecodeSamples(sensorData, eventData->GetSampleStorage(), decoded);
+    if (result != FrameResult::FRAME_OK || !decoded)
+    {
+        ESP_LOGE(SERVER_BLUETOOTH_HANDLER_TAG, "Unable to decode sensor frame samples: %s", FRAME_RESULT_TO_STRING(result));
+        return {};
+    }
 
-    // Check if Temperature block is in data vector
-    if (content & 0x80)
-        ExtractData<float>(sensorDataCopy, eventData, &GreenhouseBluetoothEventData::SetTemperature);
+    // Rebuild full samples from deltas in order of arrival
+    auto samples = eventData->GetSampleStorage();
+    for (size_t i = 0; i < decoded; ++i)
+    {
+        result = mDeltaCache.Apply(header.clientID, samples[i]);
+        if (result != FrameResult::FRAME_OK)
+        {
+            ESP_LOGE(SERVER_BLUETOOTH_HANDLER_TAG, "Unable to rebuild sample of client %d: %s", header.clientID, FRAME_RESULT_TO_STRING(result));
+            return {};
+        }
+    }
+
+    eventData->SetSampleCount(decoded);
 
 #ifdef CONFIG_LOG_DEFAULT_LEVEL_DEBUG
     ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Client ID: %d", eventData->GetClientID());
     ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Position: %d", eventData->GetPosition());
-    if (eventData->IsTemperatureSet())
-        ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Temperature: %.2f °C", eventData->GetTemperature());
-    if (eventData->IsHumiditySet())
-        ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Humidity: %.2f %%", eventData->GetHumidity());
-    if (eventData->IsCO2Set())
-        ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "CO2: %d ppm", eventData->GetCO2());
-    if (eventData->IsSoilMoistureSet())
-        ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Soil moisture: %.2f %%", eventData->GetSoilMoisture());
+    for (size_t i = 0; i < eventData->GetSampleCount(); ++i)
+    {
+        const auto &sample = eventData->GetSample(i);
+        ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Sample %d measured %d s ago", static_cast<int>(i), sample.age);
+        if (sample.content & ContentBit<TemperatureField>())
+            ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Temperature: %.2f °C", sample.temperature);
+        if (sample.content & ContentBit<HumidityField>())
+            ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Humidity: %.2f %%", sample.humidity);
+        if (sample.content & ContentBit<CO2Field>())
+            ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "CO2: %.0f ppm", sample.co2);
+        if (sample.content & ContentBit<SoilMoistureField>())
+            ESP_LOGD(SERVER_BLUETOOTH_HANDLER_TAG, "Soil moisture: %.2f %%", sample.soilMoisture);
+    }
+
+    pool->LogOccupancy();
 #endif
 
-    return true;
+    return eventData;
 }
@@ -8,11 +8,15 @@
 
 /* Project specific includes */
 #include "ServerBluetoothController.hpp"
+#include "ClientSessionTable.hpp"
 #include "Managers/EventManager.hpp"
+#include "Managers/EventDataPool.hpp"
 
 /* Common components */
 #include "Bluetooth/BluetoothDefinitions.hpp"
 #include "Bluetooth/Interfaces/BaseBluetoothHandlerInterface.hpp"
+#include "Protocol/SensorDelta.hpp"
+#include "Protocol/SensorFrame.hpp"
 
 /* STD library includes */
 #include <memory>
@@ -104,29 +108,25 @@ namespace Greenhouse
             void GreenhouseEventHandler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
 
             /**
-             * @brief Extract data from vector during parsing bluetooth data
+             * @brief Decode sensor frame from bluetooth write event into new event data structure.
+             *        Delta samples are rebuilt into full samples from last known state of client
              *
-             * @param[in] data              : Data from bluetooth write event
-             * @param[in] eventDataClass    : Event data class for storing incoming bluetooth data
-             * @param[in] SetFunction       : Setting function
-             */
-            template <typename T>
-            void ExtractData(std::vector<uint8_t> &data, GreenhouseBluetoothEventData *eventDataClass, void (GreenhouseBluetoothEventData::*SetFunction)(T)) const;
-
-            /**
-             * @brief Parse data from bluettoth wrte event to event data structure
+             * @param[in] sensorData    : View of received sensor frame inside BLE stack buffer
              *
-             * @param[in] sensorData    : Vector of sensor data
-             * @param[in] eventData     : Event data structure
-             *
-             * @return bool             : true  - if parsing was successful
-             *                          : false - otherwise
+             * @return Handle       : Handle of event data acquired from event data pool.
+             *                        Empty if decoding failed or pool is exhausted
              */
-            bool ParseData(const std::vector<uint8_t> &sensorData, Component::Publisher::ClientBluetoothEventData_Greenhouse *eventData) const;
+            Greenhouse::Manager::EventDataPool::Handle ParseData(Component::Protocol::ByteView sensorData);
 
             /* Profiles map */
             Component::Bluetooth::ServerProfileMap mProfilesMap;
 
+            /* Sessions of connected clients */
+            ClientSessionTable mSessions;
+
+            /* Last known sensor state of every client */
+            Component::Protocol::DeltaStateCache<> mDeltaCache;
+
             bool mConfigAdvDataSet;
             bool mConfigResAdvDataSet;
         };
@@ -217,7 +217,7 @@ namespace Greenhouse
         static uint8_t char1_str[] = {0x11, 0x22, 0x33};
 
         static esp_attr_value_t char_value = {
-            .attr_max_len = 0x40,
+            .attr_max_len = GATT_LOCAL_MTU - ATT_WRITE_HEADER_SIZE,
             .attr_len = sizeof(char1_str),
             .attr_value = char1_str,
         };
@@ -0,0 +1,192 @@
+/* Project specific includes */
+#include "CommandDecoder.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
+
+/* STD library */
+#include <cstring>
+
+using namespace Greenhouse::Manager;
+using Component::Convertor::JsonEvent;
+using Component::Convertor::JsonEventType;
+using Component::Convertor::JsonStreamStatus;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Handle event of JSON parser
+ */
+void CommandDecoder::OnJsonEvent(const JsonEvent &event, void *context)
+{
+    static_cast<CommandDecoder *>(context)->HandleEvent(event);
+}
+
+/**
+ * @brief Handle event of JSON parser
+ */
+void CommandDecoder::HandleEvent(const JsonEvent &event)
+{
+    // Top level array holds bulk of commands
+    if (event.type == JsonEventType::ARRAY_BEGIN && !event.depth)
+    {
+        mCommandDepth = 1;
+        return;
+    }
+
+    if (event.type == JsonEventType::OBJECT_BEGIN && event.depth == mCommandDepth)
+    {
+        mCommand = {mDefaultTarget, false};
+        mHasRequested = false;
+        mKey = Key::OTHER;
+        return;
+    }
+
+    if (event.type == JsonEventType::OBJECT_END && event.depth == mCommandDepth)
+    {
+        if (mCommand.target == CommandTarget::TARGET_NONE || !mHasRequested)
+        {
+            ESP_LOGW(COMMAND_DECODER_TAG, "Command without target or requested state ignored");
+            return;
+        }
+
+        ++mCommandCount;
+        mHandler(mCommand, mContext);
+        return;
+    }
+
+    // Only members of command object are decoded
+    if (event.depth != mCommandDepth + 1)
+        return;
+
+    switch (event.type)
+    {
+    case (JsonEventType::KEY):
+        if (event.length == strlen("target") && !memcmp(event.text, "target", event.length))
+            mKey = Key::TARGET;
+        else if (event.length == strlen("requested") && !memcmp(event.text, "requested", event.length))
+            mKey = Key::REQUESTED;
+        else
+            mKey = Key::OTHER;
+        break;
+    case (JsonEventType::STRING):
+        if (mKey == Key::TARGET)
+            mCommand.target = ParseTarget(event.text, event.length);
+        break;
+    case (JsonEventType::NUMBER):
+        if (mKey == Key::REQUESTED)
+        {
+            mCommand.requested = event.number != 0;
+            mHasRequested = true;
+        }
+        break;
+    case (JsonEventType::BOOL):
+        if (mKey == Key::REQUESTED)
+        {
+            mCommand.requested = event.boolean;
+            mHasRequested = true;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Convert target name to target
+ */
+CommandTarget CommandDecoder::ParseTarget(const char *name, size_t length)
+{
+    if (length == strlen("window") && !memcmp(name, "window", length))
+        return CommandTarget::TARGET_WINDOW;
+
+    if (length == strlen("irrigation") && !memcmp(name, "irrigation", length))
+        return CommandTarget::TARGET_IRRIGATION;
+
+    return CommandTarget::TARGET_NONE;
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+CommandDecoder::CommandDecoder(Handler_T handler, void *context)
+    : mHandler(handler),
+      mContext(context),
+      mParser(&CommandDecoder::OnJsonEvent, this),
+      mDefaultTarget(CommandTarget::TARGET_NONE),
+      mCommand{CommandTarget::TARGET_NONE, false},
+      mHasRequested(false),
+      mKey(Key::OTHER),
+      mCommandDepth(0),
+      mLength(0),
+      mOffset(0),
+      mCommandCount(0),
+      mActive(false)
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+CommandDecoder::~CommandDecoder()
+{
+}
+
+/**
+ * @brief Start new message
+ */
+void CommandDecoder::Begin(CommandTarget target, size_t length)
+{
+    if (mActive)
+        ESP_LOGW(COMMAND_DECODER_TAG, "Unfinished command message discarded at %d of %d bytes",
+                 static_cast<int>(mOffset), static_cast<int>(mLength));
+
+    mParser.Reset();
+    mDefaultTarget = target;
+    mCommandDepth = 0;
+    mLength = length;
+    mOffset = 0;
+    mCommandCount = 0;
+    mActive = true;
+}
+
+/**
+ * @brief Decode next fragment of message
+ */
+bool CommandDecoder::Feed(const char *data, size_t length, size_t offset)
+{
+    if (!mActive)
+        return false;
+
+    if (offset != mOffset || offset + length > mLength)
+    {
+        ESP_LOGE(COMMAND_DECODER_TAG, "Fragment at %d does not follow %d", static_cast<int>(offset), static_cast<int>(mOffset));
+        mActive = false;
+        return false;
+    }
+
+    mOffset += length;
+
+    auto status = mParser.Feed(data, length);
+    if (mOffset == mLength)
+    {
+        status = mParser.Finish();
+        mActive = false;
+    }
+
+    if (status != JsonStreamStatus::IN_PROGRESS && status != JsonStreamStatus::COMPLETE)
+    {
+        ESP_LOGE(COMMAND_DECODER_TAG, "Invalid command message, error %d after %d commands",
+                 static_cast<int>(status), static_cast<int>(mCommandCount));
+        mActive = false;
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,162 @@
+/**
+ * Decoder of actuator commands received over MQTT
+ *
+ * Command message is either one object or array of objects:
+ *  {"requested": 1}
+ *  [{"target": "window", "requested": true}, {"target": "irrigation", "requested": false}]
+ * Target defaults to target of topic, so "target" is needed only in bulk messages on commands topic.
+ * Unknown keys and nested values are ignored. Every command is emitted as soon as its object is closed,
+ * so bulk message of any size is decoded with fixed memory.
+ *
+ * @author Dominik Regec
+ */
+#ifndef COMMAND_DECODER_H
+#define COMMAND_DECODER_H
+
+/* Common components includes */
+#include "Convertors/JsonStreamParser.hpp"
+
+/* STD library */
+#include <cstddef>
+#include <cstdint>
+
+#define COMMAND_DECODER_TAG "Command decoder"
+
+namespace Greenhouse
+{
+    namespace Manager
+    {
+        /* Actuator controlled by command */
+        enum class CommandTarget
+        {
+            TARGET_NONE,
+            TARGET_WINDOW,
+            TARGET_IRRIGATION,
+        };
+
+        /* Decoded command */
+        struct Command
+        {
+            CommandTarget target;
+            // Requested state, true - window open or irrigation on
+            bool requested;
+        };
+
+        class CommandDecoder
+        {
+        public:
+            /* Handler of decoded command */
+            using Handler_T = void (*)(const Command &command, void *context);
+
+            /**
+             * @brief Class constructor
+             *
+             * @param[in] handler   : Handler of decoded commands
+             * @param[in] context   : Context passed to handler
+             */
+            explicit CommandDecoder(Handler_T handler, void *context);
+
+            /**
+             * @brief Class destructor
+             */
+            ~CommandDecoder();
+
+            /**
+             * @brief Start new message. Unfinished message is discarded
+             *
+             * @param[in] target    : Target of commands without "target" key
+             * @param[in] length    : Total length of message
+             */
+            void Begin(CommandTarget target, size_t length);
+
+            /**
+             * @brief Decode next fragment of message
+             *
+             * @param[in] data      : Fragment
+             * @param[in] length    : Length of fragment
+             * @param[in] offset    : Offset of fragment in message
+             *
+             * @return bool         : True  - fragment was accepted
+             *                        False - message is invalid or fragment is out of order
+             */
+            bool Feed(const char *data, size_t length, size_t offset);
+
+            /**
+             * @brief Discard unfinished message
+             */
+            void Cancel() { mActive = false; }
+
+            /**
+             * @brief Check if message is being decoded
+             */
+            bool IsActive() const { return mActive; }
+
+            /**
+             * @brief Get number of commands emitted from current or last message
+             */
+            size_t GetCommandCount() const { return mCommandCount; }
+
+        private:
+            /**
+             * @brief Handle event of JSON parser
+             */
+            static void OnJsonEvent(const Component::Convertor::JsonEvent &event, void *context);
+
+            /**
+             * @brief Handle event of JSON parser
+             */
+            void HandleEvent(const Component::Convertor::JsonEvent &event);
+
+            /**
+             * @brief Convert target name to target
+             */
+            static CommandTarget ParseTarget(const char *name, size_t length);
+
+            /* Key of command member */
+            enum class Key
+            {
+                OTHER,
+                TARGET,
+                REQUESTED,
+            };
+
+            /* Handler of decoded commands */
+            const Handler_T mHandler;
+
+            /* Context passed to handler */
+            void *const mContext;
+
+            /* Incremental JSON parser */
+            Component::Convertor::JsonStreamParser mParser;
+
+            /* Target of commands without target key */
+            CommandTarget mDefaultTarget;
+
+            /* Command being decoded */
+            Command mCommand;
+
+            /* True when requested state was set in command */
+            bool mHasRequested;
+
+            /* Key of current member */
+            Key mKey;
+
+            /* Depth of command objects, 0 for single object, 1 for bulk array */
+            size_t mCommandDepth;
+
+            /* Total length of message */
+            size_t mLength;
+
+            /* Offset of next expected fragment */
+            size_t mOffset;
+
+            /* Number of emitted commands */
+            size_t mCommandCount;
+
+            /* True when message is being decoded */
+            bool mActive;
+        };
+    } // namespace Manager
+} // namespace Greenhouse
+
+#endif // COMMAND_DECODER_H
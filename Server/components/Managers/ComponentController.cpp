@@ -1,9 +1,16 @@
 #include "ComponentController.hpp"
+#include "EventManager.hpp"
+
+/* ESP log library */
+#include <esp_log.h>
 
 using namespace Greenhouse::Manager;
 
 #define MOTOR_MAX_ROTAION_FOR_WINDOW 180
 
+// Clock of water level sensor bus
+#define WATER_LEVEL_I2C_CLOCK 100000u
+
 ComponentController *ComponentController::mControllerInstance{nullptr};
 std::mutex ComponentController::mControllerMutex;
 
@@ -22,7 +29,22 @@ ComponentController::ComponentController()
       mWindowState{false},
       mWaterPump(new Component::Driver::Active::WaterPump(CONFIG_WATER_PUMP)),
       mIrrigationState{false}
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+      ,
+      mI2C(new Component::Driver::Communication::I2C(CONFIG_WATER_LEVEL_SDA, CONFIG_WATER_LEVEL_SCL)),
+      mWaterLevelSensor(new Component::Driver::Sensor::WaterLevelSensor(CONFIG_WATER_LEVEL_ADDRESS, mI2C))
+#endif
 {
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+  mI2C->SetMode(i2c_mode_t::I2C_MODE_MASTER, I2C_NUM_0, WATER_LEVEL_I2C_CLOCK);
+  if (mI2C->Activate() != ESP_OK)
+    ESP_LOGE(COMPONENT_CONTROLLER_TAG, "Activation of I2C for water level sensor failed");
+
+  // Monitor is started before pump can be turned on, tank is low until it is measured
+  if (!mWaterLevelSensor->StartMonitoring(CONFIG_WATER_LEVEL_THRESHOLD, CONFIG_WATER_LEVEL_HYSTERESIS,
+                                          pdMS_TO_TICKS(CONFIG_WATER_LEVEL_PERIOD_MS), &ComponentController::OnWaterLevel, this))
+    ESP_LOGE(COMPONENT_CONTROLLER_TAG, "Water level monitor was not started, irrigation is disabled");
+#endif
 }
 
 /**
@@ -36,6 +58,20 @@ ComponentController::~ComponentController()
     mWindowMotor = nullptr;
   }
 
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+  if (mWaterLevelSensor)
+  {
+    delete mWaterLevelSensor;
+    mWaterLevelSensor = nullptr;
+  }
+
+  if (mI2C)
+  {
+    delete mI2C;
+    mI2C = nullptr;
+  }
+#endif
+
   if (mWaterPump)
   {
     delete mWaterPump;
@@ -43,6 +79,27 @@ ComponentController::~ComponentController()
   }
 }
 
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+/**
+ * @brief Interlock of pump. Called by water level monitor when level crosses threshold
+ */
+void ComponentController::OnWaterLevel(bool low, uint8_t level, void *context)
+{
+  auto controller = static_cast<ComponentController *>(context);
+
+  // Pump is cut directly from monitor task, event only informs other components
+  if (low)
+  {
+    std::lock_guard<std::mutex> lock(controller->mPumpMutex);
+    controller->mWaterPump->TurnOff();
+    controller->mIrrigationState = false;
+  }
+
+  ESP_LOGW(COMPONENT_CONTROLLER_TAG, "Water level %d %% is %s threshold", static_cast<int>(level), low ? "below" : "above");
+  EventManager::GetInstance()->Notify<Component::Publisher::Events::WATER_LEVEL_CHANGED>({level, low});
+}
+#endif
+
 /*********************************************
  *              PUBLIC API                   *
  ********************************************/
@@ -102,10 +159,18 @@ bool ComponentController::WindowState() const
 /**
  * @brief Method to turn on irrigation
  */
-void ComponentController::TurnOnIrrigation()
+bool ComponentController::TurnOnIrrigation()
 {
+  std::lock_guard<std::mutex> lock(mPumpMutex);
+  if (IsWaterLevelLow())
+  {
+    ESP_LOGW(COMPONENT_CONTROLLER_TAG, "Water level in tank is low, irrigation stays off");
+    return false;
+  }
+
   mWaterPump->TurnOn();
   mIrrigationState = true;
+  return true;
 }
 
 /**
@@ -113,6 +178,7 @@ void ComponentController::TurnOnIrrigation()
  */
 void ComponentController::TurnOffIrrigation()
 {
+  std::lock_guard<std::mutex> lock(mPumpMutex);
   mWaterPump->TurnOff();
   mIrrigationState = false;
 }
@@ -131,4 +197,16 @@ bool ComponentController::IsIrrigationTurnOn() const
 bool ComponentController::IrrigationState() const
 {
   return mIrrigationState;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Check if water level in tank is low
+ */
+bool ComponentController::IsWaterLevelLow() const
+{
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+  return mWaterLevelSensor->IsLow();
+#else
+  return false;
+#endif
+}
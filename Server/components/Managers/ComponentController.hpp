@@ -4,10 +4,16 @@
 /* Commmon conponents */
 #include "Common_components/Drivers/Motor/StepMotor.hpp"
 #include "Common_components/Drivers/Active/WaterPump.hpp"
+#include "Common_components/Drivers/Communication/I2C.hpp"
+#include "Common_components/Drivers/Sensor/WaterLevelSensor.hpp"
 
 /* STD library */
+#include <atomic>
 #include <mutex>
 
+/* SDK config */
+#include "sdkconfig.h"
+
 #define COMPONENT_CONTROLLER_TAG "ComponentController"
 
 namespace Greenhouse
@@ -58,9 +64,12 @@ namespace Greenhouse
       bool WindowState() const;
 
       /**
-       * @brief Method to turn on irrigation
+       * @brief Method to turn on irrigation. Pump stays off while water level in tank is low
+       *
+       * @return bool   : true  - irrigation is turn on
+       *                : false - water level is low
        */
-      void TurnOnIrrigation();
+      bool TurnOnIrrigation();
 
       /**
        * @brief Method to turn off irrigation
@@ -83,6 +92,14 @@ namespace Greenhouse
        */
       bool IrrigationState() const;
 
+      /**
+       * @brief Check if water level in tank is low. Without water level sensor tank is never low
+       *
+       * @return bool   : true  - water level is low
+       *                : false - otherwise
+       */
+      bool IsWaterLevelLow() const;
+
     private:
       /**
        * @brief Class constructor
@@ -94,6 +111,17 @@ namespace Greenhouse
        */
       ~ComponentController();
 
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+      /**
+       * @brief Interlock of pump. Called by water level monitor when level crosses threshold
+       *
+       * @param[in] low     : Level is below threshold
+       * @param[in] level   : Water level in percentage
+       * @param[in] context : Pointer to component controller
+       */
+      static void OnWaterLevel(bool low, uint8_t level, void *context);
+#endif
+
       /* Singleton instance of component controller */
       static ComponentController *mControllerInstance;
 
@@ -110,7 +138,18 @@ namespace Greenhouse
       Component::Driver::Active::WaterPump *mWaterPump;
 
       /* Water pump state */
-      bool mIrrigationState;
+      std::atomic<bool> mIrrigationState;
+
+      /* Serialize switching of pump between callers and interlock */
+      std::mutex mPumpMutex;
+
+#ifdef CONFIG_WATER_LEVEL_SENSOR
+      /* I2C bus of water level sensor */
+      Component::Driver::Communication::I2C *mI2C;
+
+      /* Water level sensor of tank */
+      Component::Driver::Sensor::WaterLevelSensor *mWaterLevelSensor;
+#endif
     };
   } // namespace Manager
 } // namespace Greenhouse
@@ -0,0 +1,53 @@
+/* Project specific includes */
+#include "EventDataPool.hpp"
+
+/* ESP log library includes */
+#include "esp_log.h"
+
+using namespace Greenhouse::Manager;
+
+EventDataPool *EventDataPool::mPoolInstance{nullptr};
+std::mutex EventDataPool::mPoolMutex;
+
+/*********************************************
+ *              PRIVATE API                  *
+ ********************************************/
+
+/**
+ * @brief Class constructor
+ */
+EventDataPool::EventDataPool()
+{
+}
+
+/**
+ * @brief Class destructor
+ */
+EventDataPool::~EventDataPool()
+{
+}
+
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
+
+/**
+ * @brief Static method to get singleton instance of event data pool
+ */
+EventDataPool *EventDataPool::GetInstance()
+{
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    if (!mPoolInstance)
+        mPoolInstance = new EventDataPool();
+
+    return mPoolInstance;
+}
+
+/**
+ * @brief Log current occupancy of pool
+ */
+void EventDataPool::LogOccupancy() const
+{
+    ESP_LOGD(EVENT_DATA_POOL_TAG, "Event data pool: %d/%d in use, peak %d, failed %d", static_cast<int>(InUse()),
+             static_cast<int>(GetCapacity()), static_cast<int>(Peak()), static_cast<int>(Failed()));
+}
@@ -0,0 +1,56 @@
+#ifndef EVENT_DATA_POOL_H
+#define EVENT_DATA_POOL_H
+
+/* Common components includes */
+#include "Publisher/EventData.hpp"
+#include "Utility/Memory/ObjectPool.hpp"
+
+/* SDK config */
+#include "sdkconfig.h"
+
+/* STD includes */
+#include <mutex>
+
+#define EVENT_DATA_POOL_TAG "EventDataPool"
+
+namespace Greenhouse
+{
+    namespace Manager
+    {
+        class EventDataPool : public Utility::Memory::ObjectPool<Component::Publisher::ClientBluetoothEventData_Greenhouse,
+                                                                 CONFIG_BLUETOOTH_EVENT_POOL_SIZE>
+        {
+        public:
+            /**
+             * @brief Static method to get singleton instance of event data pool
+             *
+             * @return EventDataPool : Pointer to singleton instance
+             */
+            static EventDataPool *GetInstance();
+
+            /**
+             * @brief Log current occupancy of pool
+             */
+            void LogOccupancy() const;
+
+        private:
+            /**
+             * @brief Class constructor
+             */
+            explicit EventDataPool();
+
+            /**
+             * @brief Class destructor
+             */
+            ~EventDataPool();
+
+            /* Singleton instance of event data pool */
+            static EventDataPool *mPoolInstance;
+
+            /* Singleton mutex to protect instance from multithread */
+            static std::mutex mPoolMutex;
+        };
+    } // namespace Manager
+} // namespace Greenhouse
+
+#endif // EVENT_DATA_POOL_H
@@ -1,12 +1,9 @@
 /* Project specific includes */
 #include "EventManager.hpp"
 
-/* ESP log library includes */
-#include "esp_log.h"
-
-/* STL library includes */
-#include <algorithm>
-#include <utility>
+// Dispatcher task configuration
+#define EVENT_DISPATCHER_STACK_SIZE 4096
+#define EVENT_DISPATCHER_PRIORITY (tskIDLE_PRIORITY + 2)
 
 using namespace Greenhouse::Manager;
 
@@ -20,8 +17,11 @@ std::mutex EventManager::mManagerMutex;
 /**
  * @brief Class constructor
  */
-EventManager::EventManager()
+EventManager::EventManager() : mDispatcher(nullptr)
 {
+    if (xTaskCreate(&EventManager::DispatcherTask, "EventDispatcher", EVENT_DISPATCHER_STACK_SIZE, this,
+                    EVENT_DISPATCHER_PRIORITY, &mDispatcher) != pdPASS)
+        ESP_LOGE(EVENT_MANAGER_TAG, "Unable to create event dispatcher task");
 }
 
 /**
@@ -29,90 +29,64 @@ EventManager::EventManager()
  */
 EventManager::~EventManager()
 {
+    if (mDispatcher)
+        vTaskDelete(mDispatcher);
 }
 
-/*********************************************
- *              PUBLIC API                   *
- ********************************************/
 /**
- * @brief Static method to get singleton instance of Event manager
+ * @brief Wake dispatcher task after event was queued
  */
-EventManager *EventManager::GetInstance()
+void EventManager::WakeDispatcher()
 {
-    std::lock_guard<std::mutex> lock(mManagerMutex);
-    if (!mManagerInstance)
-        mManagerInstance = new EventManager();
-
-    return mManagerInstance;
+    if (mDispatcher)
+        xTaskNotifyGive(mDispatcher);
 }
 
 /**
- * @brief Method to subscribe observer to EventManager
- *
- * @param[in] observer  : Pointer to observer object
+ * @brief Dispatch one queued event with the highest priority
  */
-void EventManager::Subscribe(Event_T event, Observer_T *observer)
+bool EventManager::DispatchNext()
 {
-    if (!observer)
-        return;
+    using namespace Component::Publisher;
 
-    auto eventObserversItr = mObservers.find(event);
-    if (eventObserversItr == mObservers.end())
-        mObservers.insert({event, {observer}});
-    else
-        eventObserversItr->second.emplace(observer);
+    for (size_t lane = 0; lane < LANES_COUNT; ++lane)
+    {
+        if (mChannels.DispatchNext(static_cast<EventLane>(lane)))
+            return true;
+    }
 
-    ESP_LOGD(EVENT_MANAGER_TAG, "Observer is now subscribing.");
+    return false;
 }
 
 /**
- * @brief Method to unsubscribe observer from EventManager
- *
- * @param[in] observer  : Pointer to observer object
+ * @brief Dispatcher task body
  */
-void EventManager::Unsubscribe(Event_T event, Observer_T *observer)
+void EventManager::DispatcherTask(void *arg)
 {
-    if (!observer)
-        return;
+    auto manager = static_cast<EventManager *>(arg);
 
-    auto observersMapItr = mObservers.find(event);
-    if (observersMapItr == mObservers.end())
+    while (true)
     {
-        ESP_LOGD(EVENT_MANAGER_TAG, "Provided event not found in observers map.");
-        return;
-    }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-    auto observersEventSetItr = observersMapItr->second.find(observer);
-    if (observersEventSetItr == observersMapItr->second.end())
-    {
-        ESP_LOGD(EVENT_MANAGER_TAG, "Provided observer not found in observers map.");
-        return;
+        // After every event queues are scanned again from the highest priority lane
+        while (manager->DispatchNext())
+        {
+        }
     }
-
-    observersMapItr->second.erase(observersEventSetItr);
-    ESP_LOGD(EVENT_MANAGER_TAG, "Observer is no longer subscribe.");
 }
 
+/*********************************************
+ *              PUBLIC API                   *
+ ********************************************/
 /**
- * @brief Method to notify observer about new data from bluetooth handler
+ * @brief Static method to get singleton instance of Event manager
  */
-void EventManager::Notify(Event_T event, Component::Publisher::EventData *eventData)
+EventManager *EventManager::GetInstance()
 {
-    ESP_LOGI(EVENT_MANAGER_TAG, "Notify about %s event.", Component::Publisher::EnumToString(event).c_str());
-
-    auto eventObservers = mObservers.find(event);
-    if (eventObservers == mObservers.end())
-    {
-        ESP_LOGE(EVENT_MANAGER_TAG, "Provided event not found in observers map.");
-        return;
-    }
-
-    if (eventObservers->second.empty())
-    {
-        ESP_LOGW(EVENT_MANAGER_TAG, "No observers found to have interested about event");
-        return;
-    }
+    std::lock_guard<std::mutex> lock(mManagerMutex);
+    if (!mManagerInstance)
+        mManagerInstance = new EventManager();
 
-    for (const auto &observer : eventObservers->second)
-        observer->Update(eventData);
-}
\ No newline at end of file
+    return mManagerInstance;
+}
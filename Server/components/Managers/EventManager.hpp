@@ -2,12 +2,21 @@
 #define EVENT_MANAGER_H
 
 /* Common components includes */
-#include "Publisher/PublisherInterface.hpp"
+#include "Publisher/Channel.hpp"
+
+/* Project specific includes */
+#include "EventTraits.hpp"
+
+/* ESP log library includes */
+#include "esp_log.h"
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 /* STD includes */
 #include <mutex>
-#include <unordered_set>
-#include <map>
+#include <utility>
 
 #define EVENT_MANAGER_TAG "EventManager"
 
@@ -15,15 +24,20 @@ namespace Greenhouse
 {
     namespace Manager
     {
-        class EventManager : public Component::Publisher::Interface::PublisherInterface
+        class EventManager
         {
         public:
-            // typedef for observer component interface
-            using Observer_T = Component::Observer::Interface::ObserverInterface;
-
             // typed for component publisher event
             using Event_T = Component::Publisher::Events;
 
+            // typedef for channel of event
+            template <Event_T Event>
+            using Channel_T = Component::Publisher::Channel<Event>;
+
+            // typedef for payload of event
+            template <Event_T Event>
+            using Payload_T = typename Component::Publisher::EventTraits<Event>::Payload_T;
+
             /**
              * @brief Static method to get singleton instance of Event manager
              *
@@ -32,27 +46,80 @@ namespace Greenhouse
             static EventManager *GetInstance();
 
             /**
-             * @brief Method to subscribe observer to EventManager
+             * @brief Method to subscribe callback to event.
+             *        Must not be called from subscriber callback.
+             *
+             * @tparam Event        : Event
+             *
+             * @param[in] handler   : Subscriber callback
+             * @param[in] context   : Context passed to callback
              *
-             * @param[in] observer  : Pointer to observer object
+             * @return bool         : True  - subscriber is registered
+             *                        False - subscriber table of event is full
              */
-            void Subscribe(Event_T event, Observer_T *observer) override;
+            template <Event_T Event>
+            bool Subscribe(typename Channel_T<Event>::Handler_T handler, void *context)
+            {
+                return mChannels.Get<Event>().Subscribe(handler, context);
+            }
 
             /**
-             * @brief Method to unsubscribe observer from EventManager
+             * @brief Method to unsubscribe callback from event.
+             *        Must not be called from subscriber callback.
+             *
+             * @tparam Event        : Event
+             *
+             * @param[in] handler   : Subscriber callback
+             * @param[in] context   : Context passed to callback
+             */
+            template <Event_T Event>
+            void Unsubscribe(typename Channel_T<Event>::Handler_T handler, void *context)
+            {
+                mChannels.Get<Event>().Unsubscribe(handler, context);
+            }
+
+            /**
+             * @brief Method to queue event for asynchronous dispatch to subscribers.
+             *        Takes constant time and never blocks, so it is safe to call from bluetooth callbacks.
+             *
+             * @tparam Event        : Event
+             *
+             * @param[in] payload   : Event payload. It is moved only when event was queued
              *
-             * @param[in] observer  : Pointer to observer object
+             * @return bool         : True  - event was queued
+             *                        False - event has no subscribers or its queue is full
              */
-            void Unsubscribe(Event_T event, Observer_T *observer) override;
+            template <Event_T Event>
+            bool Notify(Payload_T<Event> &&payload)
+            {
+                if (!mChannels.Get<Event>().Publish(std::move(payload)))
+                {
+                    ESP_LOGW(EVENT_MANAGER_TAG, "%s event rejected.", Component::Publisher::EnumToString(Event).c_str());
+                    return false;
+                }
+
+                WakeDispatcher();
+                return true;
+            }
 
             /**
-             * @brief Method to notify observer about new event from E
+             * @brief Get number of events rejected because of full queue
+             *
+             * @tparam Event        : Event
+             *
+             * @return uint32_t     : Number of dropped events
              */
-            void Notify(Event_T event, Component::Publisher::EventData *eventData) override;
+            template <Event_T Event>
+            uint32_t GetDroppedEvents()
+            {
+                return mChannels.Get<Event>().GetDropped();
+            }
 
         private:
-            /* Map consist of pointer to observers follow specific event*/
-            using ObserversEventMap = std::map<Event_T, std::unordered_set<Observer_T *>>;
+            /* Channels of all events. Channels of the same lane are dispatched in this order */
+            using ChannelTable_T = Component::Publisher::ChannelTable<Event_T::WATER_LEVEL_CHANGED, Event_T::BLUETOOTH_DATA_RECEIVED>;
+
+            static_assert(ChannelTable_T::SIZE == Component::Publisher::EVENTS_COUNT, "Every event needs its channel");
 
             /**
              * @brief Class constructor
@@ -64,16 +131,39 @@ namespace Greenhouse
              */
             ~EventManager();
 
+            /**
+             * @brief Wake dispatcher task after event was queued
+             */
+            void WakeDispatcher();
+
+            /**
+             * @brief Dispatch one queued event with the highest priority
+             *
+             * @return bool         : True  - event was dispatched
+             *                        False - all queues are empty
+             */
+            bool DispatchNext();
+
+            /**
+             * @brief Dispatcher task body
+             *
+             * @param[in] arg       : Pointer to event manager
+             */
+            static void DispatcherTask(void *arg);
+
             /* Singleton instance of Event manager */
             static EventManager *mManagerInstance;
 
             /* Singleton mutex to protect instance from multithread */
             static std::mutex mManagerMutex;
 
-            /* Observers events map */
-            ObserversEventMap mObservers;
+            /* Channels of events */
+            ChannelTable_T mChannels;
+
+            /* Dispatcher task */
+            TaskHandle_t mDispatcher;
         };
     } // namespace Manager
 } // namepsace Greenhouse
 
-#endif // EVENT_MANAGER_H
\ No newline at end of file
+#endif // EVENT_MANAGER_H
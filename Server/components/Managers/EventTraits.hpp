@@ -0,0 +1,44 @@
+#ifndef EVENT_TRAITS_H
+#define EVENT_TRAITS_H
+
+/* Common components includes */
+#include "Publisher/Channel.hpp"
+
+/* Common components includes */
+#include "Publisher/EventData.hpp"
+
+/* Project specific includes */
+#include "EventDataPool.hpp"
+
+/* SDK config */
+#include "sdkconfig.h"
+
+namespace Component
+{
+    namespace Publisher
+    {
+        /* New sensor frame received from client. Payload owns event data from event data pool */
+        template <>
+        struct EventTraits<Events::BLUETOOTH_DATA_RECEIVED>
+        {
+            using Payload_T = Greenhouse::Manager::EventDataPool::Handle;
+
+            static constexpr EventLane LANE = EventLane::TELEMETRY;
+            static constexpr size_t DEPTH = CONFIG_EVENT_QUEUE_DEPTH;
+            static constexpr size_t SUBSCRIBERS = CONFIG_EVENT_MAX_OBSERVERS;
+        };
+
+        /* Water level crossed threshold. Pump is already stopped by interlock when event is published */
+        template <>
+        struct EventTraits<Events::WATER_LEVEL_CHANGED>
+        {
+            using Payload_T = WaterLevelEventData;
+
+            static constexpr EventLane LANE = EventLane::CONTROL;
+            static constexpr size_t DEPTH = 4;
+            static constexpr size_t SUBSCRIBERS = CONFIG_EVENT_MAX_OBSERVERS;
+        };
+    } // namespace Publisher
+} // namespace Component
+
+#endif // EVENT_TRAITS_H
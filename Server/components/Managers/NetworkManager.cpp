@@ -10,9 +10,21 @@
 /* STD library */
 #include <algorithm>
 
+#ifdef CONFIG_MQTT_OUTBOX
+#ifdef CONFIG_IDF_TARGET_LINUX
+#include <Utility/Storage/FileStorage.hpp>
+#else
+#include <Utility/Storage/PartitionStorage.hpp>
+#endif
+#endif
+
 /* SDK config file */
 #include "sdkconfig.h"
 
+// Outbox drain task configuration
+#define MQTT_OUTBOX_TASK_STACK_SIZE 4096
+#define MQTT_OUTBOX_TASK_PRIORITY (tskIDLE_PRIORITY + 1)
+
 using namespace Greenhouse::Manager;
 
 NetworkManager *NetworkManager::mInstance{nullptr};
@@ -29,9 +41,46 @@ NetworkManager::NetworkManager()
 		: mWifiDriver(nullptr),
 			mWifiConnectionTracker(nullptr),
 			//	mWifiConnectionHolder(nullptr),
-			mMQTT_Client(nullptr)
+			mMQTT_Client(nullptr),
+			mCommandTarget(CommandTarget::TARGET_NONE),
+			mCommandDecoder(&NetworkManager::OnDecodedCommand, this),
+			mPublishBuffer(),
+			mPublishWriter(Utility::DataType::Span<PayloadByte>(mPublishBuffer)),
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+			mBatchRecords(0),
+			mBatchTimer(nullptr),
+#endif
+			mConnected(false)
+#ifdef CONFIG_MQTT_OUTBOX
+			,
+			mOutboxStorage(nullptr),
+			mOutbox(nullptr),
+			mDrainBuffer(),
+			mDrainTask(nullptr),
+			mDrainStart(0),
+			mDrainedRecords(0)
+#endif
 {
 	mBluetoothObserver = new Observer::BluetoothDataObserver(EventManager::GetInstance());
+
+	if (!EventManager::GetInstance()->Subscribe<Component::Publisher::Events::WATER_LEVEL_CHANGED>(&NetworkManager::OnWaterLevel, this))
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Unable to subscribe water level event");
+
+	RegisterCommandTopics();
+
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+	const esp_timer_create_args_t timerConfig = {
+			.callback = &NetworkManager::BatchTimerCallback,
+			.arg = this,
+			.dispatch_method = ESP_TIMER_TASK,
+			.name = "MQTT batch"};
+
+	ESP_ERROR_CHECK(esp_timer_create(&timerConfig, &mBatchTimer));
+#endif
+
+#ifdef CONFIG_MQTT_OUTBOX
+	InitOutbox();
+#endif
 }
 
 /**
@@ -50,6 +99,22 @@ NetworkManager::~NetworkManager()
 		delete mMQTT_Client;
 		mMQTT_Client = nullptr;
 	}
+
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+	if (mBatchTimer)
+	{
+		esp_timer_stop(mBatchTimer);
+		esp_timer_delete(mBatchTimer);
+	}
+#endif
+
+#ifdef CONFIG_MQTT_OUTBOX
+	if (mDrainTask)
+		vTaskDelete(mDrainTask);
+
+	delete mOutbox;
+	delete mOutboxStorage;
+#endif
 }
 
 /**
@@ -83,16 +148,34 @@ void NetworkManager::MQTT_EventHandler(void *handlerArg, esp_event_base_t base,
 		auto network_manager = reinterpret_cast<NetworkManager *>(handlerArg);
 
 		ESP_LOGI(NETWORK_MANAGER_TAG, "MQTT Client is connected to MQTT Broker.");
+		network_manager->mConnected = true;
+
 		// Send basic infor about board
 		network_manager->SendInfoToServer();
 
 		// Subscribe all topics in greenhouse_topics data structure
 		network_manager->SubscribeTopics();
+
+#ifdef CONFIG_MQTT_OUTBOX
+		// Send data stored while broker was not reachable
+		if (network_manager->mDrainTask && network_manager->mOutbox->GetStatistics().backlog)
+			xTaskNotifyGive(network_manager->mDrainTask);
+#endif
 		break;
 	}
 	case (MQTT_EVENT_DISCONNECTED):
 	{
+		auto network_manager = reinterpret_cast<NetworkManager *>(handlerArg);
+
 		ESP_LOGI(NETWORK_MANAGER_TAG, "MQTT Client has been disconnected from MQTT Broker.");
+		network_manager->mConnected = false;
+
+#ifdef CONFIG_MQTT_OUTBOX
+		// Drain task stops by itself when it finds client disconnected
+		if (network_manager->mOutbox)
+			ESP_LOGI(NETWORK_MANAGER_TAG, "Sensors data are stored into outbox, backlog %d records.",
+							 static_cast<int>(network_manager->mOutbox->GetStatistics().backlog));
+#endif
 		break;
 	}
 	case MQTT_EVENT_PUBLISHED:
@@ -116,6 +199,230 @@ void NetworkManager::MQTT_EventHandler(void *handlerArg, esp_event_base_t base,
 	}
 }
 
+/**
+ * @brief Publish formatted sensors data
+ */
+void NetworkManager::Deliver(const std::string &topic, const void *data, size_t length, bool retain)
+{
+#ifdef CONFIG_MQTT_OUTBOX
+	// Outbox holds only sensors data, they are drained into sensor data topic.
+	// New records wait behind stored ones, so server receives data in order of measurement
+	if (mOutbox && (!mConnected || mOutbox->GetStatistics().backlog))
+	{
+		StoreInOutbox(data, length);
+		return;
+	}
+#endif
+
+	if (!mMQTT_Client)
+		return;
+
+	if (mMQTT_Client->Publish(topic, static_cast<const char *>(data), length, 1, retain) >= 0)
+		return;
+
+#ifdef CONFIG_MQTT_OUTBOX
+	// Record is sent again by drain task
+	if (mOutbox)
+	{
+		ESP_LOGW(NETWORK_MANAGER_TAG, "Publish of sensors data failed, data are stored into outbox.");
+		StoreInOutbox(data, length);
+		return;
+	}
+#endif
+
+	ESP_LOGW(NETWORK_MANAGER_TAG, "Publish of sensors data failed.");
+}
+
+#ifdef CONFIG_MQTT_OUTBOX
+/**
+ * @brief Create storage of outbox and recover records left from previous run
+ */
+void NetworkManager::InitOutbox()
+{
+#ifdef CONFIG_IDF_TARGET_LINUX
+	mOutboxStorage = new Utility::Storage::FileStorage(CONFIG_MQTT_OUTBOX_FILE_PATH, MQTT_OUTBOX_SECTOR_SIZE, CONFIG_MQTT_OUTBOX_SECTORS);
+#else
+	mOutboxStorage = new Utility::Storage::PartitionStorage(CONFIG_MQTT_OUTBOX_PARTITION_LABEL, CONFIG_MQTT_OUTBOX_SECTORS);
+#endif
+
+	mOutbox = new Utility::Storage::Outbox(*mOutboxStorage);
+	if (mOutbox->Init() != ESP_OK)
+	{
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Outbox is not available, sensors data are lost while broker is not reachable.");
+		delete mOutbox;
+		mOutbox = nullptr;
+		return;
+	}
+
+	// Records kept without drain task would hold back all newer data
+	if (xTaskCreate(&NetworkManager::DrainTask, "MQTT outbox", MQTT_OUTBOX_TASK_STACK_SIZE, this, MQTT_OUTBOX_TASK_PRIORITY,
+									&mDrainTask) != pdPASS)
+	{
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Unable to create outbox drain task, sensors data are lost while broker is not reachable.");
+		delete mOutbox;
+		mOutbox = nullptr;
+	}
+}
+
+/**
+ * @brief Store formatted sensors data into outbox and wake drain task when broker is connected
+ */
+void NetworkManager::StoreInOutbox(const void *data, size_t length)
+{
+	if (mOutbox->Push(data, length) != ESP_OK)
+	{
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Sensors data could not be stored into outbox.");
+		return;
+	}
+
+	if (mConnected && mDrainTask)
+		xTaskNotifyGive(mDrainTask);
+}
+
+/**
+ * @brief Send limited number of records from outbox
+ */
+bool NetworkManager::DrainOutbox()
+{
+	for (uint8_t i = 0; i < CONFIG_MQTT_OUTBOX_DRAIN_BURST; ++i)
+	{
+		if (!mConnected || !mMQTT_Client)
+			return false;
+
+		const auto length = mOutbox->Peek(mDrainBuffer.data(), mDrainBuffer.size());
+		if (!length)
+		{
+			const auto elapsed = (esp_timer_get_time() - mDrainStart) / 1000;
+			if (mDrainedRecords)
+				ESP_LOGI(NETWORK_MANAGER_TAG, "Outbox drained: %d records in %d ms", static_cast<int>(mDrainedRecords), static_cast<int>(elapsed));
+			return false;
+		}
+
+		// Stored data are not retained, they would replace newer retained message.
+		// Record stays in outbox until it is accepted by client, so failed publish is retried in next interval
+		if (mMQTT_Client->Publish(SENSOR_DATA, reinterpret_cast<const char *>(mDrainBuffer.data()), length, 1) < 0)
+			return true;
+
+		mOutbox->Pop();
+		++mDrainedRecords;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Outbox drain task body
+ */
+void NetworkManager::DrainTask(void *arg)
+{
+	auto network_manager = static_cast<NetworkManager *>(arg);
+
+	while (true)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		network_manager->mDrainStart = esp_timer_get_time();
+		network_manager->mDrainedRecords = 0;
+
+		while (network_manager->DrainOutbox())
+			vTaskDelay(pdMS_TO_TICKS(CONFIG_MQTT_OUTBOX_DRAIN_INTERVAL_MS));
+	}
+}
+#endif
+
+/**
+ * @brief Write sensors data as object in payload format
+ */
+void NetworkManager::WriteSensorsData(PayloadWriter &writer, const SensorsData &sensorsData)
+{
+	writer.BeginObject();
+	writer.Key("ID").Integer(CONFIG_Greenhouse_ID);
+	writer.Key("position").Integer(static_cast<uint8_t>(sensorsData.basic.position));
+
+	writer.Key("Data").BeginObject();
+	writer.Key("measure_time").Integer(sensorsData.basic.time);
+
+	if (sensorsData.air.temperature.IsValueSet())
+		writer.Key("temperature").Number(sensorsData.air.temperature.Get());
+
+	if (sensorsData.air.humidity.IsValueSet())
+		writer.Key("humidity").Number(sensorsData.air.humidity.Get());
+
+	if (sensorsData.air.co2.IsValueSet())
+		writer.Key("CO2").Integer(sensorsData.air.co2.Get());
+
+	if (sensorsData.soil.soilMoisture.IsValueSet())
+		writer.Key("soil_moisture").Number(sensorsData.soil.soilMoisture.Get());
+
+	writer.EndObject();
+	writer.EndObject();
+}
+
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+/**
+ * @brief Append sensors data into pending batch
+ */
+bool NetworkManager::AppendToBatch(const std::string &topic, const SensorsData &sensorsData)
+{
+	if (!mBatchRecords)
+	{
+		mPublishWriter.Reset();
+		mPublishWriter.BeginArray();
+		mBatchTopic = topic;
+	}
+
+	const auto checkpoint = mPublishWriter.Mark();
+	WriteSensorsData(mPublishWriter, sensorsData);
+
+	// End of batch has to fit as well
+	if (mPublishWriter.Overflowed() || mPublishWriter.Size() + 1 >= mPublishBuffer.size())
+	{
+		mPublishWriter.Rewind(checkpoint);
+		return false;
+	}
+
+	// Window of batch starts with its first record
+	if (!mBatchRecords)
+		esp_timer_start_once(mBatchTimer, static_cast<uint64_t>(CONFIG_MQTT_BATCH_WINDOW_MS) * 1000);
+
+	++mBatchRecords;
+	return true;
+}
+
+/**
+ * @brief Publish pending batch
+ */
+void NetworkManager::FlushBatch()
+{
+	if (!mBatchRecords)
+		return;
+
+	// Timer is not running when batch is flushed from its callback
+	esp_timer_stop(mBatchTimer);
+
+	mPublishWriter.EndArray();
+	if (mPublishWriter.IsComplete())
+		Deliver(mBatchTopic, mPublishWriter.Data(), mPublishWriter.Size(), false);
+
+	ESP_LOGD(NETWORK_MANAGER_TAG, "Published batch of %d records, %d bytes",
+					 static_cast<int>(mBatchRecords), static_cast<int>(mPublishWriter.Size()));
+
+	mBatchRecords = 0;
+	mPublishWriter.Reset();
+}
+
+/**
+ * @brief Callback of batch window timer
+ */
+void NetworkManager::BatchTimerCallback(void *arg)
+{
+	auto network_manager = static_cast<NetworkManager *>(arg);
+
+	std::lock_guard<std::mutex> lock(network_manager->mPublishMutex);
+	network_manager->FlushBatch();
+}
+#endif
+
 /*********************************************
  *              PUBLIC API                   *
  ********************************************/
@@ -256,14 +563,49 @@ void NetworkManager::SendInfoToServer() const
 	if (!mMQTT_Client)
 		return;
 
-	auto root = cJSON_CreateObject();
-	cJSON_AddNumberToObject(root, "ID", CONFIG_Greenhouse_ID);
-	cJSON_AddStringToObject(root, "Board", CONFIG_ESP_Board);
+	PayloadByte buffer[128];
+	PayloadWriter writer(buffer);
 
-	cJSON_AddStringToObject(root, "IP address", GetIpAddressAsString(true).c_str());
+	writer.BeginObject();
+	writer.Key("ID").Integer(CONFIG_Greenhouse_ID);
+	writer.Key("Board").String(CONFIG_ESP_Board);
+	writer.Key("IP address").String(GetIpAddressAsString(true).c_str());
+	writer.EndObject();
 
-	mMQTT_Client->Publish(INFO, cJSON_Print(root), 1);
-	cJSON_Delete(root);
+	if (!writer.IsComplete())
+	{
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Board info does not fit into buffer.");
+		return;
+	}
+
+	mMQTT_Client->Publish(INFO, reinterpret_cast<const char *>(writer.Data()), writer.Size(), 1);
+}
+
+/**
+ * @brief Report crossing of water level threshold to server
+ */
+void NetworkManager::OnWaterLevel(Component::Publisher::WaterLevelEventData &payload, void *context)
+{
+	auto network_manager = static_cast<NetworkManager *>(context);
+	if (!network_manager->mConnected || !network_manager->mMQTT_Client)
+		return;
+
+	PayloadByte buffer[64];
+	PayloadWriter writer(buffer);
+
+	writer.BeginObject();
+	writer.Key("ID").Integer(CONFIG_Greenhouse_ID);
+	writer.Key("level").Integer(payload.level);
+	writer.Key("low").Bool(payload.low);
+	writer.EndObject();
+
+	if (!writer.IsComplete())
+	{
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Water level does not fit into buffer.");
+		return;
+	}
+
+	network_manager->mMQTT_Client->Publish(WATER_LEVEL, reinterpret_cast<const char *>(writer.Data()), writer.Size(), 1, true);
 }
 
 /**
@@ -273,37 +615,91 @@ void NetworkManager::SendInfoToServer() const
  */
 void NetworkManager::Publish(const std::string &topic, const std::shared_ptr<SensorsData> sensorsData)
 {
-	auto root = cJSON_CreateObject();
-
-	cJSON_AddNumberToObject(root, "ID", CONFIG_Greenhouse_ID);
-	cJSON_AddNumberToObject(root, "position", static_cast<uint8_t>(sensorsData->basic.position));
+	std::lock_guard<std::mutex> lock(mPublishMutex);
 
-	auto data = cJSON_AddObjectToObject(root, "Data");
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+	// Batch holds records of one topic
+	if (mBatchRecords && topic != mBatchTopic)
+		FlushBatch();
 
-	cJSON_AddNumberToObject(data, "measure_time", sensorsData->basic.time);
+	// Record which does not fit starts new batch
+	if (!AppendToBatch(topic, *sensorsData))
+	{
+		FlushBatch();
+		if (!AppendToBatch(topic, *sensorsData))
+		{
+			ESP_LOGE(NETWORK_MANAGER_TAG, "Sensors data do not fit into publish buffer.");
+			return;
+		}
+	}
 
-	if (sensorsData->air.temperature.IsValueSet())
-		cJSON_AddNumberToObject(data, "temperature", sensorsData->air.temperature.Get());
+	if (mBatchRecords >= CONFIG_MQTT_BATCH_MAX_RECORDS)
+		FlushBatch();
+#else
+	mPublishWriter.Reset();
+	WriteSensorsData(mPublishWriter, *sensorsData);
 
-	if (sensorsData->air.humidity.IsValueSet())
-		cJSON_AddNumberToObject(data, "humidity", sensorsData->air.humidity.Get());
+	if (!mPublishWriter.IsComplete())
+	{
+		ESP_LOGE(NETWORK_MANAGER_TAG, "Sensors data do not fit into publish buffer.");
+		return;
+	}
 
-	if (sensorsData->air.co2.IsValueSet())
-		cJSON_AddNumberToObject(data, "CO2", sensorsData->air.co2.Get());
+	// MQTT client copies payload, so buffer can be reused right away
+	Deliver(topic, mPublishWriter.Data(), mPublishWriter.Size(), true);
+#endif
+}
 
-	if (sensorsData->soil.soilMoisture.IsValueSet())
-		cJSON_AddNumberToObject(data, "soil_moisture", sensorsData->soil.soilMoisture.Get());
+#ifdef CONFIG_MQTT_OUTBOX
+/**
+ * @brief Get counters of persistent outbox
+ */
+Utility::Storage::OutboxStatistics NetworkManager::GetOutboxStatistics()
+{
+	if (!mOutbox)
+		return {};
 
-	mMQTT_Client->Publish(topic, cJSON_Print(root), 1, true);
+	return mOutbox->GetStatistics();
 }
+#endif
 
 /**
- * @brief Method to subscribe all predefined topics
+ * @brief Method to subscribe all topics registered in topic router
  */
 void NetworkManager::SubscribeTopics()
 {
-	for (const auto &topic : greenhouse_topics)
-		mMQTT_Client->Subscribe(topic, 0);
+	for (size_t i = 0; i < mTopicRouter.GetFilterCount(); ++i)
+		mMQTT_Client->Subscribe(mTopicRouter.GetFilter(i), 0);
+}
+
+/**
+ * @brief Select target of commands received on topic
+ */
+template <CommandTarget Target>
+void NetworkManager::OnCommandTopic(Utility::Network::TopicView topic, Utility::Network::TopicView payload, void *context)
+{
+	static_cast<NetworkManager *>(context)->mCommandTarget = Target;
+}
+
+/**
+ * @brief Pass decoded command to network manager
+ */
+void NetworkManager::OnDecodedCommand(const Command &command, void *context)
+{
+	static_cast<NetworkManager *>(context)->ExecuteCommand(command);
+}
+
+/**
+ * @brief Register handlers of command topics
+ */
+void NetworkManager::RegisterCommandTopics()
+{
+	mTopicRouter.Register(WINDOW, &NetworkManager::OnCommandTopic<CommandTarget::TARGET_WINDOW>, this);
+	mTopicRouter.Register(WINDOW_ID, &NetworkManager::OnCommandTopic<CommandTarget::TARGET_WINDOW>, this);
+	mTopicRouter.Register(IRRIGATION, &NetworkManager::OnCommandTopic<CommandTarget::TARGET_IRRIGATION>, this);
+	mTopicRouter.Register(IRRIGATION_ID, &NetworkManager::OnCommandTopic<CommandTarget::TARGET_IRRIGATION>, this);
+	mTopicRouter.Register(COMMANDS, &NetworkManager::OnCommandTopic<CommandTarget::TARGET_NONE>, this);
+	mTopicRouter.Register(COMMANDS_ID, &NetworkManager::OnCommandTopic<CommandTarget::TARGET_NONE>, this);
 }
 
 /**
@@ -314,71 +710,63 @@ void NetworkManager::ProcessEventData(esp_mqtt_event_handle_t eventData)
 	if (!eventData)
 		return;
 
-	std::string topic;
-	topic.assign(eventData->topic, eventData->topic_len);
-
-	std::string data;
-	data.assign(eventData->data, eventData->data_len);
+	// Topic is present only in the first fragment of message
+	if (!eventData->current_data_offset)
+	{
+		const Utility::Network::TopicView topic(eventData->topic, eventData->topic_len);
+		const Utility::Network::TopicView payload(eventData->data, eventData->data_len);
 
-	auto json_data = cJSON_Parse(data.c_str());
-	if (!json_data)
-		return;
+		mCommandTarget = CommandTarget::TARGET_NONE;
+		if (!mTopicRouter.Dispatch(topic, payload))
+		{
+			ESP_LOGW(NETWORK_MANAGER_TAG, "No handler for topic %.*s", eventData->topic_len, eventData->topic);
+			mCommandDecoder.Cancel();
+			return;
+		}
 
-	if ((topic.compare(WINDOW) == 0) || (topic.compare(WINDOW_ID) == 0))
-	{
-		WindowEvent(json_data);
-		return;
+		mCommandDecoder.Begin(mCommandTarget, eventData->total_data_len);
 	}
-
-	if ((topic.compare(IRRIGATION) == 0) || (topic.compare(IRRIGATION_ID) == 0))
-	{
-		IrrigationEvent(json_data);
+	// Rest of message which was not routed
+	else if (!mCommandDecoder.IsActive())
 		return;
-	}
+
+	mCommandDecoder.Feed(eventData->data, eventData->data_len, eventData->current_data_offset);
 }
 
 /**
- * @brief Hadnle event for window
+ * @brief Apply command to window or irrigation
  */
-void NetworkManager::WindowEvent(const cJSON *const json)
+void NetworkManager::ExecuteCommand(const Command &command)
 {
 	auto controller = Manager::ComponentController::GetInstance();
 
-	if (cJSON_HasObjectItem(json, "requested"))
+	switch (command.target)
 	{
-		bool requested = static_cast<bool>(cJSON_GetNumberValue(cJSON_GetObjectItem(json, "requested")));
-		if (requested == controller->WindowState())
+	case (CommandTarget::TARGET_WINDOW):
+		if (command.requested == controller->WindowState())
 		{
 			ESP_LOGI(NETWORK_MANAGER_TAG, "Request state is same with current window state");
 			return;
 		}
 
-		if (requested)
+		if (command.requested)
 			controller->OpenWindow();
 		else
 			controller->CloseWindow();
-	}
-}
-
-/**
- * @brief Handle event for irrigation
- */
-void NetworkManager::IrrigationEvent(const cJSON *const json)
-{
-	auto controller = Manager::ComponentController::GetInstance();
-
-	if (cJSON_HasObjectItem(json, "requested"))
-	{
-		bool requested = static_cast<bool>(cJSON_GetNumberValue(cJSON_GetObjectItem(json, "requested")));
-		if (requested == controller->IrrigationState())
+		break;
+	case (CommandTarget::TARGET_IRRIGATION):
+		if (command.requested == controller->IrrigationState())
 		{
 			ESP_LOGI(NETWORK_MANAGER_TAG, "Request state is same with current irrigation state");
 			return;
 		}
 
-		if (requested)
+		if (command.requested)
 			controller->TurnOnIrrigation();
 		else
 			controller->TurnOffIrrigation();
+		break;
+	default:
+		break;
 	}
 }
\ No newline at end of file
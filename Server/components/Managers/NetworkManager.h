@@ -2,6 +2,8 @@
 #define NETWORK_MANAGER_H
 
 /* STL library */
+#include <array>
+#include <atomic>
 #include <utility>
 #include <string>
 #include <mutex>
@@ -10,21 +12,36 @@
 /* Common components includes */
 #include <Drivers/Network/WiFiDriver.hpp>
 #include <Utility/Network/MQTT_Client.hpp>
+#include <Utility/Network/TopicRouter.hpp>
 #include <Trackers/WifiConnectionTracker.hpp>
+#include <Convertors/JsonWriter.hpp>
+#include <Convertors/CborWriter.hpp>
+#include <Utility/Storage/Outbox.hpp>
 
 /* Project specific includes */
 #include "Observers/BluetoothDataObserver.hpp"
 #include "SensorsData/SensorsData.hpp"
 #include "WifiConnectionHolder.hpp"
+#include "CommandDecoder.hpp"
 
 /* ESP MQTT library */
 #include <mqtt_client.h>
 
-/* ESP cJSON library */
-#include <cJSON.h>
+/* ESP timer */
+#include <esp_timer.h>
+
+/* FreeRTOS includes */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/* SDK config file */
+#include "sdkconfig.h"
 
 #define NETWORK_MANAGER_TAG "Network manager"
 
+// Sector size of outbox file emulating flash on host build
+#define MQTT_OUTBOX_SECTOR_SIZE 4096
+
 namespace Greenhouse
 {
 	namespace Manager
@@ -89,7 +106,26 @@ namespace Greenhouse
 			 */
 			void SendInfoToServer() const;
 
+#ifdef CONFIG_MQTT_OUTBOX
+			/**
+			 * @brief Get counters of persistent outbox
+			 *
+			 * @return OutboxStatistics : Backlog depth and throughput counters
+			 */
+			Utility::Storage::OutboxStatistics GetOutboxStatistics();
+#endif
+
 		private:
+#ifdef CONFIG_MQTT_PAYLOAD_CBOR
+			// Sensors data and board info are published as CBOR
+			using PayloadWriter = Component::Convertor::CborWriter;
+			using PayloadByte = uint8_t;
+#else
+			// Sensors data and board info are published as JSON
+			using PayloadWriter = Component::Convertor::JsonWriter;
+			using PayloadByte = char;
+#endif
+
 			/**
 			 * @brief Class constructor
 			 */
@@ -124,7 +160,8 @@ namespace Greenhouse
 																		int32_t eventID, void *eventData);
 
 			/**
-			 * @brief Method to publish sensors data to MQTT server
+			 * @brief Method to publish sensors data to MQTT server. In batch mode data are appended
+			 * 				into pending batch which is published when it is full or its window expires
 			 *
 			 * @param[in] topic      : MQTT Topic
 			 * @param[in] shared_ptr : Shared pointer to sensors data
@@ -132,31 +169,135 @@ namespace Greenhouse
 			void Publish(const std::string &topic, const std::shared_ptr<SensorsData> sensorsData);
 
 			/**
-			 * @brief Method to subscribe all predefined topics
+			 * @brief Publish formatted sensors data. While MQTT client is disconnected, outbox holds
+			 * 				older records or publish fails, data are stored into persistent outbox instead
+			 *
+			 * @param[in] topic		: MQTT Topic
+			 * @param[in] data		: Formatted payload
+			 * @param[in] length	: Length of payload
+			 * @param[in] retain	: Retain flag
+			 */
+			void Deliver(const std::string &topic, const void *data, size_t length, bool retain);
+
+#ifdef CONFIG_MQTT_OUTBOX
+			/**
+			 * @brief Create storage of outbox and recover records left from previous run
+			 */
+			void InitOutbox();
+
+			/**
+			 * @brief Store formatted sensors data into outbox and wake drain task when broker is connected
+			 *
+			 * @param[in] data		: Formatted payload
+			 * @param[in] length	: Length of payload
+			 */
+			void StoreInOutbox(const void *data, size_t length);
+
+			/**
+			 * @brief Send limited number of records from outbox
+			 *
+			 * @return bool		true	: Records are left in outbox and broker is connected
+			 * 					false	: Outbox is empty or broker is not connected
+			 */
+			bool DrainOutbox();
+
+			/**
+			 * @brief Outbox drain task body. Task sleeps until it is woken and sends records
+			 * 				at controlled rate until outbox is empty
+			 *
+			 * @param[in] arg	: Pointer to network manager
+			 */
+			static void DrainTask(void *arg);
+#endif
+
+			/**
+			 * @brief Write sensors data as object in payload format
+			 *
+			 * @param[out] writer		: Payload writer
+			 * @param[in] sensorsData	: Sensors data
+			 */
+			static void WriteSensorsData(PayloadWriter &writer, const SensorsData &sensorsData);
+
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+			/**
+			 * @brief Append sensors data into pending batch. Batch is started when it is empty
+			 * @warning Publish mutex must be locked by caller
+			 *
+			 * @param[in] topic			: MQTT Topic
+			 * @param[in] sensorsData	: Sensors data
+			 *
+			 * @return bool		true	: Record was appended
+			 * 					false	: Record does not fit into publish buffer
+			 */
+			bool AppendToBatch(const std::string &topic, const SensorsData &sensorsData);
+
+			/**
+			 * @brief Publish pending batch
+			 * @warning Publish mutex must be locked by caller
+			 */
+			void FlushBatch();
+
+			/**
+			 * @brief Callback of batch window timer
+			 *
+			 * @param[in] arg	: Pointer to network manager
+			 */
+			static void BatchTimerCallback(void *arg);
+#endif
+
+			/**
+			 * @brief Method to subscribe all topics registered in topic router
 			 * @warning Method must be called only after MQTT connected event
 			 */
 			void SubscribeTopics();
 
 			/**
-			 * @brief Process event data
+			 * @brief Register handlers of command topics. New command needs only one registration,
+			 * 				its topic is subscribed automatically
+			 */
+			void RegisterCommandTopics();
+
+			/**
+			 * @brief Select target of commands received on topic
+			 *
+			 * @tparam Target			: Target of commands without target key
+			 *
+			 * @param[in] topic		: Topic of message
+			 * @param[in] payload	: First fragment of message
+			 * @param[in] context	: Pointer to network manager
+			 */
+			template <CommandTarget Target>
+			static void OnCommandTopic(Utility::Network::TopicView topic, Utility::Network::TopicView payload, void *context);
+
+			/**
+			 * @brief Pass decoded command to network manager
+			 *
+			 * @param[in] command	: Decoded command
+			 * @param[in] context	: Pointer to network manager
+			 */
+			static void OnDecodedCommand(const Command &command, void *context);
+
+			/**
+			 * @brief Process event data. Fragments of long message are decoded as they arrive
 			 *
 			 * @param[in] eventData  : Event data
 			 */
 			void ProcessEventData(esp_mqtt_event_handle_t eventData);
 
 			/**
-			 * @brief Hadnle event for window
+			 * @brief Report crossing of water level threshold to server
 			 *
-			 * @param[in] json			: JSON data with current window state and requested
+			 * @param[in] payload	: Water level event
+			 * @param[in] context	: Pointer to network manager
 			 */
-			void WindowEvent(const cJSON *const json);
+			static void OnWaterLevel(Component::Publisher::WaterLevelEventData &payload, void *context);
 
 			/**
-			 * @brief Hadnle event for irrigation
+			 * @brief Apply command to window or irrigation
 			 *
-			 * @param[in] json			: JSON data with current window state and requested
+			 * @param[in] command	: Decoded command
 			 */
-			void IrrigationEvent(const cJSON *const json);
+			void ExecuteCommand(const Command &command);
 
 			// Typedef to WiFi driver component
 			using WifiDriver = Component::Driver::Network::WifiDriver;
@@ -181,6 +322,58 @@ namespace Greenhouse
 
 			// BluetoothObserver
 			Observer::BluetoothDataObserver *mBluetoothObserver;
+
+			// Router of received commands
+			Utility::Network::TopicRouter mTopicRouter;
+
+			// Target selected by topic of message being received
+			CommandTarget mCommandTarget;
+
+			// Incremental decoder of command messages
+			CommandDecoder mCommandDecoder;
+
+			// Preallocated buffer for payload of sensors data
+			std::array<PayloadByte, CONFIG_MQTT_PUBLISH_BUFFER_SIZE> mPublishBuffer;
+
+			// Writer formatting into publish buffer
+			PayloadWriter mPublishWriter;
+
+			// Mutex to protect publish buffer, sensors data are sent from several worker tasks
+			std::mutex mPublishMutex;
+
+#ifdef CONFIG_MQTT_BATCH_PUBLISH
+			// Topic of pending batch
+			std::string mBatchTopic;
+
+			// Number of records in pending batch
+			size_t mBatchRecords;
+
+			// Timer publishing batch when its window expires
+			esp_timer_handle_t mBatchTimer;
+#endif
+
+			// MQTT client is connected to broker
+			std::atomic<bool> mConnected;
+
+#ifdef CONFIG_MQTT_OUTBOX
+			// Storage of outbox
+			Utility::Storage::StorageInterface *mOutboxStorage;
+
+			// Persistent outbox of sensors data
+			Utility::Storage::Outbox *mOutbox;
+
+			// Buffer for record taken from outbox
+			std::array<PayloadByte, CONFIG_MQTT_PUBLISH_BUFFER_SIZE> mDrainBuffer;
+
+			// Task sending records from outbox at controlled rate, off the esp_timer task
+			TaskHandle_t mDrainTask;
+
+			// Start of current drain in microseconds since boot
+			int64_t mDrainStart;
+
+			// Records sent in current drain
+			uint32_t mDrainedRecords;
+#endif
 		};
 	} // namespace Manager
 } // namespace Greenhouse
@@ -12,18 +12,35 @@
 /* Component controller */
 #include "Managers/ComponentController.hpp"
 
+/* Event data pool */
+#include "Managers/EventDataPool.hpp"
+
 using namespace Greenhouse::Observer;
 
+#if defined(CONFIG_BLUETOOTH_DATA_BLOCK)
+#define BLUETOOTH_DATA_OVERFLOW_POLICY Utility::Task::OverflowPolicy::BLOCK
+#elif defined(CONFIG_BLUETOOTH_DATA_DROP_NEWEST)
+#define BLUETOOTH_DATA_OVERFLOW_POLICY Utility::Task::OverflowPolicy::DROP_NEWEST
+#else
+#define BLUETOOTH_DATA_OVERFLOW_POLICY Utility::Task::OverflowPolicy::DROP_OLDEST
+#endif
+
 /**
  * @brief Class constructor
  */
 BluetoothDataObserver::BluetoothDataObserver(Greenhouse::Manager::EventManager *manager)
-    : ObserverInterface(Event_T::BLUETOOTH_DATA_RECEIVED)
+    : mWorkerPool("BluetoothDataTask", CONFIG_BLUETOOTH_DATA_WORKERS, CONFIG_BLUETOOTH_DATA_QUEUE_DEPTH,
+                  BLUETOOTH_DATA_OVERFLOW_POLICY, &BluetoothDataObserver::HandleBluetoothData,
+                  &BluetoothDataObserver::DropBluetoothData, this)
 {
+    if (!mWorkerPool.Start())
+        ESP_LOGE(BLUETOOTH_DATA_OBSERVER_TAG, "Unable to start workers for bluetooth data");
+
     if (!manager)
         return;
 
-    manager->Subscribe(GetObservedEvent(), this);
+    if (!manager->Subscribe<Component::Publisher::Events::BLUETOOTH_DATA_RECEIVED>(&BluetoothDataObserver::OnBluetoothData, this))
+        ESP_LOGE(BLUETOOTH_DATA_OBSERVER_TAG, "Unable to subscribe bluetooth data event");
 }
 
 /**
@@ -33,102 +50,151 @@ BluetoothDataObserver::~BluetoothDataObserver()
 {
 }
 
-void BluetoothDataObserver::Update(Component::Publisher::EventData *eventData)
+/**
+ * @brief Get counters of bluetooth data workers
+ */
+Utility::Task::WorkerPoolStatistics BluetoothDataObserver::GetStatistics() const
 {
-    /* Create the task, storing the handle. */
-    auto status = xTaskCreate(
-        BluetoothDataObserver::HandleBluetoothData, /* Function that implements the task. */
-        "BluetoothDataTask",                        /* Text name for the task. */
-        4096,                                       /* Stack size in words, not bytes. */
-        eventData,                                  /* Parameter passed into the task. */
-        tskIDLE_PRIORITY,                           /* Priority at which the task is created. */
-        nullptr);                                   /* Used to pass out the created task's handle. */
-
-    if (status == pdPASS)
-    {
-        ESP_LOGI(BLUETOOTH_DATA_OBSERVER_TAG, "Task for handling bluetooth data has been successfully created");
-    }
+    return mWorkerPool.GetStatistics();
+}
+
+/**
+ * @brief Get history of received values
+ */
+const Utility::Storage::TimeSeriesStore &BluetoothDataObserver::GetHistory() const
+{
+    return mHistory;
+}
+
+/**
+ * @brief Append value of field to history
+ */
+void BluetoothDataObserver::Record(const Component::Publisher::ClientBluetoothEventData_Greenhouse &data, uint8_t metric,
+                                   time_t time, float value)
+{
+    const Utility::Storage::SeriesKey key = {data.GetClientID(), data.GetPosition(), metric};
+
+    // Samples of client reconnected before time synchronization may arrive out of order
+    if (!mHistory.Append(key, static_cast<uint32_t>(time), value))
+        ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Value of field 0x%02X was not stored into history", metric);
+}
+
+/**
+ * @brief Method which is called by event manager for new bluetooth data
+ */
+void BluetoothDataObserver::OnBluetoothData(Payload_T &payload, void *context)
+{
+    // Worker queue carries raw pointers, dropped items are released by DropBluetoothData
+    static_cast<BluetoothDataObserver *>(context)->mWorkerPool.Submit(payload.Detach());
+}
+
+/**
+ * @brief Release bluetooth data dropped from full queue
+ */
+void BluetoothDataObserver::DropBluetoothData(void *event_data, void *)
+{
+    Manager::EventDataPool::GetInstance()->Release(static_cast<Component::Publisher::ClientBluetoothEventData_Greenhouse *>(event_data));
 }
 
 /**
  * @brief Handle bluetooth data
  */
-void BluetoothDataObserver::HandleBluetoothData(void *event_data)
+void BluetoothDataObserver::HandleBluetoothData(void *event_data, void *context)
 {
+    using namespace Component::Protocol;
+
+    auto observer = static_cast<BluetoothDataObserver *>(context);
+
     auto bluetoothData = static_cast<Component::Publisher::ClientBluetoothEventData_Greenhouse *>(event_data);
-    if (!bluetoothData)
+    if (!bluetoothData || !bluetoothData->GetSampleCount())
     {
         ESP_LOGE(BLUETOOTH_DATA_OBSERVER_TAG, "Unsuported data type.");
+        Manager::EventDataPool::GetInstance()->Release(bluetoothData);
         return;
     }
 
     ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Start processing bluetooth event data");
-    auto sensorData = std::make_shared<SensorsData>();
-    // Set basic data
-    sensorData->basic.clientID = bluetoothData->GetClientID();
-    sensorData->basic.position = static_cast<Position>(bluetoothData->GetPosition());
-    ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Data for client %d on position %d", bluetoothData->GetClientID(), bluetoothData->GetPosition());
-
-    // Air values
-    if (bluetoothData->IsTemperatureSet())
+    ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "%d samples for client %d on position %d", static_cast<int>(bluetoothData->GetSampleCount()),
+             bluetoothData->GetClientID(), bluetoothData->GetPosition());
+
+    const auto position = static_cast<Position>(bluetoothData->GetPosition());
+
+    for (size_t i = 0; i < bluetoothData->GetSampleCount(); ++i)
     {
-        sensorData->air.temperature.Set(bluetoothData->GetTemperature());
-        ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Temperature: %.2f", sensorData->air.temperature.Get());
+        const auto &sample = bluetoothData->GetSample(i);
 
-        if (sensorData->basic.position == Position::INSIDE)
+        auto sensorData = std::make_shared<SensorsData>();
+        // Set basic data
+        sensorData->basic.clientID = bluetoothData->GetClientID();
+        sensorData->basic.position = position;
+        sensorData->basic.time -= sample.age;
+
+        // Air values
+        if (sample.content & ContentBit<TemperatureField>())
         {
-            auto controller = Manager::ComponentController::GetInstance();
+            observer->Record(*bluetoothData, ContentBit<TemperatureField>(), sensorData->basic.time, sample.temperature);
+            sensorData->air.temperature.Set(sample.temperature);
+            ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Temperature: %.2f", sensorData->air.temperature.Get());
+        }
 
-            if (sensorData->air.temperature.Get() > 21)
-            {
-                if (!controller->IsWindowOpen())
-                    controller->OpenWindow();
-            }
-            else if (sensorData->air.temperature.Get() < 14)
-            {
-                if (controller->IsWindowOpen)
-                    controller->CloseWindow();
-            }
+        if (sample.content & ContentBit<HumidityField>())
+        {
+            observer->Record(*bluetoothData, ContentBit<HumidityField>(), sensorData->basic.time, sample.humidity);
+            sensorData->air.humidity.Set(sample.humidity);
+            ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Humidity: %.2f", sensorData->air.humidity.Get());
         }
-    }
 
-    if (bluetoothData->IsHumiditySet())
-    {
-        sensorData->air.humidity.Set(bluetoothData->GetHumidity());
-        ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Humidity: %.2f", sensorData->air.humidity.Get());
+        if (sample.content & ContentBit<CO2Field>())
+        {
+            observer->Record(*bluetoothData, ContentBit<CO2Field>(), sensorData->basic.time, static_cast<float>(sample.co2));
+            sensorData->air.co2.Set(static_cast<uint16_t>(sample.co2));
+            ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "CO2: %d", sensorData->air.co2.Get());
+        }
+
+        // Soil values
+        if (sample.content & ContentBit<SoilMoistureField>())
+        {
+            observer->Record(*bluetoothData, ContentBit<SoilMoistureField>(), sensorData->basic.time, sample.soilMoisture);
+            sensorData->soil.soilMoisture.Set(sample.soilMoisture);
+            ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Soil moisture: %.2f", sensorData->soil.soilMoisture.Get());
+        }
+
+        Manager::NetworkManager::GetInstance()->SendToServer(sensorData);
     }
 
-    if (bluetoothData->IsCO2Set())
+    // Only the newest sample reflects current state of greenhouse. Copy it so event data can go back to pool
+    const auto latest = bluetoothData->GetSample(bluetoothData->GetSampleCount() - 1);
+    Manager::EventDataPool::GetInstance()->Release(bluetoothData);
+
+    if (position == Position::INSIDE && (latest.content & ContentBit<TemperatureField>()))
     {
-        sensorData->air.co2.Set(bluetoothData->GetCO2());
-        ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "CO2: %d", sensorData->air.co2.Get());
+        auto controller = Manager::ComponentController::GetInstance();
+
+        if (latest.temperature > 21)
+        {
+            if (!controller->IsWindowOpen())
+                controller->OpenWindow();
+        }
+        else if (latest.temperature < 14)
+        {
+            if (controller->IsWindowOpen())
+                controller->CloseWindow();
+        }
     }
 
-    // Soil values
-    if (bluetoothData->IsSoilMoistureSet())
+    if (position == Position::INSIDE && (latest.content & ContentBit<SoilMoistureField>()))
     {
-        sensorData->soil.soilMoisture.Set(bluetoothData->GetSoilMoisture());
-        ESP_LOGD(BLUETOOTH_DATA_OBSERVER_TAG, "Soil moisture: %.2f", sensorData->soil.soilMoisture.Get());
-
-        if (sensorData->basic.position == Position::INSIDE)
+        if (latest.soilMoisture < 60)
         {
-            if (sensorData->soil.soilMoisture.Get() < 60)
+            auto controller = Manager::ComponentController::GetInstance();
+            // Irrigation is refused while water level in tank is low
+            if (!controller->IsIrrigationTurnOn() && controller->TurnOnIrrigation())
             {
-                auto controller = Manager::ComponentController::GetInstance();
-                if (!controller->IsIrrigationTurnOn())
-                {
-                    // Turn irrigation on
-                    controller->TurnOnIrrigation();
-                    // Wait for 3 sec
-                    vTaskDelay(3000);
-                    // Turn irrigation off
-                    controller->TurnOffIrrigation();
-                }
+                // Wait for 3 sec
+                vTaskDelay(3000);
+                // Turn irrigation off
+                controller->TurnOffIrrigation();
             }
         }
     }
-
-    Manager::NetworkManager::GetInstance()->SendToServer(sensorData);
-
-    vTaskDelete(nullptr);
-}
\ No newline at end of file
+}
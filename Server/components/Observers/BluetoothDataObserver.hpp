@@ -2,9 +2,12 @@
 #define BLUETOOTH_DATA_OBSERVER_H
 
 /* Common components includes */
-#include "Observer/ObserverInterface.hpp"
 #include "Publisher/EventData.hpp"
 
+/* Common components includes */
+#include "Utility/Task/WorkerPool.hpp"
+#include "Utility/Storage/TimeSeries.hpp"
+
 /* Project specific includes */
 #include "Managers/EventManager.hpp"
 
@@ -14,7 +17,7 @@ namespace Greenhouse
 {
     namespace Observer
     {
-        class BluetoothDataObserver : public Component::Observer::Interface::ObserverInterface
+        class BluetoothDataObserver
         {
         public:
             /**
@@ -30,19 +33,62 @@ namespace Greenhouse
             ~BluetoothDataObserver();
 
             /**
-             * @brief Method which is called be event manager for notify client
+             * @brief Get counters of bluetooth data workers
+             *
+             * @return Utility::Task::WorkerPoolStatistics
+             */
+            Utility::Task::WorkerPoolStatistics GetStatistics() const;
+
+            /**
+             * @brief Get history of received values. Series are keyed by client ID, position and content bit of field
              *
-             * @param[in] eventData : Pointer to event data
+             * @return const Utility::Storage::TimeSeriesStore&
              */
-            void Update(Component::Publisher::EventData *eventData) override;
+            const Utility::Storage::TimeSeriesStore &GetHistory() const;
 
         private:
+            // Alias for payload of bluetooth data event
+            using Payload_T = Greenhouse::Manager::EventManager::Payload_T<Component::Publisher::Events::BLUETOOTH_DATA_RECEIVED>;
+
+            /**
+             * @brief Method which is called by event manager for new bluetooth data
+             *
+             * @param[in] payload   : Handle of bluetooth data. Ownership is passed to workers
+             * @param[in] context   : Pointer to observer
+             */
+            static void OnBluetoothData(Payload_T &payload, void *context);
+
             /**
-             * @brief Handle bluetooth data
+             * @brief Handle bluetooth data. Called by worker task
              *
              * @param[in] event_data : Bluetooth data
+             * @param[in] context    : Pointer to observer
              */
-            static void HandleBluetoothData(void *event_data);
+            static void HandleBluetoothData(void *event_data, void *context);
+
+            /**
+             * @brief Release bluetooth data dropped from full queue
+             *
+             * @param[in] event_data : Bluetooth data
+             * @param[in] context    : Pointer to observer
+             */
+            static void DropBluetoothData(void *event_data, void *context);
+
+            /**
+             * @brief Append value of field to history
+             *
+             * @param[in] data      : Bluetooth data
+             * @param[in] metric    : Content bit of field
+             * @param[in] time      : Time of sample
+             * @param[in] value     : Value of field
+             */
+            void Record(const Component::Publisher::ClientBluetoothEventData_Greenhouse &data, uint8_t metric, time_t time, float value);
+
+            /* Workers processing bluetooth data */
+            Utility::Task::WorkerPool mWorkerPool;
+
+            /* Compressed history of received values */
+            Utility::Storage::TimeSeriesStore mHistory;
         };
     } // namespace Observer
 } // namespace Greenhouse
@@ -16,21 +16,20 @@
 // PUBLISH
 #define INFO "Greenhouse/info"
 #define SENSOR_DATA "Greenhouse/SensorData"
+#define WATER_LEVEL "Greenhouse/WaterLevel"
+
+// Convert numeric config value to string literal
+#define GREENHOUSE_STRINGIFY(value) #value
+#define GREENHOUSE_TO_STRING(value) GREENHOUSE_STRINGIFY(value)
 
 // SUBSCRIBE
-// Defines must be stored in greenhouse_topics data structure to be applied
+// Topics must be registered in NetworkManager::RegisterCommandTopics to be subscribed
 #define WINDOW "Greenhouse/window"
-#define WINDOW_ID "Greenhouse/window/" + std::to_string(CONFIG_Greenhouse_ID)
+#define WINDOW_ID WINDOW "/" GREENHOUSE_TO_STRING(CONFIG_Greenhouse_ID)
 #define IRRIGATION "Greenhouse/irrigation"
-#define IRRIGATION_ID "Greenhouse/irrigation/" + std::to_string(CONFIG_Greenhouse_ID)
-
-//---------------------------------------------------------------------------------//
-
-// The data structure should only contain definitions from the subscribe block
-static std::vector<std::string> greenhouse_topics = {
-    WINDOW,
-    WINDOW_ID,
-    IRRIGATION,
-    IRRIGATION_ID};
+#define IRRIGATION_ID IRRIGATION "/" GREENHOUSE_TO_STRING(CONFIG_Greenhouse_ID)
+// Bulk of commands for several actuators, every command names its target
+#define COMMANDS "Greenhouse/commands"
+#define COMMANDS_ID COMMANDS "/" GREENHOUSE_TO_STRING(CONFIG_Greenhouse_ID)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,251 @@
+/* Code under test */
+#include "ClientSessionTable.hpp"
+#include "Common_components/Bluetooth/BluetoothDefinitions.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <array>
+#include <cstring>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace Greenhouse::Bluetooth;
+
+namespace
+{
+    constexpr size_t SIZE = ClientSessionTable::GetCapacity();
+
+    // Connection ID of free slot in model of table
+    constexpr int FREE_SLOT = -1;
+
+    /**
+     * @brief Get address of simulated client
+     */
+    void MakeAddress(uint16_t client, esp_bd_addr_t bda)
+    {
+        const uint8_t address[ESP_BD_ADDR_LEN] = {0x24, 0x0A, 0xC4, 0x00, static_cast<uint8_t>(client >> 8), static_cast<uint8_t>(client)};
+        memcpy(bda, address, sizeof(esp_bd_addr_t));
+    }
+
+    /**
+     * @brief Get slot of session, table stores sessions in one array starting by slot of connection 0
+     */
+    size_t SlotOf(const ClientSession *session, const ClientSession *first)
+    {
+        return static_cast<size_t>(session - first);
+    }
+
+    /**
+     * @brief Table with connection 0 in slot 0, so slots of other sessions can be computed
+     */
+    class ClientSessionTableTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            esp_bd_addr_t bda;
+            MakeAddress(0, bda);
+            mFirst = mTable.Open(0, bda);
+            ASSERT_NE(mFirst, nullptr);
+        }
+
+        ClientSession *Open(uint16_t connID)
+        {
+            esp_bd_addr_t bda;
+            MakeAddress(connID, bda);
+            return mTable.Open(connID, bda);
+        }
+
+        ClientSessionTable mTable;
+        ClientSession *mFirst;
+    };
+} // namespace
+
+TEST_F(ClientSessionTableTest, OpensSessionInPreferredSlot)
+{
+    static_assert(SIZE >= 3, "Test needs at least three slots");
+
+    for (uint16_t connID = 1; connID < SIZE; ++connID)
+    {
+        const auto session = Open(connID);
+        ASSERT_NE(session, nullptr);
+        EXPECT_EQ(SlotOf(session, mFirst), connID);
+        EXPECT_EQ(session->connID, connID);
+        EXPECT_EQ(session->clientID, CLIENT_SESSION_UNKNOWN_ID);
+        EXPECT_EQ(session->mtu, GATT_DEFAULT_MTU);
+        EXPECT_EQ(mTable.Find(connID), session);
+    }
+
+    EXPECT_EQ(mTable.GetActiveCount(), SIZE);
+}
+
+TEST_F(ClientSessionTableTest, CollidingConnectionsProbeToNextFreeSlot)
+{
+    ASSERT_TRUE(mTable.Close(0));
+
+    // All connections prefer slot 1, they take slots 1, 2, ... and wrap around to 0
+    std::vector<ClientSession *> sessions;
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        const auto connID = static_cast<uint16_t>(1 + i * SIZE);
+        const auto session = Open(connID);
+        ASSERT_NE(session, nullptr);
+        EXPECT_EQ(SlotOf(session, mFirst), (1 + i) % SIZE) << "connection " << connID;
+        sessions.push_back(session);
+    }
+
+    // Table is full
+    EXPECT_EQ(Open(1 + SIZE * SIZE), nullptr);
+    EXPECT_EQ(mTable.GetActiveCount(), SIZE);
+
+    for (size_t i = 0; i < SIZE; ++i)
+        EXPECT_EQ(mTable.Find(static_cast<uint16_t>(1 + i * SIZE)), sessions[i]);
+
+    // Closed slot in the middle of probe sequence does not hide sessions behind it
+    const auto closedID = static_cast<uint16_t>(1 + SIZE);
+    ASSERT_TRUE(mTable.Close(closedID));
+    EXPECT_FALSE(mTable.Close(closedID));
+    EXPECT_EQ(mTable.Find(closedID), nullptr);
+    for (size_t i = 2; i < SIZE; ++i)
+        EXPECT_EQ(mTable.Find(static_cast<uint16_t>(1 + i * SIZE)), sessions[i]);
+
+    // New colliding connection reuses closed slot
+    const auto reused = Open(1 + SIZE * SIZE);
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(reused, sessions[1]);
+    EXPECT_EQ(reused->counters.writes, 0u);
+    EXPECT_EQ(mTable.GetActiveCount(), SIZE);
+}
+
+TEST_F(ClientSessionTableTest, ReusedConnectionIDReplacesSession)
+{
+    auto session = Open(1);
+    ASSERT_NE(session, nullptr);
+    session->clientID = 7;
+    session->counters.writes = 10;
+
+    // Stack reused connection ID without disconnect event
+    const auto reopened = Open(1);
+    ASSERT_NE(reopened, nullptr);
+    EXPECT_EQ(reopened->clientID, CLIENT_SESSION_UNKNOWN_ID);
+    EXPECT_EQ(reopened->counters.writes, 0u);
+    EXPECT_EQ(mTable.GetActiveCount(), 2u);
+}
+
+TEST_F(ClientSessionTableTest, FindsSessionByAddress)
+{
+    const auto session = Open(SIZE + 1);
+    ASSERT_NE(session, nullptr);
+
+    esp_bd_addr_t bda;
+    MakeAddress(SIZE + 1, bda);
+    EXPECT_EQ(mTable.Find(bda), session);
+
+    MakeAddress(SIZE + 2, bda);
+    EXPECT_EQ(mTable.Find(bda), nullptr);
+}
+
+TEST(ClientSessionTableLoad, SimulatedClientsConnectAndDisconnect)
+{
+    // More clients than slots, connection IDs are assigned by stack and collide under modulo of table size
+    constexpr uint16_t CLIENTS = 64;
+    constexpr size_t STEPS = 200000;
+
+    ClientSessionTable table;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<uint16_t> clients(0, CLIENTS - 1);
+    std::uniform_int_distribution<uint16_t> connIDs(0, 255);
+
+    // Model of table following the same probing, connection ID in every slot
+    std::array<int, SIZE> slots;
+    slots.fill(FREE_SLOT);
+
+    // Connected clients and their connection IDs
+    std::map<uint16_t, uint16_t> connected;
+    const ClientSession *first{nullptr};
+    size_t rejected{0}, collisions{0};
+
+    for (size_t step = 0; step < STEPS; ++step)
+    {
+        const auto client = clients(generator);
+        esp_bd_addr_t bda;
+        MakeAddress(client, bda);
+
+        auto it = connected.find(client);
+        if (it != connected.end())
+        {
+            // Connected client writes data or disconnects
+            const auto session = table.Find(it->second);
+            ASSERT_NE(session, nullptr) << "step " << step;
+            ASSERT_EQ(session->connID, it->second);
+            ASSERT_EQ(table.Find(bda), session);
+
+            if (generator() % 2)
+            {
+                ++session->counters.writes;
+                continue;
+            }
+
+            ASSERT_TRUE(table.Close(it->second));
+            for (auto &slot : slots)
+            {
+                if (slot == it->second)
+                    slot = FREE_SLOT;
+            }
+
+            connected.erase(it);
+            continue;
+        }
+
+        // Client connects with connection ID which is not in use
+        uint16_t connID;
+        bool used;
+        do
+        {
+            connID = connIDs(generator);
+            used = false;
+            for (const auto &entry : connected)
+                used |= entry.second == connID;
+        } while (used);
+
+        // Expected slot is the first free one from preferred slot
+        size_t expected = SIZE;
+        for (size_t i = 0; i < SIZE; ++i)
+        {
+            if (slots[(connID + i) % SIZE] == FREE_SLOT)
+            {
+                expected = (connID + i) % SIZE;
+                collisions += i > 0;
+                break;
+            }
+        }
+
+        const auto session = table.Open(connID, bda);
+        if (expected == SIZE)
+        {
+            ASSERT_EQ(session, nullptr) << "step " << step;
+            ++rejected;
+            continue;
+        }
+
+        ASSERT_NE(session, nullptr) << "step " << step;
+        ASSERT_EQ(session->connID, connID);
+
+        // Slot 0 is given by the first opened session, every next one must land in slot of model
+        if (!first)
+            first = session - expected;
+        ASSERT_EQ(SlotOf(session, first), expected) << "step " << step << ", connection " << connID;
+
+        slots[expected] = connID;
+        connected[client] = connID;
+        ASSERT_EQ(table.GetActiveCount(), connected.size());
+    }
+
+    // Clients outnumber slots, so table was full and probing was exercised
+    EXPECT_GT(rejected, 0u);
+    EXPECT_GT(collisions, 0u);
+    EXPECT_EQ(table.GetActiveCount(), connected.size());
+}
@@ -0,0 +1,87 @@
+/* Code under test */
+#include "Common_components/Convertors/DataType/BytePacking.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <array>
+#include <cstdint>
+
+using namespace Component::Convertor;
+
+namespace
+{
+    constexpr uint8_t BYTES[] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+
+    // Two's complement of -2
+    constexpr uint8_t MINUS_TWO[] = {0xFF, 0xFE};
+
+    // Packed values of round trips
+    constexpr auto PACKED_INT32 = Pack<Endian::LITTLE>(static_cast<int32_t>(-123456));
+    constexpr auto PACKED_INT64 = Pack(static_cast<int64_t>(INT64_MIN));
+
+    /**
+     * @brief Compare packed bytes with expected ones at compile time
+     */
+    template <size_t Size>
+    constexpr bool Equal(const std::array<uint8_t, Size> &packed, const uint8_t *expected, size_t index = 0)
+    {
+        return index == Size || (packed[index] == expected[index] && Equal(packed, expected, index + 1));
+    }
+} // namespace
+
+// Big endian, order of sensor commands and words on bus
+static_assert(Equal(Pack(static_cast<uint16_t>(0x1234)), BYTES), "uint16_t is packed big endian");
+static_assert(Equal(Pack(static_cast<uint32_t>(0x12345678)), BYTES), "uint32_t is packed big endian");
+static_assert(Equal(Pack(static_cast<uint64_t>(0x123456789ABCDEF0)), BYTES), "uint64_t is packed big endian");
+static_assert(Unpack<uint16_t>(BYTES) == 0x1234, "uint16_t is unpacked big endian");
+static_assert(Unpack<uint32_t>(BYTES) == 0x12345678, "uint32_t is unpacked big endian");
+static_assert(Unpack<uint64_t>(BYTES) == 0x123456789ABCDEF0, "uint64_t is unpacked big endian");
+
+// Little endian, order of frames
+static_assert(Equal(Pack<Endian::LITTLE>(static_cast<uint16_t>(0x3412)), BYTES), "uint16_t is packed little endian");
+static_assert(Equal(Pack<Endian::LITTLE>(static_cast<uint32_t>(0x78563412)), BYTES), "uint32_t is packed little endian");
+static_assert(Equal(Pack<Endian::LITTLE>(static_cast<uint64_t>(0xF0DEBC9A78563412)), BYTES), "uint64_t is packed little endian");
+static_assert(Unpack<uint16_t, Endian::LITTLE>(BYTES) == 0x3412, "uint16_t is unpacked little endian");
+static_assert(Unpack<uint32_t, Endian::LITTLE>(BYTES) == 0x78563412, "uint32_t is unpacked little endian");
+static_assert(Unpack<uint64_t, Endian::LITTLE>(BYTES) == 0xF0DEBC9A78563412, "uint64_t is unpacked little endian");
+
+// Single byte does not depend on order
+static_assert(Equal(Pack(static_cast<uint8_t>(0x12)), BYTES) && Equal(Pack<Endian::LITTLE>(static_cast<uint8_t>(0x12)), BYTES), "One byte");
+static_assert(Unpack<uint8_t>(BYTES) == 0x12 && Unpack<uint8_t, Endian::LITTLE>(BYTES) == 0x12, "One byte");
+
+// Signed integers keep their bits
+static_assert(Equal(Pack(static_cast<int16_t>(-2)), MINUS_TWO), "Negative value is packed as two's complement");
+static_assert(Unpack<int16_t>(MINUS_TWO) == -2, "Negative value is unpacked");
+static_assert(Unpack<int32_t, Endian::LITTLE>(&PACKED_INT32[0]) == -123456, "Round trip of int32_t");
+static_assert(Unpack<int64_t>(&PACKED_INT64[0]) == INT64_MIN, "Round trip of int64_t");
+
+TEST(BytePacking, StoresAndLoadsLowBytes)
+{
+    std::array<uint8_t, 4> buffer{};
+
+    // Three bytes of timestamp as frames store it
+    ASSERT_EQ(Store(static_cast<uint32_t>(0x00ABCDEF), Utility::DataType::Span<uint8_t>(buffer), 3), 3u);
+    EXPECT_EQ(buffer[0], 0xAB);
+    EXPECT_EQ(buffer[1], 0xCD);
+    EXPECT_EQ(buffer[2], 0xEF);
+    EXPECT_EQ(Load<uint32_t>(Utility::DataType::ByteView(buffer.data(), buffer.size()), 3), 0x00ABCDEFu);
+
+    ASSERT_EQ(Store<Endian::LITTLE>(static_cast<uint32_t>(0x00ABCDEF), Utility::DataType::Span<uint8_t>(buffer), 3), 3u);
+    EXPECT_EQ(buffer[0], 0xEF);
+    EXPECT_EQ(buffer[2], 0xAB);
+    EXPECT_EQ((Load<uint32_t, Endian::LITTLE>(Utility::DataType::ByteView(buffer.data(), buffer.size()), 3)), 0x00ABCDEFu);
+}
+
+TEST(BytePacking, RejectsInvalidCount)
+{
+    std::array<uint8_t, 2> buffer{};
+
+    EXPECT_EQ(Store(static_cast<uint32_t>(1), Utility::DataType::Span<uint8_t>(buffer), 0), 0u);
+    EXPECT_EQ(Store(static_cast<uint16_t>(1), Utility::DataType::Span<uint8_t>(buffer), 3), 0u);
+    EXPECT_EQ(Store(static_cast<uint32_t>(1), Utility::DataType::Span<uint8_t>(buffer)), 0u);
+
+    EXPECT_EQ(Load<uint32_t>(Utility::DataType::ByteView(buffer.data(), buffer.size())), 0u);
+    EXPECT_EQ(Load<uint16_t>(Utility::DataType::ByteView(buffer.data(), buffer.size()), 0), 0u);
+}
@@ -0,0 +1,80 @@
+/* Code under test */
+#include "Common_components/Convertors/Convertor_JSON.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+#include "Support/JsonDocument.hpp"
+
+/* STD library */
+#include <string>
+
+using namespace Component::Convertor;
+
+namespace
+{
+    // Items serialized by every measurement, small documents are repeated
+    constexpr size_t ITEMS_PER_RUN = 2000000;
+
+    /* Document of benchmark */
+    struct Document
+    {
+        const char *name;
+        const cJSON *root;
+        size_t items;
+    };
+
+    /**
+     * @brief Measure ToString of document, report time per document, per item and speed
+     *
+     * @return size_t   : Length of JSON
+     */
+    size_t Measure(const Document &document)
+    {
+        auto convertor = Convertor_JSON::GetInstance();
+        const size_t size = convertor->ToString(document.root).size();
+
+        const size_t iterations = ITEMS_PER_RUN / document.items + 1;
+        const double nanoseconds = Benchmark::NanosecondsPerCall(iterations, [&](size_t) {
+            Benchmark::DoNotOptimize(convertor->ToString(document.root).size());
+        });
+
+        std::printf("[ BENCHMARK] %-28s %9zu %10zu %14.1f %10.2f %10.1f\n", document.name, document.items, size, nanoseconds / 1000,
+                    nanoseconds / document.items, size * 1000.0 / nanoseconds);
+
+        return size;
+    }
+} // namespace
+
+TEST(ConvertorJsonBenchmark, DeepAndWideDocuments)
+{
+    JsonDocument document;
+
+    std::printf("[ BENCHMARK] %-28s %9s %10s %14s %10s %10s\n", "document", "items", "bytes", "us/document", "ns/item", "MB/s");
+
+    // Time per item stays flat while width grows when output grows linearly
+    const size_t widths[] = {10, 100, 1000, 10000, 100000};
+    for (const auto width : widths)
+    {
+        const std::string name = "wide object, " + std::to_string(width);
+        const size_t size = Measure({name.c_str(), document.Wide(width), width + 1});
+        EXPECT_EQ(size, JsonDocument::WideSize(width));
+    }
+
+    // Every level of nesting allowed by writer
+    for (size_t depth = 1; depth <= JSON_WRITER_MAX_DEPTH; ++depth)
+    {
+        const std::string name = "nested arrays, depth " + std::to_string(depth);
+        const size_t size = Measure({name.c_str(), document.Nested(depth), depth + 1});
+        EXPECT_EQ(size, 2 * depth + 1);
+    }
+
+    // Deep and wide at once, four children on every level down to the deepest one
+    const size_t before = document.Items();
+    const auto tree = document.Tree(4, JSON_WRITER_MAX_DEPTH);
+    const size_t items = document.Items() - before;
+    EXPECT_GT(Measure({"tree, fan-out 4, depth 8", tree, items}), 0u);
+
+    // Document one level deeper than writer is refused, not truncated
+    EXPECT_TRUE(Convertor_JSON::GetInstance()->ToString(document.Nested(JSON_WRITER_MAX_DEPTH + 1)).empty());
+}
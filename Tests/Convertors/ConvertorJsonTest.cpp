@@ -0,0 +1,95 @@
+/* Code under test */
+#include "Common_components/Convertors/Convertor_JSON.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/JsonDocument.hpp"
+
+/* STD library */
+#include <array>
+#include <string>
+
+using namespace Component::Convertor;
+
+TEST(Convertor_JSON, SerializesNestedAndEmptyContainers)
+{
+    JsonDocument document;
+    auto root = document.Object();
+    document.Add(root, "ID", document.Number(1));
+    document.Add(root, "valid", document.Bool(true));
+    document.Add(root, "name", document.String("air \"north\""));
+
+    auto data = document.Add(root, "Data", document.Object());
+    document.Add(data, "temperature", document.Number(21.5));
+    auto values = document.Add(data, "values", document.Array());
+    document.Add(values, document.Number(-2));
+    document.Add(values, document.Null());
+    document.Add(values, document.Bool(false));
+
+    document.Add(root, "empty", document.Array());
+    document.Add(root, "none", document.Object());
+
+    EXPECT_EQ(Convertor_JSON::GetInstance()->ToString(root),
+              "{\"ID\":1,\"valid\":true,\"name\":\"air \\\"north\\\"\",\"Data\":{\"temperature\":21.5,\"values\":[-2,null,false]},"
+              "\"empty\":[],\"none\":{}}");
+}
+
+TEST(Convertor_JSON, SerializesOnlySubtreeOfItem)
+{
+    JsonDocument document;
+    auto root = document.Object();
+    auto first = document.Add(root, "first", document.Array());
+    document.Add(first, document.Number(1));
+    document.Add(root, "second", document.Number(2));
+
+    // Sibling of serialized item is not part of its JSON
+    EXPECT_EQ(Convertor_JSON::GetInstance()->ToString(first), "[1]");
+}
+
+TEST(Convertor_JSON, RejectsNestingDeeperThanWriter)
+{
+    JsonDocument document;
+    const auto deepest = document.Nested(JSON_WRITER_MAX_DEPTH);
+    EXPECT_EQ(Convertor_JSON::GetInstance()->ToString(deepest), "[[[[[[[[1]]]]]]]]");
+
+    const auto tooDeep = document.Nested(JSON_WRITER_MAX_DEPTH + 1);
+    EXPECT_EQ(Convertor_JSON::GetInstance()->ToString(tooDeep), "");
+
+    std::array<char, 64> buffer;
+    EXPECT_EQ(Convertor_JSON::GetInstance()->Serialize(tooDeep, Utility::DataType::Span<char>(buffer)), 0u);
+}
+
+TEST(Convertor_JSON, GrowsStringForWideDocument)
+{
+    constexpr size_t MEMBERS = 5000;
+
+    JsonDocument document;
+    const auto root = document.Wide(MEMBERS);
+    const auto json = Convertor_JSON::GetInstance()->ToString(root);
+
+    EXPECT_EQ(json.size(), JsonDocument::WideSize(MEMBERS));
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_EQ(json.compare(0, 10, "{\"m0\":0,\"m"), 0);
+
+    // Buffer without space for the whole document gives nothing
+    std::array<char, 1024> buffer;
+    EXPECT_EQ(Convertor_JSON::GetInstance()->Serialize(root, Utility::DataType::Span<char>(buffer)), 0u);
+}
+
+TEST(Convertor_JSON, SerializesIntoCallerBuffer)
+{
+    JsonDocument document;
+    auto root = document.Array();
+    document.Add(root, document.String("a"));
+    document.Add(root, document.Number(0.125));
+
+    std::array<char, 32> buffer;
+    const auto length = Convertor_JSON::GetInstance()->Serialize(root, Utility::DataType::Span<char>(buffer));
+    EXPECT_EQ(std::string(buffer.data()), "[\"a\",0.125]");
+    EXPECT_EQ(length, 11u);
+
+    // Null terminator must fit as well
+    std::array<char, 11> exact;
+    EXPECT_EQ(Convertor_JSON::GetInstance()->Serialize(root, Utility::DataType::Span<char>(exact)), 0u);
+}
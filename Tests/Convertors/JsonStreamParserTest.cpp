@@ -0,0 +1,202 @@
+/* Code under test */
+#include "Common_components/Convertors/JsonStreamParser.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Component::Convertor;
+
+namespace
+{
+    // Document with every token type, escapes and whitespace between tokens
+    const char DOCUMENT[] = " {\"target\" : \"window\", \"requested\":true,\n"
+                            "\"values\":[-12.5e-1, 0, 42, 1E3, null, false, \"a\\\"b\\\\c\\/\\n\\u00e9\\u20AC\"],\n"
+                            "\"nested\":{\"empty\":{}, \"list\":[[], [{}]]}} ";
+
+    /**
+     * @brief Parser which writes events as text, one event per line
+     */
+    class Recorder
+    {
+    public:
+        Recorder() : mParser(&Recorder::OnEvent, this) {}
+
+        JsonStreamParser &Parser() { return mParser; }
+
+        const std::string &Events() const { return mEvents; }
+
+        void Clear()
+        {
+            mEvents.clear();
+            mParser.Reset();
+        }
+
+        /**
+         * @brief Feed document split into fragments at given positions, then finish it
+         */
+        JsonStreamStatus Parse(const std::string &document, const std::vector<size_t> &splits)
+        {
+            size_t begin = 0;
+            for (const auto split : splits)
+            {
+                mParser.Feed(document.data() + begin, split - begin);
+                begin = split;
+            }
+
+            mParser.Feed(document.data() + begin, document.size() - begin);
+            return mParser.Finish();
+        }
+
+    private:
+        static void OnEvent(const JsonEvent &event, void *context)
+        {
+            static const char *const names[] = {"{", "}", "[", "]", "key", "string", "number", "bool", "null"};
+
+            char line[128];
+            std::snprintf(line, sizeof(line), "%zu %s", event.depth, names[static_cast<int>(event.type)]);
+
+            auto &events = static_cast<Recorder *>(context)->mEvents;
+            events += line;
+            if (event.type == JsonEventType::KEY || event.type == JsonEventType::STRING)
+                events += " " + std::string(event.text, event.length);
+            else if (event.type == JsonEventType::NUMBER)
+                events += " " + std::to_string(event.number);
+            else if (event.type == JsonEventType::BOOL)
+                events += event.boolean ? " true" : " false";
+            events += "\n";
+        }
+
+        JsonStreamParser mParser;
+        std::string mEvents;
+    };
+
+    /**
+     * @brief Parse whole document in one fragment
+     */
+    std::string ParseWhole(const std::string &document, JsonStreamStatus expected = JsonStreamStatus::COMPLETE)
+    {
+        Recorder recorder;
+        EXPECT_EQ(recorder.Parse(document, {}), expected) << document;
+        return recorder.Events();
+    }
+} // namespace
+
+TEST(JsonStreamParser, EmitsEventsOfEveryTokenType)
+{
+    const std::string expected = "0 {\n"
+                                 "1 key target\n"
+                                 "1 string window\n"
+                                 "1 key requested\n"
+                                 "1 bool true\n"
+                                 "1 key values\n"
+                                 "1 [\n"
+                                 "2 number -1.250000\n"
+                                 "2 number 0.000000\n"
+                                 "2 number 42.000000\n"
+                                 "2 number 1000.000000\n"
+                                 "2 null\n"
+                                 "2 bool false\n"
+                                 "2 string a\"b\\c/\n\xC3\xA9\xE2\x82\xAC\n"
+                                 "1 ]\n"
+                                 "1 key nested\n"
+                                 "1 {\n"
+                                 "2 key empty\n"
+                                 "2 {\n"
+                                 "2 }\n"
+                                 "2 key list\n"
+                                 "2 [\n"
+                                 "3 [\n"
+                                 "3 ]\n"
+                                 "3 [\n"
+                                 "4 {\n"
+                                 "4 }\n"
+                                 "3 ]\n"
+                                 "2 ]\n"
+                                 "1 }\n"
+                                 "0 }\n";
+
+    EXPECT_EQ(ParseWhole(DOCUMENT), expected);
+}
+
+TEST(JsonStreamParser, TokensSplitAtEveryPositionGiveTheSameEvents)
+{
+    const std::string document(DOCUMENT);
+    const auto expected = ParseWhole(document);
+
+    Recorder recorder;
+    for (size_t split = 0; split <= document.size(); ++split)
+    {
+        recorder.Clear();
+        ASSERT_EQ(recorder.Parse(document, {split}), JsonStreamStatus::COMPLETE) << "split at " << split;
+        EXPECT_EQ(recorder.Events(), expected) << "split at " << split;
+    }
+
+    // Every character in its own fragment
+    std::vector<size_t> splits;
+    for (size_t split = 1; split < document.size(); ++split)
+        splits.push_back(split);
+
+    recorder.Clear();
+    ASSERT_EQ(recorder.Parse(document, splits), JsonStreamStatus::COMPLETE);
+    EXPECT_EQ(recorder.Events(), expected);
+}
+
+TEST(JsonStreamParser, TopLevelScalarsAreFinishedByFinish)
+{
+    EXPECT_EQ(ParseWhole("-0.5"), "0 number -0.500000\n");
+    EXPECT_EQ(ParseWhole(" 17 "), "0 number 17.000000\n");
+    EXPECT_EQ(ParseWhole("\"text\""), "0 string text\n");
+    EXPECT_EQ(ParseWhole("true"), "0 bool true\n");
+    EXPECT_EQ(ParseWhole("[]"), "0 [\n0 ]\n");
+}
+
+TEST(JsonStreamParser, RejectsInvalidDocuments)
+{
+    const char *const invalid[] = {"",         " ",          "{",          "{\"a\"}",     "{\"a\":}",     "{\"a\":1,}", "[1,]",
+                                   "[1 2]",    "{\"a\":1]",  "[1}",        "tru",         "nul",          "-",          "1.2.3",
+                                   "\"a\nb\"", "\"\\x\"",    "\"\\u12G4\"", "{} {}",      "{a:1}",        "]",          "}"};
+
+    for (const auto document : invalid)
+    {
+        Recorder recorder;
+        EXPECT_EQ(recorder.Parse(document, {}), JsonStreamStatus::SYNTAX_ERROR) << "\"" << document << "\"";
+    }
+}
+
+TEST(JsonStreamParser, LimitsDepthAndTokenLength)
+{
+    const std::string deepest = std::string(JSON_STREAM_MAX_DEPTH, '[') + std::string(JSON_STREAM_MAX_DEPTH, ']');
+    ParseWhole(deepest);
+    ParseWhole("[" + deepest + "]", JsonStreamStatus::DEPTH_ERROR);
+
+    // One character of token buffer is kept for terminating null
+    const std::string longest(JSON_STREAM_MAX_TOKEN - 1, 'k');
+    ParseWhole("{\"" + longest + "\":1}");
+    ParseWhole("{\"" + longest + "k\":1}", JsonStreamStatus::TOKEN_ERROR);
+    ParseWhole("[" + std::string(JSON_STREAM_MAX_TOKEN, '1') + "]", JsonStreamStatus::TOKEN_ERROR);
+}
+
+TEST(JsonStreamParser, ErrorIsFinalUntilReset)
+{
+    Recorder recorder;
+    auto &parser = recorder.Parser();
+
+    EXPECT_EQ(parser.Feed("[1,,", 4), JsonStreamStatus::SYNTAX_ERROR);
+    const auto events = recorder.Events();
+
+    // Valid rest of document neither clears error nor emits events
+    EXPECT_EQ(parser.Feed("2]", 2), JsonStreamStatus::SYNTAX_ERROR);
+    EXPECT_EQ(parser.Finish(), JsonStreamStatus::SYNTAX_ERROR);
+    EXPECT_EQ(recorder.Events(), events);
+
+    recorder.Clear();
+    EXPECT_EQ(parser.GetStatus(), JsonStreamStatus::IN_PROGRESS);
+    EXPECT_EQ(parser.Feed("[2]", 3), JsonStreamStatus::COMPLETE);
+    EXPECT_EQ(recorder.Events(), "0 [\n1 number 2.000000\n0 ]\n");
+}
@@ -0,0 +1,103 @@
+/* Code under test */
+#include "Common_components/Convertors/NumberFormatter.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* STD library */
+#include <cinttypes>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Component::Convertor;
+
+namespace
+{
+    constexpr size_t VALUES = 4096;
+
+    constexpr size_t ITERATIONS = 1000000;
+
+    /**
+     * @brief Report time of one formatted number and output speed
+     */
+    void Report(const char *name, double nanoseconds, size_t characters)
+    {
+        std::printf("[ BENCHMARK] %-36s %10.1f %12.0f %10.1f\n", name, nanoseconds, 1e9 / nanoseconds,
+                    characters / static_cast<double>(VALUES) * 1e3 / nanoseconds);
+    }
+
+    /**
+     * @brief Measure formatting of values, return total length of output of one pass over values
+     */
+    template <typename T, typename Format>
+    size_t Measure(const char *name, const std::vector<T> &values, Format format)
+    {
+        size_t characters = 0;
+        for (const auto value : values)
+            characters += format(value);
+
+        const double nanoseconds = Benchmark::NanosecondsPerCall(ITERATIONS, [&](size_t i) {
+            Benchmark::DoNotOptimize(format(values[i % VALUES]));
+        });
+
+        Report(name, nanoseconds, characters);
+        return characters;
+    }
+} // namespace
+
+TEST(NumberFormatterBenchmark, FixedAgainstPrintfAndToString)
+{
+    // Sensor values, temperature to CO2
+    std::mt19937 random(15);
+    std::uniform_real_distribution<float> distribution(-40.0f, 5000.0f);
+    std::vector<float> values(VALUES);
+    for (auto &value : values)
+        value = distribution(random);
+
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    const Utility::DataType::Span<char> output(buffer);
+
+    std::printf("[ BENCHMARK] %-36s %10s %12s %10s\n", "float", "ns", "numbers/s", "MB/s");
+
+    const auto fixed2 = Measure("NumberFormatter::Fixed, 2 places", values, [&](float value) { return NumberFormatter::Fixed(value, 2, output); });
+    const auto printf2 = Measure("snprintf %.2f", values, [&](float value) {
+        return static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%.2f", value));
+    });
+
+    // std::to_string formats with 6 places
+    const auto fixed6 = Measure("NumberFormatter::Fixed, 6 places", values, [&](float value) { return NumberFormatter::Fixed(value, 6, output); });
+    const auto printf6 = Measure("snprintf %f", values, [&](float value) {
+        return static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%f", value));
+    });
+    const auto toString = Measure("std::to_string", values, [&](float value) { return std::to_string(value).size(); });
+
+    EXPECT_EQ(fixed2, printf2);
+    EXPECT_EQ(fixed6, printf6);
+    EXPECT_EQ(fixed6, toString);
+}
+
+TEST(NumberFormatterBenchmark, IntegerAgainstPrintfAndToString)
+{
+    // Timestamps, counters and small values
+    std::mt19937_64 random(15);
+    std::vector<int64_t> values(VALUES);
+    for (size_t i = 0; i < VALUES; ++i)
+        values[i] = static_cast<int64_t>(random()) >> (i % 64);
+
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    const Utility::DataType::Span<char> output(buffer);
+
+    std::printf("[ BENCHMARK] %-36s %10s %12s %10s\n", "int64_t", "ns", "numbers/s", "MB/s");
+
+    const auto integer = Measure("NumberFormatter::Integer", values, [&](int64_t value) { return NumberFormatter::Integer(value, output); });
+    const auto printf = Measure("snprintf %" PRId64, values, [&](int64_t value) {
+        return static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%" PRId64, value));
+    });
+    const auto toString = Measure("std::to_string", values, [&](int64_t value) { return std::to_string(value).size(); });
+
+    EXPECT_EQ(integer, printf);
+    EXPECT_EQ(integer, toString);
+}
@@ -0,0 +1,245 @@
+/* Code under test */
+#include "Common_components/Convertors/NumberFormatter.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <cfloat>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+using namespace Component::Convertor;
+
+namespace
+{
+    // Random values of every sweep
+    constexpr size_t RANDOM_VALUES = 50000;
+
+    /**
+     * @brief Format number with formatter
+     */
+    std::string Fixed(double value, uint8_t precision, bool trimZeros = false)
+    {
+        char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+        const auto length = NumberFormatter::Fixed(value, precision, Utility::DataType::Span<char>(buffer), trimZeros);
+        return std::string(buffer, length);
+    }
+
+    /**
+     * @brief Format number with printf
+     */
+    std::string Printf(double value, uint8_t precision)
+    {
+        char buffer[64];
+        const int length = std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+        return std::string(buffer, static_cast<size_t>(length));
+    }
+
+    /**
+     * @brief Compare formatter with printf at every precision, return number of mismatches
+     */
+    size_t CompareAllPrecisions(double value)
+    {
+        size_t mismatches = 0;
+        for (uint8_t precision = 0; precision <= NUMBER_FORMATTER_MAX_PRECISION; ++precision)
+        {
+            const auto expected = Printf(value, precision);
+            const auto actual = Fixed(value, precision);
+            if (actual != expected)
+            {
+                if (!mismatches)
+                    ADD_FAILURE() << "value " << std::hexfloat << value << " precision " << int(precision) << ": \"" << actual
+                                  << "\" instead of \"" << expected << "\"";
+                ++mismatches;
+            }
+        }
+
+        return mismatches;
+    }
+
+    /**
+     * @brief Get float from its bits
+     */
+    float FloatFromBits(uint32_t bits)
+    {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    std::string Integer(int64_t value)
+    {
+        char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+        return std::string(buffer, NumberFormatter::Integer(value, Utility::DataType::Span<char>(buffer)));
+    }
+
+    std::string Unsigned(uint64_t value)
+    {
+        char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+        return std::string(buffer, NumberFormatter::Unsigned(value, Utility::DataType::Span<char>(buffer)));
+    }
+
+    std::string PrintfInteger(int64_t value)
+    {
+        char buffer[32];
+        return std::string(buffer, static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%" PRId64, value)));
+    }
+
+    std::string PrintfUnsigned(uint64_t value)
+    {
+        char buffer[32];
+        return std::string(buffer, static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%" PRIu64, value)));
+    }
+} // namespace
+
+TEST(NumberFormatter, EveryFloatOfSensorRangeMatchesPrintf)
+{
+    // All floats in [16, 32) of both signs at precision of sensor values, every mantissa of binade
+    const float base = 16.0f;
+    uint32_t bits;
+    std::memcpy(&bits, &base, sizeof(bits));
+
+    size_t mismatches = 0;
+    for (uint32_t mantissa = 0; mantissa < (1u << 23); ++mantissa)
+    {
+        const double value = FloatFromBits(bits | mantissa);
+        for (const double signedValue : {value, -value})
+        {
+            if (Fixed(signedValue, 2) != Printf(signedValue, 2) && !mismatches++)
+                ADD_FAILURE() << "value " << signedValue << ": \"" << Fixed(signedValue, 2) << "\" instead of \"" << Printf(signedValue, 2) << "\"";
+        }
+    }
+
+    EXPECT_EQ(mismatches, 0u);
+}
+
+TEST(NumberFormatter, FloatsOfAllExponentsMatchPrintf)
+{
+    std::mt19937 random(15);
+    std::uniform_int_distribution<uint32_t> bits;
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < RANDOM_VALUES; ++i)
+    {
+        const float value = FloatFromBits(bits(random));
+        if (std::isfinite(value) && std::fabs(value) < 1.8e19f)
+            mismatches += CompareAllPrecisions(value);
+    }
+
+    // Extremes of float
+    for (const float value : {0.0f, -0.0f, FLT_MIN, -FLT_MIN, std::numeric_limits<float>::denorm_min(), -std::numeric_limits<float>::denorm_min(), 1.0f, -1.0f, 1.8e19f, -1.8e19f})
+        mismatches += CompareAllPrecisions(value);
+
+    EXPECT_EQ(mismatches, 0u);
+}
+
+TEST(NumberFormatter, DoublesAndTiesMatchPrintf)
+{
+    std::mt19937_64 random(15);
+    std::uniform_int_distribution<int> exponent(-40, 63);
+    std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+    std::uniform_int_distribution<int64_t> integral(-1000000, 1000000);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < RANDOM_VALUES; ++i)
+    {
+        const double value = std::ldexp(mantissa(random), exponent(random)) * (i & 1 ? -1 : 1);
+        if (std::fabs(value) < 18446744073709551616.0)
+            mismatches += CompareAllPrecisions(value);
+
+        // Decimal ties, exact in binary only for some precisions, otherwise just below or above
+        const int precision = static_cast<int>(i % (NUMBER_FORMATTER_MAX_PRECISION + 1));
+        const double tie = (static_cast<double>(integral(random)) + 0.5) / std::pow(10.0, precision);
+        mismatches += CompareAllPrecisions(tie);
+        mismatches += CompareAllPrecisions(std::nextafter(tie, 0.0));
+        mismatches += CompareAllPrecisions(std::nextafter(tie, 1e30));
+    }
+
+    // Binary ties round to even digit
+    for (const double value : {0.5, 1.5, 2.5, -0.5, -2.5, 0.125, 0.375, -0.625, 1.0e15 + 0.5, 18446744073709549568.0})
+        mismatches += CompareAllPrecisions(value);
+
+    EXPECT_EQ(mismatches, 0u);
+}
+
+TEST(NumberFormatter, NegativeValueRoundedToZeroKeepsSign)
+{
+    EXPECT_EQ(Fixed(-0.001, 2), "-0.00");
+    EXPECT_EQ(Fixed(-0.001, 2), Printf(-0.001, 2));
+    EXPECT_EQ(Fixed(-0.0, 0), "-0");
+    EXPECT_EQ(Fixed(-0.004f, 2), Printf(-0.004f, 2));
+    EXPECT_EQ(Fixed(-0.005, 2), Printf(-0.005, 2));
+
+    // Trimmed output of negative zero is still valid JSON number
+    EXPECT_EQ(Fixed(-0.001, 2, true), "-0");
+    EXPECT_EQ(Fixed(-1.2, 3, true), "-1.2");
+    EXPECT_EQ(Fixed(20.0, 3, true), "20");
+}
+
+TEST(NumberFormatter, RejectsNumbersWhichDoNotFit)
+{
+    char buffer[NUMBER_FORMATTER_BUFFER_SIZE];
+    const Utility::DataType::Span<char> output(buffer);
+
+    EXPECT_EQ(NumberFormatter::Fixed(std::numeric_limits<double>::quiet_NaN(), 2, output), 0u);
+    EXPECT_EQ(NumberFormatter::Fixed(std::numeric_limits<double>::infinity(), 2, output), 0u);
+    EXPECT_EQ(NumberFormatter::Fixed(18446744073709551616.0, 2, output), 0u);
+
+    // Output needs 6 characters
+    EXPECT_EQ(NumberFormatter::Fixed(-12.5, 2, output.First(5)), 0u);
+    EXPECT_EQ(NumberFormatter::Fixed(-12.5, 2, output.First(6)), 6u);
+    EXPECT_EQ(std::string(buffer, 6), "-12.50");
+
+    // Precision is limited
+    EXPECT_EQ(Fixed(0.5, 20), Printf(0.5, NUMBER_FORMATTER_MAX_PRECISION));
+}
+
+TEST(NumberFormatter, IntegersMatchPrintf)
+{
+    size_t mismatches = 0;
+    auto compare = [&](int64_t value) {
+        if (Integer(value) != PrintfInteger(value) && !mismatches++)
+            ADD_FAILURE() << "integer " << value << ": \"" << Integer(value) << "\"";
+
+        const auto magnitude = static_cast<uint64_t>(value);
+        if (Unsigned(magnitude) != PrintfUnsigned(magnitude) && !mismatches++)
+            ADD_FAILURE() << "unsigned " << magnitude << ": \"" << Unsigned(magnitude) << "\"";
+    };
+
+    // Every number of digits and its neighbours
+    int64_t power = 1;
+    for (int digits = 0; digits < 19; ++digits, power *= 10)
+    {
+        for (const int64_t value : {power - 1, power, power + 1})
+        {
+            compare(value);
+            compare(-value);
+        }
+    }
+
+    for (const int64_t value : {std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), int64_t(0)})
+        compare(value);
+
+    std::mt19937_64 random(15);
+    for (size_t i = 0; i < RANDOM_VALUES; ++i)
+    {
+        const auto value = static_cast<int64_t>(random());
+        compare(value);
+        compare(value >> (i % 64));
+    }
+
+    EXPECT_EQ(mismatches, 0u);
+
+    // Output which does not fit is not written
+    char buffer[4];
+    EXPECT_EQ(NumberFormatter::Integer(-1000, Utility::DataType::Span<char>(buffer)), 0u);
+    EXPECT_EQ(NumberFormatter::Integer(-100, Utility::DataType::Span<char>(buffer)), 4u);
+    EXPECT_EQ(NumberFormatter::Unsigned(10000, Utility::DataType::Span<char>(buffer)), 0u);
+}
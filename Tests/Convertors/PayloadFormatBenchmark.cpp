@@ -0,0 +1,268 @@
+/* Code under test */
+#include "Common_components/Convertors/CborWriter.hpp"
+#include "Common_components/Convertors/JsonWriter.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/AllocationCounter.hpp"
+#include "Support/Benchmark.hpp"
+#include "Support/CJsonModel.hpp"
+
+/* STD library */
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+using namespace Component::Convertor;
+
+namespace
+{
+    // Publish buffer of server, default of Kconfig
+    constexpr size_t PUBLISH_BUFFER_SIZE = 1024;
+
+    // Maximum records in batch, default of Kconfig
+    constexpr size_t BATCH_RECORDS = 8;
+
+    constexpr size_t ITERATIONS = 200000;
+
+    /* Sensors data of one record, fields not measured by client are not set */
+    struct Record
+    {
+        uint8_t position;
+        int64_t time;
+        bool hasAir;
+        float temperature;
+        float humidity;
+        bool hasCO2;
+        uint16_t co2;
+        bool hasSoil;
+        float soilMoisture;
+    };
+
+    /**
+     * @brief Write record as object with the same layout as network manager of server
+     */
+    template <typename Writer>
+    void WriteRecord(Writer &writer, const Record &record)
+    {
+        writer.BeginObject();
+        writer.Key("ID").Integer(1);
+        writer.Key("position").Integer(record.position);
+
+        writer.Key("Data").BeginObject();
+        writer.Key("measure_time").Integer(record.time);
+
+        if (record.hasAir)
+        {
+            writer.Key("temperature").Number(record.temperature);
+            writer.Key("humidity").Number(record.humidity);
+        }
+
+        if (record.hasCO2)
+            writer.Key("CO2").Integer(record.co2);
+
+        if (record.hasSoil)
+            writer.Key("soil_moisture").Number(record.soilMoisture);
+
+        writer.EndObject();
+        writer.EndObject();
+    }
+
+    /**
+     * @brief Write one record or batch of records
+     */
+    template <typename Writer>
+    void WritePayload(Writer &writer, const Record &record, size_t records)
+    {
+        writer.Reset();
+
+        if (records == 1)
+        {
+            WriteRecord(writer, record);
+            return;
+        }
+
+        writer.BeginArray();
+        for (size_t i = 0; i < records; ++i)
+        {
+            Record next = record;
+            next.time += i * 150;
+            next.temperature += i * 0.07f;
+            WriteRecord(writer, next);
+        }
+        writer.EndArray();
+    }
+
+    /* Size and encode time of payload */
+    struct FormatCost
+    {
+        size_t size;
+        double nanoseconds;
+    };
+
+    /**
+     * @brief Measure size of payload and average time of its encoding into publish buffer
+     */
+    template <typename Writer, typename Byte>
+    FormatCost Measure(const Record &record, size_t records)
+    {
+        std::array<Byte, PUBLISH_BUFFER_SIZE> buffer;
+        Writer writer{Utility::DataType::Span<Byte>(buffer)};
+
+        WritePayload(writer, record, records);
+        EXPECT_TRUE(writer.IsComplete());
+        const size_t size = writer.Size();
+
+        const double nanoseconds = Benchmark::NanosecondsPerCall(ITERATIONS / records, [&](size_t) {
+            WritePayload(writer, record, records);
+            Benchmark::DoNotOptimize(writer.Size());
+        });
+
+        return {size, nanoseconds};
+    }
+
+    /**
+     * @brief Build record as cJSON tree the way network manager did before JSON writer
+     */
+    cJSON *BuildRecordTree(const Record &record)
+    {
+        auto root = cJSON_CreateObject();
+        cJSON_AddNumberToObject(root, "ID", 1);
+        cJSON_AddNumberToObject(root, "position", record.position);
+        auto data = cJSON_AddObjectToObject(root, "Data");
+
+        cJSON_AddNumberToObject(data, "measure_time", static_cast<double>(record.time));
+
+        if (record.hasAir)
+        {
+            cJSON_AddNumberToObject(data, "temperature", record.temperature);
+            cJSON_AddNumberToObject(data, "humidity", record.humidity);
+        }
+
+        if (record.hasCO2)
+            cJSON_AddNumberToObject(data, "CO2", record.co2);
+
+        if (record.hasSoil)
+            cJSON_AddNumberToObject(data, "soil_moisture", record.soilMoisture);
+
+        return root;
+    }
+
+    /**
+     * @brief CPU time of calling thread
+     */
+    double ThreadCpuNanoseconds()
+    {
+        timespec time;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+        return time.tv_sec * 1e9 + time.tv_nsec;
+    }
+
+    /* Cost of formatting one message */
+    struct MessageCost
+    {
+        size_t size;
+        size_t allocations;
+        double cpuNanoseconds;
+    };
+
+    /**
+     * @brief Measure size, allocations and CPU time of one message
+     *
+     * @param[in] format    : Formats one message, returns its length
+     */
+    template <typename Format>
+    MessageCost MeasureMessage(Format format)
+    {
+        MessageCost cost;
+        {
+            Allocation::Scope scope;
+            cost.size = format();
+            cost.allocations = scope.Allocations();
+        }
+
+        const double start = ThreadCpuNanoseconds();
+        for (size_t i = 0; i < ITERATIONS; ++i)
+            Benchmark::DoNotOptimize(format());
+        cost.cpuNanoseconds = (ThreadCpuNanoseconds() - start) / ITERATIONS;
+
+        return cost;
+    }
+} // namespace
+
+TEST(PayloadFormatBenchmark, CborAgainstJsonSizeAndEncodeTime)
+{
+    struct Case
+    {
+        const char *name;
+        Record record;
+        size_t records;
+    };
+
+    const Case cases[] = {
+        {"all sensors", {1, 1718000000, true, 23.456f, 61.2f, true, 612, true, 41.37f}, 1},
+        {"air sensor", {2, 1718000000, true, 19.875f, 74.5f, false, 0, false, 0.0f}, 1},
+        {"all sensors, batch", {1, 1718000000, true, 23.456f, 61.2f, true, 612, true, 41.37f}, BATCH_RECORDS},
+    };
+
+    std::printf("[ BENCHMARK] %-20s %8s %10s %8s %10s %10s %10s\n", "payload", "records", "JSON B", "CBOR B", "CBOR/JSON", "JSON ns", "CBOR ns");
+
+    for (const auto &test : cases)
+    {
+        const auto json = Measure<JsonWriter, char>(test.record, test.records);
+        const auto cbor = Measure<CborWriter, uint8_t>(test.record, test.records);
+
+        std::printf("[ BENCHMARK] %-20s %8zu %10zu %8zu %9.1f%% %10.1f %10.1f\n", test.name, test.records, json.size, cbor.size,
+                    100.0 * cbor.size / json.size, json.nanoseconds, cbor.nanoseconds);
+
+        EXPECT_LT(cbor.size, json.size) << test.name;
+    }
+}
+
+TEST(PayloadFormatBenchmark, JsonWriterAgainstCJsonTreeAndPrint)
+{
+    struct Case
+    {
+        const char *name;
+        Record record;
+    };
+
+    const Case cases[] = {
+        {"all sensors", {1, 1718000000, true, 23.456f, 61.2f, true, 612, true, 41.37f}},
+        {"air sensor", {2, 1718000000, true, 19.875f, 74.5f, false, 0, false, 0.0f}},
+    };
+
+    std::array<char, PUBLISH_BUFFER_SIZE> buffer;
+    JsonWriter writer{Utility::DataType::Span<char>(buffer)};
+
+    std::printf("[ BENCHMARK] %-12s %-10s %7s %7s %10s %10s\n", "payload", "path", "bytes", "allocs", "CPU ns", "MB/s");
+
+    for (const auto &test : cases)
+    {
+        // Tree is built, printed and freed for every message, like publish of network manager did
+        const auto tree = MeasureMessage([&]() {
+            auto root = BuildRecordTree(test.record);
+            auto text = cJSON_Print(root);
+            const size_t size = std::strlen(text);
+            cJSON_free(text);
+            cJSON_Delete(root);
+            return size;
+        });
+
+        const auto streamed = MeasureMessage([&]() {
+            writer.Reset();
+            WriteRecord(writer, test.record);
+            return writer.Size();
+        });
+
+        for (const auto &row : {std::make_pair("cJSON", tree), std::make_pair("JsonWriter", streamed)})
+            std::printf("[ BENCHMARK] %-12s %-10s %7zu %7zu %10.1f %10.1f\n", test.name, row.first, row.second.size, row.second.allocations,
+                        row.second.cpuNanoseconds, row.second.size * 1e3 / row.second.cpuNanoseconds);
+
+        EXPECT_TRUE(writer.IsComplete()) << test.name;
+        EXPECT_EQ(streamed.allocations, 0u) << test.name;
+        EXPECT_GT(tree.allocations, 0u) << test.name;
+        EXPECT_LT(streamed.size, tree.size) << test.name;
+    }
+}
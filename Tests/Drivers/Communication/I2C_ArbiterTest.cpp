@@ -0,0 +1,255 @@
+/* Code under test */
+#include "I2C_Arbiter.hpp"
+#include "SCD4x.hpp"
+#include "SHT4x.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Fakes/FakeI2CBus.hpp"
+
+/* Host stubs */
+#include "HostRtos.hpp"
+
+/* Common components */
+#include "Common_components/Utility/Checksum/Crc8.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Component::Driver::Communication;
+using Fake::FakeI2CBus;
+
+namespace
+{
+    constexpr uint8_t SHT4x_ADDRESS = 0x44;
+    constexpr uint8_t SCD4x_ADDRESS = 0x62;
+
+    // Tick of firmware
+    constexpr std::chrono::microseconds TICK_PERIOD(1000);
+
+    /**
+     * @brief Response of sensor, every word followed by its CRC
+     */
+    std::vector<uint8_t> Words(std::initializer_list<uint16_t> words)
+    {
+        std::vector<uint8_t> response;
+        for (const auto word : words)
+        {
+            const uint8_t bytes[] = {static_cast<uint8_t>(word >> 8), static_cast<uint8_t>(word)};
+            response.insert(response.end(), bytes, bytes + 2);
+            response.push_back(Utility::Checksum::SensirionCrc8::Compute(Utility::DataType::ByteView(bytes, sizeof(bytes))));
+        }
+
+        return response;
+    }
+
+    /**
+     * @brief Let time of given ticks pass on test thread
+     */
+    void Sleep(TickType_t ticks)
+    {
+        std::this_thread::sleep_for(ticks * Host::GetTickPeriod());
+    }
+
+    /**
+     * @brief Arbiter running on fake bus which holds tasks for time of transfers
+     */
+    class I2C_ArbiterTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            mTickPeriod = Host::GetTickPeriod();
+            Host::SetTickPeriod(TICK_PERIOD);
+
+            mBus.SetRealTime(true);
+            ASSERT_TRUE(mArbiter.Start());
+        }
+
+        void TearDown() override { Host::SetTickPeriod(mTickPeriod); }
+
+        /**
+         * @brief Wait until client threads reached bus, loaded host may start them late
+         */
+        void WaitForTransfers(size_t transfers)
+        {
+            while (mBus.GetStarted() < transfers)
+                std::this_thread::yield();
+        }
+
+        /**
+         * @brief Check order of transfers on bus by slave address and number of written bytes
+         */
+        void ExpectOrder(std::initializer_list<std::pair<uint8_t, size_t>> order)
+        {
+            const auto &log = mBus.GetLog();
+            ASSERT_EQ(log.size(), order.size());
+
+            size_t i = 0;
+            for (const auto &expected : order)
+            {
+                EXPECT_EQ(log[i].address, expected.first) << "transfer " << i;
+                EXPECT_EQ(log[i].written, expected.second) << "transfer " << i;
+                ++i;
+            }
+        }
+
+        FakeI2CBus mBus;
+        I2C_Arbiter mArbiter{&mBus};
+
+    private:
+        std::chrono::microseconds mTickPeriod;
+    };
+} // namespace
+
+TEST_F(I2C_ArbiterTest, DeferredReadLeavesBusToOtherDevice)
+{
+    const auto measurement = Words({600, 0x6666, 0x8000});
+    const auto serial = Words({0x1234, 0x5678});
+    mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05});
+    mBus.Expect(SCD4x_ADDRESS, {}, measurement);
+    mBus.Expect(SHT4x_ADDRESS, {0x89}, serial);
+
+    I2C_ArbiterClient scd4x(&mArbiter);
+    I2C_ArbiterClient sht4x(&mArbiter);
+
+    // Measurement is read 20 ticks after its command
+    const uint8_t readMeasurement[] = {0xEC, 0x05};
+    std::array<uint8_t, 9> measured{};
+    std::thread slow([&] {
+        size_t completed{0};
+        const I2C_Transaction transaction = {SCD4x_ADDRESS, Utility::DataType::ByteView(readMeasurement, sizeof(readMeasurement)),
+                                             Utility::DataType::Span<uint8_t>(measured), 20};
+        EXPECT_EQ(scd4x.Execute(Utility::DataType::Span<const I2C_Transaction>(&transaction, 1), completed), I2C_Result::I2C_OK);
+        EXPECT_EQ(completed, 1u);
+    });
+
+    // Other device uses bus while the first one executes command
+    WaitForTransfers(1);
+    Sleep(5);
+    const uint8_t readSerial[] = {0x89};
+    std::array<uint8_t, 6> number{};
+    const auto start = xTaskGetTickCount();
+    EXPECT_EQ(sht4x.WriteRead(SHT4x_ADDRESS, Utility::DataType::ByteView(readSerial, sizeof(readSerial)), Utility::DataType::Span<uint8_t>(number)),
+              I2C_Result::I2C_OK);
+    EXPECT_LT(xTaskGetTickCount() - start, 20u);
+
+    slow.join();
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_TRUE(std::equal(measured.begin(), measured.end(), measurement.begin()));
+    EXPECT_TRUE(std::equal(number.begin(), number.end(), serial.begin()));
+    ExpectOrder({{SCD4x_ADDRESS, 2}, {SHT4x_ADDRESS, 1}, {SCD4x_ADDRESS, 0}});
+
+    const auto statistics = mArbiter.GetStatistics();
+    EXPECT_EQ(statistics.requests, 2u);
+    EXPECT_EQ(statistics.failures, 0u);
+    EXPECT_EQ(statistics.deferred, 1u);
+    EXPECT_EQ(statistics.missedDeadlines, 0u);
+}
+
+TEST_F(I2C_ArbiterTest, DeferredReadKeepsLatencyOfRequest)
+{
+    constexpr uint8_t SLOW_ADDRESS = 0x30;
+    constexpr uint8_t URGENT_ADDRESS = 0x31;
+
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8});
+    mBus.Expect(SCD4x_ADDRESS, {}, Words({0x8006}));
+    // Slow device holds bus for 200 ticks, so deferred read and urgent request wait for it together. Long times
+    // leave margin for late start of threads on loaded host
+    mBus.Expect(SLOW_ADDRESS, {0x01}, {}, 200 * TICK_PERIOD.count());
+    mBus.Expect(URGENT_ADDRESS, {0x02});
+
+    I2C_ArbiterClient scd4x(&mArbiter, 0, 100);
+    I2C_ArbiterClient slow(&mArbiter, 0, 100);
+    I2C_ArbiterClient urgent(&mArbiter, 0, 10);
+
+    const uint8_t status[] = {0xE4, 0xB8};
+    std::array<uint8_t, 3> ready{};
+    std::thread scd4xTask([&] {
+        size_t completed{0};
+        const I2C_Transaction transaction = {SCD4x_ADDRESS, Utility::DataType::ByteView(status, sizeof(status)),
+                                             Utility::DataType::Span<uint8_t>(ready), 50};
+        EXPECT_EQ(scd4x.Execute(Utility::DataType::Span<const I2C_Transaction>(&transaction, 1), completed), I2C_Result::I2C_OK);
+    });
+
+    WaitForTransfers(1);
+    Sleep(2);
+    const uint8_t slowCommand[] = {0x01};
+    std::thread slowTask([&] { EXPECT_EQ(slow.Write(SLOW_ADDRESS, Utility::DataType::ByteView(slowCommand, 1)), I2C_Result::WRITE_DATA_SUCCESSFUL); });
+
+    WaitForTransfers(2);
+
+    // Read of status is due while slow device holds bus, urgent request has earlier deadline than read with its latency
+    Sleep(60);
+    const uint8_t urgentCommand[] = {0x02};
+    EXPECT_EQ(urgent.Write(URGENT_ADDRESS, Utility::DataType::ByteView(urgentCommand, 1)), I2C_Result::WRITE_DATA_SUCCESSFUL);
+
+    scd4xTask.join();
+    slowTask.join();
+
+    EXPECT_TRUE(mBus.IsDone());
+    ExpectOrder({{SCD4x_ADDRESS, 2}, {SLOW_ADDRESS, 1}, {URGENT_ADDRESS, 1}, {SCD4x_ADDRESS, 0}});
+}
+
+TEST_F(I2C_ArbiterTest, SensorsMeasureConcurrently)
+{
+    // Sensors wait for seconds of ticks, shorter tick keeps test fast
+    Host::SetTickPeriod(std::chrono::microseconds(20));
+
+    I2C_ArbiterClient scd4xBus(&mArbiter, 1);
+    I2C_ArbiterClient sht4xBus(&mArbiter, 0);
+    Sensor::SCD4x scd4x(SCD4x_ADDRESS, &scd4xBus);
+    Sensor::SHT4x sht4x(SHT4x_ADDRESS, &sht4xBus);
+
+    // Status and measurement of SCD4x are read one tick after their command
+    mBus.Expect(SCD4x_ADDRESS, {0x21, 0x9D});
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8});
+    mBus.Expect(SCD4x_ADDRESS, {}, Words({0x8006}));
+    mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05});
+    mBus.Expect(SCD4x_ADDRESS, {}, Words({600, 0x6666, 0x8000}));
+
+    // SHT4x measures several times during single conversion of SCD4x
+    constexpr size_t SHT4x_MEASUREMENTS = 10;
+    for (size_t i = 0; i < SHT4x_MEASUREMENTS; ++i)
+    {
+        mBus.Expect(SHT4x_ADDRESS, {MEASURE_T_RH_HIGH_PRECISION});
+        mBus.Expect(SHT4x_ADDRESS, {}, Words({0x6666, 0x8000}));
+    }
+
+    std::atomic<bool> converting{false};
+    std::thread scd4xTask([&] {
+        EXPECT_EQ(scd4x.StartMeasurement(), Sensor::I2C_OperationResult::I2C_OK);
+        converting = true;
+        EXPECT_TRUE(scd4x.WaitForData());
+        EXPECT_EQ(scd4x.ReadMeasurement(), Sensor::I2C_OperationResult::I2C_OK);
+    });
+
+    while (!converting)
+        std::this_thread::yield();
+
+    for (size_t i = 0; i < SHT4x_MEASUREMENTS; ++i)
+        sht4x.Measure();
+    scd4xTask.join();
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_EQ(scd4x.GetCO2(), 600);
+    EXPECT_NEAR(sht4x.GetTemperature(), 25.0f, 0.01f);
+
+    // SHT4x measured while SCD4x was converting, loaded host may leave its last measurements after conversion
+    const auto &log = mBus.GetLog();
+    const auto isSCD4x = [](const FakeI2CBus::Record &record) { return record.address == SCD4x_ADDRESS; };
+    const auto measurementRead = std::find_if(log.rbegin(), log.rend(), isSCD4x).base();
+    EXPECT_TRUE(isSCD4x(log.front()));
+    EXPECT_TRUE(std::any_of(log.begin(), measurementRead, [&](const FakeI2CBus::Record &record) { return !isSCD4x(record); }));
+
+    const auto statistics = mArbiter.GetStatistics();
+    EXPECT_EQ(statistics.requests, 3 + 2 * SHT4x_MEASUREMENTS);
+    EXPECT_EQ(statistics.failures, 0u);
+    EXPECT_EQ(statistics.deferred, 2u);
+}
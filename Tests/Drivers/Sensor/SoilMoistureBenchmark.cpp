@@ -0,0 +1,157 @@
+/* Code under test */
+#include "Common_components/Drivers/Sensor/SoilMoistureSensor.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* Host stubs */
+#include "HostPeripherals.hpp"
+#include "HostRtos.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+
+using Component::Driver::Sensor::SoilMoistureSensor;
+
+namespace
+{
+    // Raw value of probe in soil with 50 % moisture by default calibration
+    constexpr int TRUE_RAW = (SENSOR_MIN + SENSOR_MAX) / 2;
+    constexpr float TRUE_MOISTURE = 50.0f;
+
+    // Readings of sensor compared by every stream, the first ones settle filter
+    constexpr size_t READS = 2000;
+    constexpr size_t SETTLING_READS = 20;
+
+    // Largest value of 12-bit ADC
+    constexpr int ADC_MAX = 4095;
+
+    /* Synthetic stream of ADC samples */
+    struct Stream
+    {
+        const char *name;
+        // Standard deviation of gaussian noise in raw values
+        double noise;
+        // Share of samples replaced by spike anywhere in range of ADC
+        double spikes;
+        // Share of failed readings
+        double failures;
+    };
+
+    /**
+     * @brief Moisture of single raw value by default calibration, as sensor measured without filtering
+     */
+    float SingleReading(uint16_t raw)
+    {
+        const float moisture = static_cast<float>(SENSOR_MAX - raw) / (SENSOR_MAX - SENSOR_MIN) * OUTPUT_MAX;
+        return std::min<float>(std::max<float>(moisture, OUTPUT_MIN), OUTPUT_MAX);
+    }
+
+    /* Error of readings against true moisture */
+    struct Accuracy
+    {
+        double bias;
+        double deviation;
+        double rms;
+    };
+
+    /**
+     * @brief Collect readings and compute their error
+     */
+    Accuracy Evaluate(const std::function<float()> &read)
+    {
+        for (size_t i = 0; i < SETTLING_READS; ++i)
+            read();
+
+        double sum{0.0}, squares{0.0};
+        for (size_t i = 0; i < READS; ++i)
+        {
+            const double error = read() - TRUE_MOISTURE;
+            sum += error;
+            squares += error * error;
+        }
+
+        const double bias = sum / READS;
+        const double rms = std::sqrt(squares / READS);
+        return {bias, std::sqrt(std::max(0.0, rms * rms - bias * bias)), rms};
+    }
+} // namespace
+
+TEST(SoilMoistureBenchmark, FilteredAgainstSingleReadings)
+{
+    // Sensor waits for configuration of ADC
+    const auto period = Host::GetTickPeriod();
+    Host::SetTickPeriod(std::chrono::microseconds(10));
+
+    const Stream streams[] = {
+        {"calm, gaussian 5", 5.0, 0.0, 0.0},
+        {"gaussian 30", 30.0, 0.0, 0.0},
+        {"gaussian 30, 5% spikes", 30.0, 0.05, 0.0},
+        {"gaussian 30, 2% failures", 30.0, 0.0, 0.02},
+        {"gaussian 80, 10% spikes", 80.0, 0.10, 0.0},
+    };
+
+    std::printf("[ BENCHMARK] burst of %d samples, IIR weight %.2f, %zu readings per stream\n", SOIL_OVERSAMPLING, SOIL_FILTER_ALPHA, READS);
+    std::printf("[ BENCHMARK] %-26s %10s %10s %10s %10s %12s %12s\n", "stream", "single sd", "single rms", "filter sd",
+                "filter rms", "single ns", "filter ns");
+
+    for (size_t s = 0; s < sizeof(streams) / sizeof(streams[0]); ++s)
+    {
+        const auto &stream = streams[s];
+
+        std::mt19937 generator(static_cast<unsigned>(s + 1));
+        std::normal_distribution<double> noise(0.0, stream.noise);
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+        std::uniform_int_distribution<int> spike(0, ADC_MAX);
+
+        Host::SetAdcSource([&]() {
+            const double roll = chance(generator);
+            if (roll < stream.failures)
+                return -1;
+            if (roll < stream.failures + stream.spikes)
+                return spike(generator);
+
+            return std::min(std::max(static_cast<int>(std::lround(TRUE_RAW + noise(generator))), 0), ADC_MAX);
+        });
+
+        SoilMoistureSensor sensor(ADC2_CHANNEL_3, ADC_WIDTH_BIT_12, ADC_ATTEN_DB_11);
+
+        // Failed reading gives zero, without filter it reads as saturated wet soil
+        const auto single = Evaluate([&] { return SingleReading(sensor.MeasureRawData()); });
+
+        const size_t readings = Host::AdcReadings();
+        const auto filtered = Evaluate([&] { return sensor.Measure(); });
+        EXPECT_EQ(Host::AdcReadings() - readings, (READS + SETTLING_READS) * SOIL_OVERSAMPLING);
+
+        const double singleCost = Benchmark::NanosecondsPerCall(READS, [&](size_t) { Benchmark::DoNotOptimize(sensor.MeasureRawData()); });
+        const double filteredCost = Benchmark::NanosecondsPerCall(READS, [&](size_t) { Benchmark::DoNotOptimize(sensor.Measure()); });
+
+        std::printf("[ BENCHMARK] %-26s %10.3f %10.3f %10.3f %10.3f %12.1f %12.1f\n", stream.name, single.deviation, single.rms,
+                    filtered.deviation, filtered.rms, singleCost, filteredCost);
+
+        // Cached value is the last filtered one
+        const float last = sensor.Measure();
+        EXPECT_FLOAT_EQ(sensor.Moisture(), last);
+        EXPECT_LT(filtered.rms, single.rms) << stream.name;
+    }
+
+    // Reading of cached value does not touch ADC
+    Host::SetAdcSource([] { return TRUE_RAW; });
+    SoilMoistureSensor sensor(ADC2_CHANNEL_3, ADC_WIDTH_BIT_12, ADC_ATTEN_DB_11);
+    sensor.Measure();
+
+    const size_t readings = Host::AdcReadings();
+    const double cachedCost = Benchmark::NanosecondsPerCall(1000000, [&](size_t) { Benchmark::DoNotOptimize(sensor.Moisture()); });
+    EXPECT_EQ(Host::AdcReadings(), readings);
+    EXPECT_NEAR(sensor.Moisture(), TRUE_MOISTURE, 0.1f);
+    Benchmark::Report("cached moisture", cachedCost, "ns/read");
+
+    Host::SetAdcSource(nullptr);
+    Host::SetTickPeriod(period);
+}
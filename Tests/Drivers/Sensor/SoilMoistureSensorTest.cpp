@@ -0,0 +1,96 @@
+/* Code under test */
+#include "Common_components/Drivers/Sensor/SoilMoistureSensor.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* Host stubs */
+#include "HostPeripherals.hpp"
+#include "HostRtos.hpp"
+
+/* STD library */
+#include <chrono>
+#include <memory>
+
+using Component::Driver::Sensor::SoilCalibration;
+using Component::Driver::Sensor::SoilMoistureSensor;
+
+namespace
+{
+    /**
+     * @brief Sensors are created with short tick and empty NVS
+     */
+    class SoilMoistureSensorTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            mPeriod = Host::GetTickPeriod();
+            Host::SetTickPeriod(std::chrono::microseconds(10));
+            Host::EraseNvs();
+        }
+
+        void TearDown() override
+        {
+            Host::SetAdcSource(nullptr);
+            Host::SetTickPeriod(mPeriod);
+        }
+
+        // Sensor owns its ADC channel and is not copied
+        std::unique_ptr<SoilMoistureSensor> MakeSensor()
+        {
+            return std::unique_ptr<SoilMoistureSensor>(new SoilMoistureSensor(ADC2_CHANNEL_3, ADC_WIDTH_BIT_12, ADC_ATTEN_DB_11));
+        }
+
+        std::chrono::microseconds mPeriod;
+    };
+} // namespace
+
+TEST_F(SoilMoistureSensorTest, CalibrationIsStoredAndLoadedByNextSensor)
+{
+    Host::SetAdcSource([] { return 1500; });
+    auto sensor = MakeSensor();
+    EXPECT_FALSE(sensor->LoadCalibration());
+    EXPECT_EQ(sensor->GetCalibration().dry, SENSOR_MAX);
+
+    // Probe on air
+    Host::SetAdcSource([] { return 3000; });
+    ASSERT_TRUE(sensor->CalibrateDry());
+
+    // Probe in water
+    Host::SetAdcSource([] { return 1000; });
+    ASSERT_TRUE(sensor->CalibrateWet());
+
+    Host::SetAdcSource([] { return 2000; });
+    EXPECT_FLOAT_EQ(sensor->Measure(), 50.0f);
+
+    auto restarted = MakeSensor();
+    ASSERT_TRUE(restarted->LoadCalibration());
+    EXPECT_EQ(restarted->GetCalibration().dry, 3000);
+    EXPECT_EQ(restarted->GetCalibration().wet, 1000);
+    EXPECT_FLOAT_EQ(restarted->Measure(), 50.0f);
+}
+
+TEST_F(SoilMoistureSensorTest, InvalidCalibrationIsRejected)
+{
+    auto sensor = MakeSensor();
+
+    // Wet point must be below dry point
+    EXPECT_FALSE(sensor->StoreCalibration({1000, 3000}));
+    EXPECT_FALSE(sensor->LoadCalibration());
+    EXPECT_EQ(sensor->GetCalibration().dry, SENSOR_MAX);
+    EXPECT_EQ(sensor->GetCalibration().wet, SENSOR_MIN);
+}
+
+TEST_F(SoilMoistureSensorTest, FailedBurstKeepsCachedValue)
+{
+    Host::SetAdcSource([] { return (SENSOR_MIN + SENSOR_MAX) / 2; });
+    auto sensor = MakeSensor();
+    ASSERT_FLOAT_EQ(sensor->Measure(), 50.0f);
+
+    // Failed readings are not taken as wet soil
+    Host::SetAdcSource([] { return -1; });
+    EXPECT_FLOAT_EQ(sensor->Measure(), 50.0f);
+    EXPECT_FALSE(sensor->CalibrateDry());
+    EXPECT_FLOAT_EQ(sensor->Moisture(), 50.0f);
+}
@@ -0,0 +1,285 @@
+/**
+ * Scriptable I2C bus of host tests
+ *
+ * Test scripts transfers expected from driver, in order of every slave address. Every transfer must match written
+ * bytes of the next step of its slave, bytes of step are then returned to driver. Time of transfer on wire is computed
+ * from clock of bus, waits between write and read are counted in ticks of the transaction and are not slept.
+ * Bus in real time holds calling task for time on wire and hold of step, so concurrent clients see busy bus.
+ *
+ * Script and log are reserved up front, so bus does not allocate while driver runs.
+ */
+#ifndef FAKE_I2C_BUS_H
+#define FAKE_I2C_BUS_H
+
+/* Code under test */
+#include "Common_components/Drivers/Communication/I2C_BusInterface.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Fake
+{
+    using Component::Driver::Communication::I2C_BusInterface;
+    using Component::Driver::Communication::I2C_Result;
+    using Component::Driver::Communication::I2C_Transaction;
+
+    class FakeI2CBus : public I2C_BusInterface
+    {
+    public:
+        // Clock of greenhouse client bus
+        static constexpr uint32_t DEFAULT_CLOCK = 400000;
+
+        // Tick of FreeRTOS configuration
+        static constexpr double DEFAULT_TICK_US = 1000.0;
+
+        // Bits of one byte with acknowledge
+        static constexpr uint32_t BYTE_BITS = 9;
+
+        // Capacity of script and log, more steps are reserved on demand before driver runs
+        static constexpr size_t CAPACITY = 64;
+
+        /* Transfer seen on bus */
+        struct Record
+        {
+            uint8_t address;
+            size_t written;
+            size_t read;
+            // Ticks waited between write and read
+            uint32_t delay;
+            // Time on wire in microseconds
+            double wire;
+            I2C_Result result;
+        };
+
+        explicit FakeI2CBus(uint32_t clock = DEFAULT_CLOCK, double tickMicroseconds = DEFAULT_TICK_US)
+            : mBitTime(1e6 / clock), mTickTime(tickMicroseconds), mRealTime(false), mMismatches(0), mStarted(0)
+        {
+            mScript.reserve(CAPACITY);
+            mLog.reserve(CAPACITY);
+        }
+
+        /**
+         * @brief Script transfer which succeeds
+         *
+         * @param[in] address   : Slave address
+         * @param[in] write     : Bytes driver must write, empty for read only transfer
+         * @param[in] response  : Bytes returned to driver
+         * @param[in] hold      : Microseconds slave holds bus after transfer, used in real time only
+         */
+        void Expect(uint8_t address, std::vector<uint8_t> write, std::vector<uint8_t> response = {}, uint32_t hold = 0)
+        {
+            Reserve();
+            mScript.push_back({address, std::move(write), std::move(response), true, hold, false});
+        }
+
+        /**
+         * @brief Script transfer which is not acknowledged by slave
+         */
+        void ExpectFailure(uint8_t address, std::vector<uint8_t> write)
+        {
+            Reserve();
+            mScript.push_back({address, std::move(write), {}, false, 0, false});
+        }
+
+        /**
+         * @brief Hold calling task for time of transfers
+         */
+        void SetRealTime(bool realTime) { mRealTime = realTime; }
+
+        /**
+         * @brief Check if driver made all scripted transfers and nothing else
+         */
+        bool IsDone() const
+        {
+            return !mMismatches && std::all_of(mScript.begin(), mScript.end(), [](const Step &step) { return step.done; });
+        }
+
+        /**
+         * @brief Get number of transfers which did not match script
+         */
+        size_t GetMismatches() const { return mMismatches; }
+
+        /**
+         * @brief Get number of transfers which reached bus. Unlike log, it can be read while clients run
+         */
+        size_t GetStarted() const { return mStarted; }
+
+        /**
+         * @brief Get transfers seen on bus
+         */
+        const std::vector<Record> &GetLog() const { return mLog; }
+
+        /**
+         * @brief Get time on wire of all transfers in microseconds
+         */
+        double WireTime() const
+        {
+            double time{0.0};
+            for (const auto &record : mLog)
+                time += record.wire;
+
+            return time;
+        }
+
+        /**
+         * @brief Get time bus was held by transfers including waits between write and read, in microseconds
+         */
+        double BusTime() const
+        {
+            double time = WireTime();
+            for (const auto &record : mLog)
+                time += record.delay * mTickTime;
+
+            return time;
+        }
+
+        /**
+         * @brief Forget script and log
+         */
+        void Clear()
+        {
+            mScript.clear();
+            mLog.clear();
+            mMismatches = 0;
+            mStarted = 0;
+        }
+
+        I2C_Result Write(const uint8_t slaveAddress, Utility::DataType::ByteView data) override
+        {
+            const auto result = Transfer({slaveAddress, data, {}, 0});
+            return result == I2C_Result::I2C_OK ? I2C_Result::WRITE_DATA_SUCCESSFUL : result;
+        }
+
+        I2C_Result Read(const uint8_t slaveAddress, Utility::DataType::Span<uint8_t> data) override
+        {
+            const auto result = Transfer({slaveAddress, {}, data, 0});
+            return result == I2C_Result::I2C_OK ? I2C_Result::READ_DATA_SUCCESSFUL : result;
+        }
+
+        I2C_Result WriteRead(const uint8_t slaveAddress, Utility::DataType::ByteView write, Utility::DataType::Span<uint8_t> read) override
+        {
+            if (write.empty() || read.empty())
+                return I2C_Result::INVALID_ARGUMENT;
+
+            return Transfer({slaveAddress, write, read, 0});
+        }
+
+        I2C_Result Execute(Utility::DataType::Span<const I2C_Transaction> transactions, size_t &completed) override
+        {
+            completed = 0;
+            for (const auto &transaction : transactions)
+            {
+                if (transaction.write.empty() && transaction.read.empty())
+                    return I2C_Result::INVALID_ARGUMENT;
+
+                const auto result = Transfer(transaction);
+                if (result != I2C_Result::I2C_OK)
+                    return result;
+
+                ++completed;
+            }
+
+            return I2C_Result::I2C_OK;
+        }
+
+    private:
+        /* Scripted transfer */
+        struct Step
+        {
+            uint8_t address;
+            std::vector<uint8_t> write;
+            std::vector<uint8_t> response;
+            bool acknowledged;
+            uint32_t hold;
+            bool done;
+        };
+
+        void Reserve()
+        {
+            if (mScript.size() == mScript.capacity())
+            {
+                mScript.reserve(2 * mScript.capacity());
+                mLog.reserve(mScript.capacity());
+            }
+        }
+
+        /**
+         * @brief Time of transaction on wire. Start, address and bytes of every part, stop at the end.
+         *        Part after wait starts after stop, part without wait after repeated start
+         */
+        double Wire(const I2C_Transaction &transaction) const
+        {
+            uint32_t bits{0};
+            if (!transaction.write.empty())
+                bits += 1 + BYTE_BITS * (1 + transaction.write.size()) + (transaction.delay ? 1 : 0);
+            if (!transaction.read.empty())
+                bits += 1 + BYTE_BITS * (1 + transaction.read.size());
+
+            return (bits + 1) * mBitTime;
+        }
+
+        I2C_Result Transfer(const I2C_Transaction &transaction)
+        {
+            ++mStarted;
+
+            Record record{transaction.address, transaction.write.size(), transaction.read.size(), transaction.delay, Wire(transaction),
+                          I2C_Result::I2C_OK};
+
+            // The next step of slave
+            auto step = std::find_if(mScript.begin(), mScript.end(),
+                                     [&transaction](const Step &candidate) { return !candidate.done && candidate.address == transaction.address; });
+
+            const bool matches = step != mScript.end() && step->write.size() == transaction.write.size() &&
+                                 std::equal(transaction.write.begin(), transaction.write.end(), step->write.begin()) &&
+                                 step->response.size() == transaction.read.size();
+
+            uint32_t hold{0};
+            if (!matches)
+            {
+                ++mMismatches;
+                record.result = I2C_Result::I2C_ERROR;
+            }
+            else
+            {
+                step->done = true;
+                hold = step->hold;
+
+                if (step->acknowledged)
+                    std::copy(step->response.begin(), step->response.end(), transaction.read.begin());
+                else
+                    record.result = I2C_Result::I2C_ERROR;
+            }
+
+            if (mRealTime)
+                std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(record.wire + hold));
+
+            mLog.push_back(record);
+            return record.result;
+        }
+
+        // Microseconds of one bit on wire
+        double mBitTime;
+
+        // Microseconds of one tick
+        double mTickTime;
+
+        // Transfers hold calling task
+        bool mRealTime;
+
+        std::vector<Step> mScript;
+        size_t mMismatches;
+
+        std::vector<Record> mLog;
+
+        // Transfers which reached bus
+        std::atomic<size_t> mStarted;
+    };
+} // namespace Fake
+
+#endif // FAKE_I2C_BUS_H
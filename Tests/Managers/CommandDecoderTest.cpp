@@ -0,0 +1,213 @@
+/* Code under test */
+#include "CommandDecoder.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <string>
+#include <vector>
+
+using namespace Greenhouse::Manager;
+
+namespace
+{
+    // Bulk message with commands for both targets, ignored members and invalid commands
+    const std::string BULK = "[{\"target\":\"window\",\"requested\":true},"
+                             " {\"requested\":0, \"target\":\"irrigation\", \"note\":{\"target\":\"window\",\"requested\":[1]}},"
+                             " {\"target\":\"door\",\"requested\":true},"
+                             " {\"target\":\"window\"},"
+                             " {\"target\":\"irrigation\",\"requested\":1.5},"
+                             " {\"requested\":false}]";
+
+    /**
+     * @brief Decoder which records emitted commands
+     */
+    class CommandDecoderTest : public ::testing::Test
+    {
+    protected:
+        CommandDecoderTest() : mDecoder(&CommandDecoderTest::OnCommand, this) {}
+
+        static void OnCommand(const Command &command, void *context)
+        {
+            static_cast<CommandDecoderTest *>(context)->mCommands.push_back(command);
+        }
+
+        /**
+         * @brief Decode message split into fragments at given positions
+         *
+         * @return bool     : True when every fragment was accepted
+         */
+        bool Decode(CommandTarget target, const std::string &message, const std::vector<size_t> &splits)
+        {
+            mCommands.clear();
+            mDecoder.Begin(target, message.size());
+
+            bool accepted = true;
+            size_t begin = 0;
+            for (const auto split : splits)
+            {
+                accepted &= mDecoder.Feed(message.data() + begin, split - begin, begin);
+                begin = split;
+            }
+
+            accepted &= mDecoder.Feed(message.data() + begin, message.size() - begin, begin);
+            EXPECT_FALSE(mDecoder.IsActive());
+            return accepted;
+        }
+
+        /**
+         * @brief Commands as text, so failures show whole sequence
+         */
+        std::string Commands() const
+        {
+            static const char *const targets[] = {"none", "window", "irrigation"};
+
+            std::string text;
+            for (const auto &command : mCommands)
+                text += std::string(targets[static_cast<int>(command.target)]) + (command.requested ? "=on " : "=off ");
+
+            return text;
+        }
+
+        CommandDecoder mDecoder;
+        std::vector<Command> mCommands;
+    };
+} // namespace
+
+TEST_F(CommandDecoderTest, SingleObjectUsesTargetOfTopic)
+{
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_WINDOW, "{\"requested\": true}", {}));
+    EXPECT_EQ(Commands(), "window=on ");
+
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_IRRIGATION, "{\"requested\": 0}", {}));
+    EXPECT_EQ(Commands(), "irrigation=off ");
+
+    // Target key overrides target of topic
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_WINDOW, "{\"target\":\"irrigation\",\"requested\":true}", {}));
+    EXPECT_EQ(Commands(), "irrigation=on ");
+
+    // Commands topic has no target
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_NONE, "{\"requested\": true}", {}));
+    EXPECT_EQ(Commands(), "");
+    EXPECT_EQ(mDecoder.GetCommandCount(), 0u);
+}
+
+TEST_F(CommandDecoderTest, BulkArrayEmitsEveryValidCommandInOrder)
+{
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_NONE, BULK, {}));
+    EXPECT_EQ(Commands(), "window=on irrigation=off irrigation=on ");
+    EXPECT_EQ(mDecoder.GetCommandCount(), 3u);
+
+    // Commands without target take target of topic
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_WINDOW, BULK, {}));
+    EXPECT_EQ(Commands(), "window=on irrigation=off irrigation=on window=off ");
+}
+
+TEST_F(CommandDecoderTest, MessageSplitAtEveryPositionGivesTheSameCommands)
+{
+    const std::string single = "{\"target\":\"window\",\"requested\":false}";
+
+    for (const auto &message : {single, BULK})
+    {
+        ASSERT_TRUE(Decode(CommandTarget::TARGET_IRRIGATION, message, {}));
+        const auto expected = Commands();
+        ASSERT_FALSE(expected.empty());
+
+        // Empty first fragment as well, the last fragment always ends message
+        for (size_t split = 0; split < message.size(); ++split)
+        {
+            ASSERT_TRUE(Decode(CommandTarget::TARGET_IRRIGATION, message, {split})) << "split at " << split;
+            EXPECT_EQ(Commands(), expected) << "split at " << split;
+        }
+
+        // Three fragments, the middle one of every length
+        for (size_t begin = 1; begin < message.size(); begin += 7)
+        {
+            for (size_t end = begin; end < message.size(); ++end)
+            {
+                ASSERT_TRUE(Decode(CommandTarget::TARGET_IRRIGATION, message, {begin, end})) << begin << ".." << end;
+                EXPECT_EQ(Commands(), expected) << begin << ".." << end;
+            }
+        }
+    }
+}
+
+TEST_F(CommandDecoderTest, FragmentOutOfOrderCancelsMessage)
+{
+    const std::string message = "[{\"target\":\"window\",\"requested\":true},{\"target\":\"irrigation\",\"requested\":true}]";
+    const size_t half = message.size() / 2;
+
+    // Gap after the first fragment
+    mCommands.clear();
+    mDecoder.Begin(CommandTarget::TARGET_NONE, message.size());
+    ASSERT_TRUE(mDecoder.Feed(message.data(), half, 0));
+    EXPECT_FALSE(mDecoder.Feed(message.data() + half + 1, message.size() - half - 1, half + 1));
+    EXPECT_FALSE(mDecoder.IsActive());
+
+    // Rest of message is not decoded once message was cancelled
+    EXPECT_FALSE(mDecoder.Feed(message.data() + half, message.size() - half, half));
+    EXPECT_EQ(Commands(), "window=on ");
+
+    // Repeated fragment
+    mDecoder.Begin(CommandTarget::TARGET_NONE, message.size());
+    ASSERT_TRUE(mDecoder.Feed(message.data(), half, 0));
+    EXPECT_FALSE(mDecoder.Feed(message.data(), half, 0));
+    EXPECT_FALSE(mDecoder.IsActive());
+
+    // Fragment beyond total length of message
+    mCommands.clear();
+    mDecoder.Begin(CommandTarget::TARGET_NONE, half);
+    EXPECT_FALSE(mDecoder.Feed(message.data(), half + 1, 0));
+    EXPECT_FALSE(mDecoder.IsActive());
+    EXPECT_EQ(Commands(), "");
+
+    // Fragment without message
+    EXPECT_FALSE(mDecoder.Feed(message.data(), message.size(), 0));
+}
+
+TEST_F(CommandDecoderTest, BeginDiscardsUnfinishedMessage)
+{
+    const std::string first = "[{\"target\":\"window\",\"requested\":true},{\"target\":\"window\",\"requested\":false}]";
+    const std::string second = "{\"requested\":true}";
+    const size_t cut = first.find("},") + 2;
+
+    mCommands.clear();
+    mDecoder.Begin(CommandTarget::TARGET_NONE, first.size());
+    ASSERT_TRUE(mDecoder.Feed(first.data(), cut, 0));
+    EXPECT_EQ(Commands(), "window=on ");
+
+    // New message starts while the first one is active, parser state of the first one is dropped
+    mDecoder.Begin(CommandTarget::TARGET_IRRIGATION, second.size());
+    EXPECT_EQ(mDecoder.GetCommandCount(), 0u);
+    ASSERT_TRUE(mDecoder.Feed(second.data(), second.size(), 0));
+    EXPECT_FALSE(mDecoder.IsActive());
+    EXPECT_EQ(Commands(), "window=on irrigation=on ");
+
+    // Late rest of the first message is rejected
+    EXPECT_FALSE(mDecoder.Feed(first.data() + cut, first.size() - cut, cut));
+    EXPECT_EQ(Commands(), "window=on irrigation=on ");
+}
+
+TEST_F(CommandDecoderTest, ZeroLengthMessageIsRejected)
+{
+    mCommands.clear();
+    mDecoder.Begin(CommandTarget::TARGET_WINDOW, 0);
+    EXPECT_TRUE(mDecoder.IsActive());
+
+    EXPECT_FALSE(mDecoder.Feed("", 0, 0));
+    EXPECT_FALSE(mDecoder.IsActive());
+    EXPECT_EQ(Commands(), "");
+
+    // Decoder is ready for next message
+    ASSERT_TRUE(Decode(CommandTarget::TARGET_WINDOW, "{\"requested\":1}", {}));
+    EXPECT_EQ(Commands(), "window=on ");
+}
+
+TEST_F(CommandDecoderTest, InvalidMessageKeepsCommandsDecodedBeforeError)
+{
+    const std::string message = "[{\"target\":\"window\",\"requested\":true}, {\"requested\":tru}]";
+
+    EXPECT_FALSE(Decode(CommandTarget::TARGET_IRRIGATION, message, {}));
+    EXPECT_EQ(Commands(), "window=on ");
+}
@@ -0,0 +1,260 @@
+/* Code under test */
+#include "ComponentController.hpp"
+#include "EventManager.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* Host stubs */
+#include "HostPeripherals.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace Greenhouse::Manager;
+using Component::Publisher::Events;
+using Component::Publisher::WaterLevelEventData;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    constexpr auto PUMP = static_cast<gpio_num_t>(CONFIG_WATER_PUMP);
+
+    // Raw values of pad in water and on air
+    constexpr uint8_t COVERED_PAD = 0xF0;
+    constexpr uint8_t DRY_PAD = 0x05;
+
+    /**
+     * @brief Smallest number of covered pads whose level reaches given percentage
+     */
+    constexpr int Pads(int percentage) { return (percentage * WATER_LEVEL_SECTIONS + 99) / 100; }
+
+    // Lowest level which allows irrigation, the highest one below threshold and one inside hysteresis band
+    constexpr int REFILLED = Pads(CONFIG_WATER_LEVEL_THRESHOLD + CONFIG_WATER_LEVEL_HYSTERESIS);
+    constexpr int DRAINED = Pads(CONFIG_WATER_LEVEL_THRESHOLD) - 1;
+    constexpr int IN_HYSTERESIS = Pads(CONFIG_WATER_LEVEL_THRESHOLD);
+
+    static_assert(DRAINED >= 0 && IN_HYSTERESIS < REFILLED, "Levels of test need threshold above zero and hysteresis of one pad");
+
+    constexpr std::chrono::milliseconds PERIOD(CONFIG_WATER_LEVEL_PERIOD_MS);
+
+    // Monitor sleeps in whole ticks
+    constexpr std::chrono::milliseconds TICK(portTICK_PERIOD_MS);
+
+    // Wake up and scheduling of host threads, not part of latency on target
+    constexpr std::chrono::milliseconds HOST_SCHEDULING(10);
+
+    // Drop right after sample is seen by the next one, its reading and interlock take less than a tick
+    constexpr auto INTERLOCK_BOUND = PERIOD + TICK + HOST_SCHEDULING;
+
+    // Silent sensor is taken as low tank after consecutive failures
+    constexpr auto SILENT_BOUND = WATER_LEVEL_MAX_FAILURES * PERIOD + TICK + HOST_SCHEDULING;
+
+    static_assert(INTERLOCK_BOUND < std::chrono::milliseconds(100) && SILENT_BOUND < std::chrono::milliseconds(100),
+                  "Pump must be stopped within 100 ms");
+
+    // Drops of level at random phase of monitor
+    constexpr size_t DROPS = 50;
+
+    // Pause between attempts of irrigation
+    constexpr std::chrono::microseconds IRRIGATION_RETRY(200);
+
+    /* Tank and pump seen by test */
+    struct Greenhouse
+    {
+        // Covered pads of tank
+        std::atomic<int> pads{REFILLED};
+        // Sensor does not respond
+        std::atomic<bool> silent{false};
+        // Time of the last switching of pump on and off
+        std::atomic<Clock::rep> pumpOn{0};
+        std::atomic<Clock::rep> pumpOff{0};
+        // Events of low tank and those seen with running pump
+        std::atomic<size_t> lowEvents{0};
+        std::atomic<size_t> lowEventsWithPump{0};
+    } greenhouse;
+
+    esp_err_t WaterLevelSensor(uint8_t address, const uint8_t *, size_t, uint8_t *read, size_t readSize)
+    {
+        if (greenhouse.silent)
+            return ESP_FAIL;
+
+        // Lower section answers on sensor address, upper section on the next one
+        size_t first;
+        if (address == CONFIG_WATER_LEVEL_ADDRESS && readSize == WATER_LEVEL_LOW_SECTIONS)
+            first = 0;
+        else if (address == CONFIG_WATER_LEVEL_ADDRESS + 1 && readSize == WATER_LEVEL_HIGH_SECTIONS)
+            first = WATER_LEVEL_LOW_SECTIONS;
+        else
+            return ESP_FAIL;
+
+        const int pads = greenhouse.pads;
+        for (size_t i = 0; i < readSize; ++i)
+            read[i] = static_cast<int>(first + i) < pads ? COVERED_PAD : DRY_PAD;
+
+        return ESP_OK;
+    }
+
+    void OnGpio(gpio_num_t gpio, uint32_t level)
+    {
+        if (gpio == PUMP)
+            (level ? greenhouse.pumpOn : greenhouse.pumpOff) = Clock::now().time_since_epoch().count();
+    }
+
+    void OnWaterLevel(WaterLevelEventData &data, void *)
+    {
+        if (!data.low)
+            return;
+
+        ++greenhouse.lowEvents;
+        if (gpio_get_level(PUMP))
+            ++greenhouse.lowEventsWithPump;
+    }
+
+    Clock::time_point At(Clock::rep time) { return Clock::time_point(Clock::duration(time)); }
+
+    /**
+     * @brief Wait until condition holds
+     */
+    bool WaitFor(const std::function<bool()> &condition, std::chrono::milliseconds timeout = std::chrono::milliseconds(1000))
+    {
+        const auto deadline = Clock::now() + timeout;
+        while (!condition())
+        {
+            if (Clock::now() > deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Controller with water level sensor on host I2C, tank is refilled before every test
+     */
+    class ComponentControllerTest : public ::testing::Test
+    {
+    protected:
+        static void SetUpTestCase()
+        {
+            // Sensor and pump are connected before controller starts monitor
+            Host::SetI2CDevice(&WaterLevelSensor);
+            Host::SetGpioObserver(&OnGpio);
+            ASSERT_TRUE(EventManager::GetInstance()->Subscribe<Events::WATER_LEVEL_CHANGED>(&OnWaterLevel, nullptr));
+        }
+
+        void SetUp() override
+        {
+            mController = ComponentController::GetInstance();
+
+            greenhouse.silent = false;
+            greenhouse.pads = REFILLED;
+            ASSERT_TRUE(WaitFor([this] { return !mController->IsWaterLevelLow(); }));
+        }
+
+        void TearDown() override { mController->TurnOffIrrigation(); }
+
+        ComponentController *mController;
+    };
+} // namespace
+
+TEST_F(ComponentControllerTest, InterlockStopsPumpWhileIrrigationIsTurnedOn)
+{
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> phase(0, std::chrono::duration_cast<std::chrono::microseconds>(PERIOD).count());
+
+    std::vector<double> latencies;
+    const size_t lowEvents = greenhouse.lowEvents;
+
+    for (size_t drop = 0; drop < DROPS; ++drop)
+    {
+        greenhouse.pads = REFILLED;
+        ASSERT_TRUE(WaitFor([this] { return !mController->IsWaterLevelLow(); })) << "drop " << drop;
+
+        // Irrigation is turned on again and again while level drops
+        std::atomic<bool> irrigating{true};
+        std::thread irrigation([&] {
+            while (irrigating)
+            {
+                mController->TurnOnIrrigation();
+                std::this_thread::sleep_for(IRRIGATION_RETRY);
+            }
+        });
+
+        ASSERT_TRUE(WaitFor([] { return gpio_get_level(PUMP) == 1; })) << "drop " << drop;
+        std::this_thread::sleep_for(std::chrono::microseconds(phase(generator)));
+
+        const auto dropped = Clock::now();
+        greenhouse.pads = DRAINED;
+        EXPECT_TRUE(WaitFor([this] { return mController->IsWaterLevelLow() && gpio_get_level(PUMP) == 0; })) << "drop " << drop;
+
+        // Pump stays off while irrigation is still requested
+        std::this_thread::sleep_for(PERIOD);
+        irrigating = false;
+        irrigation.join();
+
+        EXPECT_EQ(gpio_get_level(PUMP), 0) << "drop " << drop;
+        EXPECT_FALSE(mController->IsIrrigationTurnOn()) << "drop " << drop;
+        EXPECT_LT(At(greenhouse.pumpOn), At(greenhouse.pumpOff)) << "drop " << drop;
+
+        latencies.push_back(Milliseconds(At(greenhouse.pumpOff) - dropped).count());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    std::printf("[ INTERLOCK] period %d ms, %zu drops, median %.2f ms, worst %.2f ms, bound %.2f ms\n", CONFIG_WATER_LEVEL_PERIOD_MS, DROPS,
+                latencies[latencies.size() / 2], latencies.back(), Milliseconds(INTERLOCK_BOUND).count());
+
+    EXPECT_LE(latencies.back(), Milliseconds(INTERLOCK_BOUND).count());
+    EXPECT_FALSE(mController->TurnOnIrrigation());
+
+    // Event of low tank is published after pump is stopped
+    EXPECT_TRUE(WaitFor([&] { return greenhouse.lowEvents == lowEvents + DROPS; }));
+    EXPECT_EQ(greenhouse.lowEventsWithPump, 0u);
+}
+
+TEST_F(ComponentControllerTest, RefillInsideHysteresisKeepsPumpOff)
+{
+    greenhouse.pads = DRAINED;
+    ASSERT_TRUE(WaitFor([this] { return mController->IsWaterLevelLow(); }));
+
+    // Level above threshold but below hysteresis band does not allow irrigation
+    greenhouse.pads = IN_HYSTERESIS;
+    std::this_thread::sleep_for(3 * PERIOD);
+    EXPECT_TRUE(mController->IsWaterLevelLow());
+    EXPECT_FALSE(mController->TurnOnIrrigation());
+    EXPECT_EQ(gpio_get_level(PUMP), 0);
+
+    const auto refilled = Clock::now();
+    greenhouse.pads = REFILLED;
+    ASSERT_TRUE(WaitFor([this] { return !mController->IsWaterLevelLow(); }));
+    EXPECT_LE(Milliseconds(Clock::now() - refilled).count(), Milliseconds(INTERLOCK_BOUND).count());
+
+    EXPECT_TRUE(mController->TurnOnIrrigation());
+    EXPECT_EQ(gpio_get_level(PUMP), 1);
+}
+
+TEST_F(ComponentControllerTest, SilentSensorStopsPump)
+{
+    ASSERT_TRUE(mController->TurnOnIrrigation());
+    ASSERT_EQ(gpio_get_level(PUMP), 1);
+
+    const auto silenced = Clock::now();
+    greenhouse.silent = true;
+    ASSERT_TRUE(WaitFor([] { return gpio_get_level(PUMP) == 0; }));
+
+    // Single failed reading does not stop pump
+    const auto latency = At(greenhouse.pumpOff) - silenced;
+    EXPECT_GE(Milliseconds(latency).count(), Milliseconds((WATER_LEVEL_MAX_FAILURES - 1) * PERIOD).count());
+    EXPECT_LE(Milliseconds(latency).count(), Milliseconds(SILENT_BOUND).count());
+    EXPECT_FALSE(mController->TurnOnIrrigation());
+}
@@ -0,0 +1,335 @@
+/* Code under test */
+#include "EventManager.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* Common components */
+#include "Utility/Concurrency/MPMCQueue.hpp"
+#include "Utility/Memory/ObjectPool.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Greenhouse::Manager;
+using Component::Publisher::Events;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Events published one by one to measure latency
+    constexpr size_t LATENCY_EVENTS = 2000;
+
+    // Events published in burst to measure throughput
+    constexpr size_t THROUGHPUT_EVENTS = 20000;
+
+    /* Observer of bluetooth data, the last one of dispatch measures latency */
+    struct Observer
+    {
+        // Events seen by observer
+        size_t calls;
+        // Observer is called as the last one
+        bool last;
+    };
+
+    // Time of the last publish
+    std::atomic<Clock::rep> published{0};
+
+    // Events seen by all observers
+    std::atomic<size_t> dispatched{0};
+
+    // Latency of events from publish until the last observer, written by dispatcher only
+    std::vector<double> latencies;
+
+    /**
+     * @brief Observer callback, leaves payload to be released after dispatch
+     */
+    void OnData(EventDataPool::Handle &data, void *context)
+    {
+        auto observer = static_cast<Observer *>(context);
+        Benchmark::DoNotOptimize(data->GetClientID());
+        ++observer->calls;
+
+        if (!observer->last)
+            return;
+
+        const Clock::time_point start(Clock::duration(published.load()));
+        latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        ++dispatched;
+    }
+
+    /**
+     * @brief Publish event, retry while pool or queue is full
+     */
+    void Publish(uint8_t clientID)
+    {
+        while (true)
+        {
+            auto data = EventDataPool::GetInstance()->AcquireHandle(clientID, 0);
+            if (data)
+            {
+                published = Clock::now().time_since_epoch().count();
+                if (EventManager::GetInstance()->Notify<Events::BLUETOOTH_DATA_RECEIVED>(std::move(data)))
+                    return;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Wait until observers saw given number of events
+     */
+    void WaitForDispatch(size_t events)
+    {
+        while (dispatched < events)
+            std::this_thread::yield();
+
+        // Payload of the last event is released after its observers return
+        while (EventDataPool::GetInstance()->InUse())
+            std::this_thread::yield();
+    }
+
+    /**
+     * @brief Get percentile of sorted samples
+     */
+    double Percentile(const std::vector<double> &sorted, double percentile)
+    {
+        return sorted[static_cast<size_t>(percentile * (sorted.size() - 1))];
+    }
+
+    // Events published and dispatched on the test thread to measure cost of one event
+    constexpr size_t COST_EVENTS = 200000;
+
+    // Alias for bluetooth data channel
+    using DataChannel = Component::Publisher::Channel<Events::BLUETOOTH_DATA_RECEIVED>;
+
+    /* Event data of previous event manager, observers downcast it from base class */
+    struct LegacyEventData
+    {
+        virtual ~LegacyEventData() {}
+    };
+
+    struct LegacyBluetoothData : LegacyEventData
+    {
+        LegacyBluetoothData(uint8_t clientID, uint8_t position) : data(clientID, position) {}
+
+        Component::Publisher::ClientBluetoothEventData_Greenhouse data;
+    };
+
+    // Alias for pool of previous event data
+    using LegacyPool = Utility::Memory::ObjectPool<LegacyBluetoothData, CONFIG_BLUETOOTH_EVENT_POOL_SIZE>;
+
+    /* Observer of previous event manager, called through virtual method */
+    class LegacyObserver
+    {
+    public:
+        virtual ~LegacyObserver() {}
+
+        virtual void Update(LegacyEventData *eventData) = 0;
+    };
+
+    /* Observer which reads client ID, the last one of dispatch releases event data like worker did */
+    class LegacyDataObserver : public LegacyObserver
+    {
+    public:
+        LegacyDataObserver(LegacyPool *pool, bool last) : mPool(pool), mLast(last) {}
+
+        void Update(LegacyEventData *eventData) override
+        {
+            auto data = static_cast<LegacyBluetoothData *>(eventData);
+            Benchmark::DoNotOptimize(data->data.GetClientID());
+
+            if (mLast)
+                mPool->Release(data);
+        }
+
+    private:
+        LegacyPool *mPool;
+        bool mLast;
+    };
+
+    /**
+     * Channel of previous event manager: queue of base class pointers, observer list of interface pointers
+     * and event looked up at run time. Copy-on-write of observer list is left out, it is not on event path
+     */
+    class LegacyChannels
+    {
+    public:
+        LegacyChannels()
+        {
+            for (auto &channel : mChannels)
+            {
+                channel.count = 0;
+                channel.readers.store(0);
+            }
+        }
+
+        void Subscribe(Events event, LegacyObserver *observer)
+        {
+            auto &channel = mChannels[static_cast<size_t>(event)];
+            channel.observers[channel.count++] = observer;
+        }
+
+        bool Notify(Events event, LegacyEventData *eventData)
+        {
+            const auto index = static_cast<size_t>(event);
+            if (index >= mChannels.size() || !mChannels[index].count)
+                return false;
+
+            return mChannels[index].queue.TryPush(std::move(eventData));
+        }
+
+        bool DispatchNext()
+        {
+            for (auto &channel : mChannels)
+            {
+                LegacyEventData *eventData{nullptr};
+                if (!channel.queue.TryPop(eventData))
+                    continue;
+
+                ++channel.readers;
+                for (size_t i = 0; i < channel.count; ++i)
+                    channel.observers[i]->Update(eventData);
+                --channel.readers;
+
+                return true;
+            }
+
+            return false;
+        }
+
+    private:
+        struct Channel
+        {
+            Utility::Concurrency::MPMCQueue<LegacyEventData *, CONFIG_EVENT_QUEUE_DEPTH> queue;
+            std::array<LegacyObserver *, CONFIG_EVENT_MAX_OBSERVERS> observers;
+            size_t count;
+            std::atomic<uint32_t> readers;
+        };
+
+        std::array<Channel, static_cast<size_t>(Events::WATER_LEVEL_CHANGED) + 1> mChannels;
+    };
+
+    /**
+     * @brief Typed channel callback
+     */
+    void OnTypedData(EventDataPool::Handle &data, void *)
+    {
+        Benchmark::DoNotOptimize(data->GetClientID());
+    }
+} // namespace
+
+TEST(EventManagerBenchmark, DispatchLatencyAndThroughputAgainstObservers)
+{
+    static_assert(CONFIG_EVENT_MAX_OBSERVERS == 64, "Benchmark subscribes up to 64 observers");
+
+    const size_t counts[] = {1, 2, 4, 8, 16, 32, 64};
+    std::array<Observer, CONFIG_EVENT_MAX_OBSERVERS> observers;
+    auto manager = EventManager::GetInstance();
+
+    std::printf("[ BENCHMARK] queue depth %d, event pool %d\n", CONFIG_EVENT_QUEUE_DEPTH, CONFIG_BLUETOOTH_EVENT_POOL_SIZE);
+    std::printf("[ BENCHMARK] %9s %12s %12s %12s %14s %14s\n", "observers", "median us", "p99 us", "max us", "events/s",
+                "calls/s");
+
+    for (const auto count : counts)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            observers[i] = {0, i == count - 1};
+            ASSERT_TRUE(manager->Subscribe<Events::BLUETOOTH_DATA_RECEIVED>(&OnData, &observers[i]));
+        }
+
+        // Latency, next event is published after the previous one was dispatched
+        dispatched = 0;
+        latencies.clear();
+        latencies.reserve(LATENCY_EVENTS);
+        for (size_t i = 0; i < LATENCY_EVENTS; ++i)
+        {
+            Publish(static_cast<uint8_t>(i));
+            WaitForDispatch(i + 1);
+        }
+
+        std::vector<double> sorted(latencies);
+        std::sort(sorted.begin(), sorted.end());
+
+        // Throughput, producer keeps queue full
+        dispatched = 0;
+        latencies.clear();
+        latencies.reserve(THROUGHPUT_EVENTS);
+        const auto start = Clock::now();
+        for (size_t i = 0; i < THROUGHPUT_EVENTS; ++i)
+            Publish(static_cast<uint8_t>(i));
+        WaitForDispatch(THROUGHPUT_EVENTS);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::printf("[ BENCHMARK] %9zu %12.2f %12.2f %12.2f %14.0f %14.0f\n", count, Percentile(sorted, 0.5), Percentile(sorted, 0.99),
+                    sorted.back(), THROUGHPUT_EVENTS / seconds, THROUGHPUT_EVENTS * count / seconds);
+
+        // Every observer saw every event once and nothing was dropped
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(observers[i].calls, LATENCY_EVENTS + THROUGHPUT_EVENTS) << "observer " << i;
+            manager->Unsubscribe<Events::BLUETOOTH_DATA_RECEIVED>(&OnData, &observers[i]);
+        }
+
+        EXPECT_EQ(manager->GetDroppedEvents<Events::BLUETOOTH_DATA_RECEIVED>(), 0u);
+    }
+}
+
+TEST(EventManagerBenchmark, PerEventCostOfTypedChannelAgainstEventDataPointer)
+{
+    const size_t counts[] = {1, 4, 16};
+
+    // Channels are large, they are kept off the stack
+    auto pool = EventDataPool::GetInstance();
+    std::unique_ptr<LegacyPool> legacyPool(new LegacyPool());
+
+    std::printf("[ BENCHMARK] acquire, publish, dispatch and release of one event on one thread\n");
+    std::printf("[ BENCHMARK] %9s %16s %16s\n", "observers", "EventData* ns", "typed ns");
+
+    for (const auto count : counts)
+    {
+        std::unique_ptr<DataChannel> typed(new DataChannel());
+        std::unique_ptr<LegacyChannels> legacy(new LegacyChannels());
+
+        std::vector<std::unique_ptr<LegacyDataObserver>> legacyObservers;
+        std::vector<int> contexts(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            legacyObservers.emplace_back(new LegacyDataObserver(legacyPool.get(), i == count - 1));
+            legacy->Subscribe(Events::BLUETOOTH_DATA_RECEIVED, legacyObservers.back().get());
+            ASSERT_TRUE(typed->Subscribe(&OnTypedData, &contexts[i]));
+        }
+
+        size_t legacyDispatched = 0;
+        const double legacyCost = Benchmark::NanosecondsPerCall(COST_EVENTS, [&](size_t i) {
+            auto eventData = legacyPool->Acquire(static_cast<uint8_t>(i), 0);
+            if (!legacy->Notify(Events::BLUETOOTH_DATA_RECEIVED, eventData))
+                legacyPool->Release(eventData);
+            legacyDispatched += legacy->DispatchNext();
+        });
+
+        size_t typedDispatched = 0;
+        const double typedCost = Benchmark::NanosecondsPerCall(COST_EVENTS, [&](size_t i) {
+            typed->Publish(pool->AcquireHandle(static_cast<uint8_t>(i), 0));
+            typedDispatched += typed->DispatchOne();
+        });
+
+        std::printf("[ BENCHMARK] %9zu %16.1f %16.1f\n", count, legacyCost, typedCost);
+
+        // Both paths dispatched every event and returned its data
+        EXPECT_EQ(legacyDispatched, COST_EVENTS);
+        EXPECT_EQ(typedDispatched, COST_EVENTS);
+        EXPECT_EQ(legacyPool->InUse(), 0u);
+        EXPECT_EQ(pool->InUse(), 0u);
+    }
+}
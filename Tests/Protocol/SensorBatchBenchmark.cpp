@@ -0,0 +1,98 @@
+/* Code under test */
+#include "Common_components/Protocol/SensorFrame.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/AirTime.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+using namespace Component::Protocol;
+using namespace Benchmark;
+
+namespace
+{
+    // Client measuring temperature, humidity and soil moisture
+    constexpr uint8_t CONTENT = ContentBit<TemperatureField>() | ContentBit<HumidityField>() | ContentBit<SoilMoistureField>();
+
+    using ClientFrame = SensorFrame<GreenhouseRegistry::Subset<CONTENT>::Schema>;
+
+    /* Cost of one characteristic write */
+    struct WriteCost
+    {
+        // Samples in write
+        size_t samples;
+        // Size of frame
+        size_t frame;
+        // Bytes on air of write and its response
+        size_t air;
+    };
+
+    /**
+     * @brief Pack up to count samples into one write limited by MTU and decode it back as server does
+     */
+    WriteCost PackWrite(size_t mtu, size_t count)
+    {
+        std::vector<uint8_t> buffer(mtu - ATT_WRITE_HEADER);
+        ClientFrame::Encoder encoder({SENSOR_FRAME_VERSION, 1, 1}, Utility::DataType::Span<uint8_t>(buffer.data(), buffer.size()));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const SensorSample sample = {static_cast<uint16_t>(count - i), CONTENT, 21.5f + i, 60.0f - i, 0.0f, 45.0f + i};
+            if (encoder.Append(sample) != FrameResult::FRAME_OK)
+                break;
+        }
+
+        // Server unpacks whole batch from one write
+        std::array<SensorSample, SENSOR_FRAME_MAX_SAMPLES> samples;
+        size_t decoded{0};
+        EXPECT_EQ(ClientFrame::DecodeSamples(ByteView(buffer.data(), encoder.Size()), Utility::DataType::Span<SensorSample>(samples.data(), samples.size()), decoded),
+                  FrameResult::FRAME_OK);
+        EXPECT_EQ(decoded, encoder.Count());
+
+        return {encoder.Count(), encoder.Size(), WriteBytesOnAir(encoder.Size())};
+    }
+} // namespace
+
+TEST(SensorBatchBenchmark, PayloadEfficiencyAgainstSamplesPerWrite)
+{
+    const size_t fieldBytes = ClientFrame::SampleSize(CONTENT) - SampleLayout::SIZE;
+    const size_t mtus[] = {DEFAULT_MTU, NEGOTIATED_MTU, 247, 512};
+
+    for (const auto mtu : mtus)
+    {
+        const size_t capacity = std::min<size_t>((mtu - ATT_WRITE_HEADER - HeaderLayout::SIZE) / ClientFrame::SampleSize(CONTENT),
+                                                 SENSOR_FRAME_MAX_SAMPLES);
+
+        std::printf("[ BENCHMARK] MTU %zu, %zu samples fit into one write\n", mtu, capacity);
+        std::printf("[ BENCHMARK] %8s %8s %10s %12s %12s\n", "samples", "frame", "air bytes", "efficiency", "writes/100");
+
+        double previous{0.0};
+        for (size_t count = 1; count <= capacity; ++count)
+        {
+            const auto cost = PackWrite(mtu, count);
+            ASSERT_EQ(cost.samples, count);
+
+            // Reading bytes carried per byte on air
+            const double efficiency = static_cast<double>(count * fieldBytes) / cost.air;
+            EXPECT_GT(efficiency, previous);
+            previous = efficiency;
+
+            if (count == 1 || count == 2 || count == 4 || count == 8 || count == 16 || count == capacity)
+                std::printf("[ BENCHMARK] %8zu %8zu %10zu %11.1f%% %12.1f\n", count, cost.frame, cost.air, efficiency * 100,
+                            100.0 / count);
+        }
+
+        // Sample which does not fit stays queued for the next write
+        EXPECT_EQ(PackWrite(mtu, capacity + 1).samples, capacity);
+    }
+
+    // Negotiated MTU of deployment, 19 samples of three fields in 174 bytes
+    const auto cost = PackWrite(NEGOTIATED_MTU, SENSOR_FRAME_MAX_SAMPLES);
+    EXPECT_EQ(cost.samples, 19u);
+    EXPECT_EQ(cost.frame, 174u);
+}
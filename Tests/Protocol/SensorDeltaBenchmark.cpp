@@ -0,0 +1,216 @@
+/* Code under test */
+#include "Common_components/Protocol/SensorDelta.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/AirTime.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Component::Protocol;
+using namespace Benchmark;
+
+namespace
+{
+    // Defaults of client Kconfig: measurement period, samples per upload and keyframe interval
+    constexpr int MEASUREMENT_PERIOD = 150;
+    constexpr size_t SAMPLES_PER_UPLOAD = 4;
+    constexpr uint16_t KEYFRAME_INTERVAL = 10;
+
+    // Content of sample with all fields
+    constexpr uint8_t ALL_FIELDS = GreenhouseSchema::MASK;
+
+    // Default deadbands of client Kconfig
+    const SensorSample DEADBAND = {0, ALL_FIELDS, 0.1f, 0.5f, 20.0f, 1.0f};
+
+    // One week of measurements
+    constexpr size_t SAMPLES = 7 * 24 * 3600 / MEASUREMENT_PERIOD;
+
+    // Share of frames whose write fails
+    constexpr double LOSS = 0.05;
+
+    // Error of float arithmetic in deadbands of field
+    constexpr float FLOAT_ERROR = 1e-3f;
+
+    constexpr double PI = 3.14159265358979323846;
+
+    /**
+     * @brief Greenhouse trace replayed by benchmark. Daily cycle of air, irrigation of soil and noise
+     *        of sensors with repeatability given by their datasheets
+     */
+    struct Trace
+    {
+        const char *name;
+        // Amplitude of daily temperature swing
+        float temperatureSwing;
+        // Standard deviation of sensor noise of every field
+        SensorSample noise;
+        // Soil moisture lost per hour between irrigations
+        float soilDrying;
+    };
+
+    /**
+     * @brief Generate trace of given kind, the same seed gives the same trace
+     */
+    std::vector<SensorSample> Generate(const Trace &trace, unsigned seed)
+    {
+        std::mt19937 generator(seed);
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+
+        std::vector<SensorSample> samples;
+        samples.reserve(SAMPLES);
+
+        float soil = 60.0f;
+        for (size_t i = 0; i < SAMPLES; ++i)
+        {
+            const double day = i * MEASUREMENT_PERIOD / 86400.0;
+            const float sun = static_cast<float>(std::sin(2 * PI * (day - 0.25)));
+
+            // Pump waters soil back when it dries out
+            soil -= trace.soilDrying * MEASUREMENT_PERIOD / 3600.0f;
+            if (soil < 35.0f)
+                soil = 60.0f;
+
+            SensorSample sample{};
+            sample.content = ALL_FIELDS;
+            sample.temperature = 20.0f + trace.temperatureSwing * sun + trace.noise.temperature * normal(generator);
+            sample.humidity = 65.0f - 15.0f * sun + trace.noise.humidity * normal(generator);
+            sample.co2 = 600.0f - 200.0f * sun + trace.noise.co2 * normal(generator);
+            sample.soilMoisture = soil + trace.noise.soilMoisture * normal(generator);
+            samples.push_back(sample);
+        }
+
+        return samples;
+    }
+
+    /* Result of replayed trace */
+    struct ReplayResult
+    {
+        // Frames sent
+        size_t frames;
+        // Bytes on air of all writes
+        size_t air;
+        // Samples rebuilt by server
+        size_t delivered;
+        // Largest error of rebuilt field against measured value, in deadbands of field
+        float maxError;
+    };
+
+    /**
+     * @brief Largest error of rebuilt sample in deadbands of its fields
+     */
+    float ErrorInDeadbands(const SensorSample &measured, const SensorSample &rebuilt)
+    {
+        // Quantization of field adds half of its resolution
+        const float errors[] = {(std::fabs(rebuilt.temperature - measured.temperature) - 0.005f) / DEADBAND.temperature,
+                                (std::fabs(rebuilt.humidity - measured.humidity) - 0.005f) / DEADBAND.humidity,
+                                (std::fabs(rebuilt.co2 - measured.co2) - 0.5f) / DEADBAND.co2,
+                                (std::fabs(rebuilt.soilMoisture - measured.soilMoisture) - 0.005f) / DEADBAND.soilMoisture};
+
+        float error{0.0f};
+        for (const auto value : errors)
+            error = std::max(error, value);
+
+        return error;
+    }
+
+    /**
+     * @brief Send trace from client to server as greenhouse client does
+     *
+     * @param[in] samples           : Measured samples
+     * @param[in] keyframeInterval  : Keyframe interval, zero sends full samples
+     */
+    ReplayResult Replay(const std::vector<SensorSample> &samples, uint16_t keyframeInterval)
+    {
+        DeltaEncoder<> encoder(DEADBAND, keyframeInterval);
+        DeltaStateCache<> cache;
+        std::mt19937 link(1);
+        std::bernoulli_distribution lost(LOSS);
+
+        ReplayResult result{0, 0, 0, 0.0f};
+        std::array<uint8_t, GreenhouseFrame::MAX_FRAME_SIZE> buffer;
+
+        for (size_t first = 0; first < samples.size(); first += SAMPLES_PER_UPLOAD)
+        {
+            EXPECT_TRUE(encoder.BeginFrame());
+            GreenhouseFrame::Encoder frame({SENSOR_FRAME_VERSION, 1, 1}, Utility::DataType::Span<uint8_t>(buffer.data(), NEGOTIATED_MTU - ATT_WRITE_HEADER));
+
+            const size_t count = std::min(SAMPLES_PER_UPLOAD, samples.size() - first);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const auto prepared = encoder.Prepare(samples[first + i]);
+                EXPECT_EQ(frame.Append(prepared), FrameResult::FRAME_OK);
+                encoder.Accept(prepared);
+            }
+
+            encoder.FrameSent();
+            ++result.frames;
+            result.air += WriteBytesOnAir(frame.Size());
+
+            // Lost write leaves server without frame and client restarts with keyframe
+            if (lost(link))
+            {
+                encoder.Acknowledge(false);
+                continue;
+            }
+
+            std::array<SensorSample, SENSOR_FRAME_MAX_SAMPLES> decoded;
+            size_t decodedCount{0};
+            EXPECT_EQ(GreenhouseFrame::DecodeSamples(ByteView(buffer.data(), frame.Size()), Utility::DataType::Span<SensorSample>(decoded.data(), decoded.size()), decodedCount),
+                      FrameResult::FRAME_OK);
+            EXPECT_EQ(decodedCount, count);
+
+            for (size_t i = 0; i < decodedCount; ++i)
+            {
+                EXPECT_EQ(cache.Apply(1, decoded[i]), FrameResult::FRAME_OK);
+                EXPECT_EQ(decoded[i].content, ALL_FIELDS);
+                result.maxError = std::max(result.maxError, ErrorInDeadbands(samples[first + i], decoded[i]));
+                ++result.delivered;
+            }
+
+            encoder.Acknowledge(true);
+        }
+
+        return result;
+    }
+} // namespace
+
+TEST(SensorDeltaBenchmark, BytesOnAirSavedOverTraces)
+{
+    const Trace traces[] = {
+        // Sensor noise well below deadbands
+        {"calm, datasheet noise", 6.0f, {0, 0, 0.04f, 0.08f, 5.0f, 0.2f}, 0.5f},
+        // Noise close to deadbands, deltas carry most fields
+        {"noisy sensors", 6.0f, {0, 0, 0.1f, 0.4f, 15.0f, 0.8f}, 0.5f},
+        // Sunny days with large swing and fast drying of soil
+        {"hot, fast drying", 12.0f, {0, 0, 0.04f, 0.08f, 5.0f, 0.2f}, 2.0f},
+    };
+
+    std::printf("[ BENCHMARK] %zu samples every %d s, %zu samples per frame, keyframe every %d frames, %.0f%% frames lost\n", SAMPLES,
+                MEASUREMENT_PERIOD, SAMPLES_PER_UPLOAD, KEYFRAME_INTERVAL, LOSS * 100);
+    std::printf("[ BENCHMARK] %-24s %12s %12s %8s %16s\n", "trace", "full bytes", "delta bytes", "saved", "error/deadband");
+
+    for (size_t i = 0; i < sizeof(traces) / sizeof(traces[0]); ++i)
+    {
+        const auto samples = Generate(traces[i], static_cast<unsigned>(i + 1));
+
+        const auto full = Replay(samples, 0);
+        const auto delta = Replay(samples, KEYFRAME_INTERVAL);
+
+        std::printf("[ BENCHMARK] %-24s %12zu %12zu %7.1f%% %16.2f\n", traces[i].name, full.air, delta.air,
+                    100.0 * (full.air - delta.air) / full.air, delta.maxError);
+
+        // Server rebuilds every delivered sample within deadband of measured value
+        EXPECT_EQ(full.frames, delta.frames);
+        EXPECT_EQ(full.delivered, delta.delivered);
+        EXPECT_LE(full.maxError, FLOAT_ERROR);
+        EXPECT_LE(delta.maxError, 1.0f + FLOAT_ERROR);
+        EXPECT_LT(delta.air, full.air);
+    }
+}
@@ -0,0 +1,192 @@
+/* Code under test */
+#include "Common_components/Protocol/SensorDelta.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+using namespace Component::Protocol;
+
+namespace
+{
+    // Content of sample with all fields
+    constexpr uint8_t ALL_FIELDS = GreenhouseSchema::MASK;
+
+    constexpr uint16_t KEYFRAME_INTERVAL = 4;
+
+    const SensorSample DEADBAND = {0, ALL_FIELDS, 0.1f, 0.5f, 20.0f, 1.0f};
+
+    /**
+     * @brief Get sample with all fields
+     */
+    SensorSample MakeSample(float temperature, float humidity, float co2, float soilMoisture)
+    {
+        return {0, ALL_FIELDS, temperature, humidity, co2, soilMoisture};
+    }
+
+    /**
+     * @brief Send frame with one sample, return the prepared sample
+     */
+    SensorSample SendFrame(DeltaEncoder<> &encoder, const SensorSample &sample)
+    {
+        EXPECT_TRUE(encoder.BeginFrame());
+
+        const auto prepared = encoder.Prepare(sample);
+        encoder.Accept(prepared);
+        encoder.FrameSent();
+
+        return prepared;
+    }
+
+    bool IsDelta(const SensorSample &sample) { return sample.content & SampleLayout::DELTA_FLAG; }
+} // namespace
+
+TEST(DeltaEncoder, FirstFrameIsKeyframe)
+{
+    DeltaEncoder<> encoder(DEADBAND, KEYFRAME_INTERVAL);
+
+    const auto prepared = SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f));
+    EXPECT_FALSE(IsDelta(prepared));
+    EXPECT_EQ(prepared.content, ALL_FIELDS);
+}
+
+TEST(DeltaEncoder, FrameIsNotStartedWhileSentFrameWaitsForResult)
+{
+    DeltaEncoder<> encoder(DEADBAND, KEYFRAME_INTERVAL);
+
+    SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f));
+    ASSERT_TRUE(encoder.IsAwaitingAck());
+
+    // Next upload comes before result of the first frame
+    EXPECT_FALSE(encoder.BeginFrame());
+    EXPECT_TRUE(encoder.IsAwaitingAck());
+
+    // Late result belongs to the first frame, its state becomes reference
+    encoder.Acknowledge(true);
+    EXPECT_FALSE(encoder.IsAwaitingAck());
+
+    ASSERT_TRUE(encoder.BeginFrame());
+    const auto prepared = encoder.Prepare(MakeSample(21.05f, 60.2f, 410.0f, 40.5f));
+    EXPECT_TRUE(IsDelta(prepared));
+    EXPECT_EQ(prepared.content & ALL_FIELDS, 0);
+}
+
+TEST(DeltaEncoder, ResultIsNotAppliedToOtherFrame)
+{
+    DeltaEncoder<> encoder(DEADBAND, KEYFRAME_INTERVAL);
+
+    SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f));
+    encoder.Acknowledge(true);
+
+    // Second frame is lost, server keeps the first state
+    SendFrame(encoder, MakeSample(25.0f, 60.0f, 400.0f, 40.0f));
+    EXPECT_FALSE(encoder.BeginFrame());
+    encoder.Acknowledge(false);
+
+    // Result without sent frame is ignored
+    encoder.Acknowledge(true);
+
+    ASSERT_TRUE(encoder.BeginFrame());
+    const auto prepared = encoder.Prepare(MakeSample(25.0f, 60.0f, 400.0f, 40.0f));
+    EXPECT_FALSE(IsDelta(prepared));
+}
+
+TEST(DeltaEncoder, RejectedSamplesAreSentAgainFromKeyframe)
+{
+    DeltaEncoder<> encoder(DEADBAND, KEYFRAME_INTERVAL);
+    DeltaStateCache<> server;
+
+    auto first = SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f));
+    encoder.Acknowledge(true);
+    ASSERT_EQ(server.Apply(1, first), FrameResult::FRAME_OK);
+
+    // Server lost state of client, so delta frame is rejected and its samples stay queued
+    server.Invalidate(1);
+    const SensorSample queued[] = {MakeSample(22.0f, 61.0f, 420.0f, 41.0f), MakeSample(23.0f, 61.0f, 480.0f, 41.0f)};
+
+    ASSERT_TRUE(encoder.BeginFrame());
+    for (const auto &sample : queued)
+    {
+        auto prepared = encoder.Prepare(sample);
+        EXPECT_TRUE(IsDelta(prepared));
+        encoder.Accept(prepared);
+        EXPECT_EQ(server.Apply(1, prepared), FrameResult::MISSING_KEYFRAME);
+    }
+    encoder.FrameSent();
+    encoder.Acknowledge(false);
+
+    // The same samples are sent again, the first one as keyframe, and server rebuilds all of them
+    ASSERT_TRUE(encoder.BeginFrame());
+    for (size_t i = 0; i < 2; ++i)
+    {
+        auto prepared = encoder.Prepare(queued[i]);
+        EXPECT_EQ(IsDelta(prepared), i != 0);
+        encoder.Accept(prepared);
+
+        ASSERT_EQ(server.Apply(1, prepared), FrameResult::FRAME_OK);
+        EXPECT_EQ(prepared.content, ALL_FIELDS);
+        EXPECT_FLOAT_EQ(prepared.temperature, queued[i].temperature);
+        EXPECT_FLOAT_EQ(prepared.co2, queued[i].co2);
+    }
+}
+
+TEST(DeltaEncoder, SendsOnlyFieldsBeyondDeadband)
+{
+    DeltaEncoder<> encoder(DEADBAND, KEYFRAME_INTERVAL);
+
+    SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f));
+    encoder.Acknowledge(true);
+
+    const auto prepared = SendFrame(encoder, MakeSample(21.2f, 60.4f, 430.0f, 40.5f));
+    EXPECT_TRUE(IsDelta(prepared));
+    EXPECT_EQ(prepared.content & ALL_FIELDS, ContentBit<TemperatureField>() | ContentBit<CO2Field>());
+}
+
+TEST(DeltaEncoder, SendsKeyframeAfterInterval)
+{
+    DeltaEncoder<> encoder(DEADBAND, KEYFRAME_INTERVAL);
+
+    for (int frame = 0; frame < 3 * KEYFRAME_INTERVAL; ++frame)
+    {
+        const auto prepared = SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f));
+        EXPECT_EQ(IsDelta(prepared), frame % KEYFRAME_INTERVAL != 0) << "frame " << frame;
+        encoder.Acknowledge(true);
+    }
+}
+
+TEST(DeltaEncoder, ZeroIntervalDisablesDelta)
+{
+    DeltaEncoder<> encoder(DEADBAND, 0);
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        EXPECT_FALSE(IsDelta(SendFrame(encoder, MakeSample(21.0f, 60.0f, 400.0f, 40.0f))));
+        encoder.Acknowledge(true);
+    }
+}
+
+TEST(DeltaStateCache, RebuildsFullSampleFromDelta)
+{
+    DeltaStateCache<> cache;
+
+    auto keyframe = MakeSample(21.0f, 60.0f, 400.0f, 40.0f);
+    ASSERT_EQ(cache.Apply(3, keyframe), FrameResult::FRAME_OK);
+
+    SensorSample delta{};
+    delta.age = 5;
+    delta.content = ContentBit<CO2Field>() | SampleLayout::DELTA_FLAG;
+    delta.co2 = 450.0f;
+
+    ASSERT_EQ(cache.Apply(3, delta), FrameResult::FRAME_OK);
+    EXPECT_EQ(delta.content, ALL_FIELDS);
+    EXPECT_EQ(delta.age, 5);
+    EXPECT_FLOAT_EQ(delta.temperature, 21.0f);
+    EXPECT_FLOAT_EQ(delta.co2, 450.0f);
+
+    // State of other client or forgotten state can not complete delta
+    delta.content = ContentBit<CO2Field>() | SampleLayout::DELTA_FLAG;
+    EXPECT_EQ(cache.Apply(4, delta), FrameResult::MISSING_KEYFRAME);
+
+    cache.Invalidate(3);
+    delta.content = ContentBit<CO2Field>() | SampleLayout::DELTA_FLAG;
+    EXPECT_EQ(cache.Apply(3, delta), FrameResult::MISSING_KEYFRAME);
+}
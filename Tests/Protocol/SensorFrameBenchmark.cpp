@@ -0,0 +1,53 @@
+/* Code under test */
+#include "Common_components/Protocol/SensorFrame.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* STD library */
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace Component::Protocol;
+
+TEST(SensorFrameBenchmark, EncodeAndDecodeFullFrames)
+{
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> temperature(-20.0f, 45.0f);
+    std::uniform_real_distribution<float> percent(0.0f, 100.0f);
+    std::uniform_real_distribution<float> co2(400.0f, 5000.0f);
+
+    std::vector<SensorSample> samples(SENSOR_FRAME_MAX_SAMPLES);
+    for (size_t i = 0; i < samples.size(); ++i)
+        samples[i] = {static_cast<uint16_t>(i * 10), GreenhouseSchema::MASK, temperature(generator), percent(generator), co2(generator), percent(generator)};
+
+    std::array<uint8_t, GreenhouseFrame::MAX_FRAME_SIZE> buffer;
+    const FrameHeader header = {SENSOR_FRAME_VERSION, 1, 1};
+    size_t size{0};
+
+    const auto encode = Benchmark::NanosecondsPerCall(20000, [&](size_t) {
+        GreenhouseFrame::Encoder encoder(header, Utility::DataType::Span<uint8_t>(buffer.data(), buffer.size()));
+        for (const auto &sample : samples)
+            encoder.Append(sample);
+        size = encoder.Size();
+        Benchmark::DoNotOptimize(buffer);
+    });
+
+    std::array<SensorSample, SENSOR_FRAME_MAX_SAMPLES> decodedSamples;
+    size_t decoded{0};
+
+    const auto decode = Benchmark::NanosecondsPerCall(20000, [&](size_t) {
+        GreenhouseFrame::DecodeSamples(ByteView(buffer.data(), size), Utility::DataType::Span<SensorSample>(decodedSamples.data(), decodedSamples.size()), decoded);
+        Benchmark::DoNotOptimize(decodedSamples);
+    });
+
+    ASSERT_EQ(decoded, samples.size());
+    ASSERT_EQ(size, HeaderLayout::SIZE + SENSOR_FRAME_MAX_SAMPLES * GreenhouseFrame::MAX_SAMPLE_SIZE);
+
+    Benchmark::Report("Encode full sample", encode / samples.size(), "ns");
+    Benchmark::Report("Decode full sample", decode / samples.size(), "ns");
+    Benchmark::Report("Encoded full sample", static_cast<double>(GreenhouseFrame::MAX_SAMPLE_SIZE), "bytes");
+    Benchmark::Report("Sample of four floats with age and content", static_cast<double>(sizeof(SensorSample)), "bytes");
+}
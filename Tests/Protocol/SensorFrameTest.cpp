@@ -0,0 +1,241 @@
+/* Code under test */
+#include "Common_components/Protocol/SensorFrame.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <array>
+#include <limits>
+#include <random>
+
+using namespace Component::Protocol;
+
+namespace
+{
+    using Buffer = std::array<uint8_t, GreenhouseFrame::MAX_FRAME_SIZE>;
+
+    const FrameHeader HEADER = {SENSOR_FRAME_VERSION, 42, 2};
+
+    /**
+     * @brief Encode one sample into frame
+     */
+    size_t EncodeSample(const SensorSample &sample, Buffer &buffer)
+    {
+        GreenhouseFrame::Encoder encoder(HEADER, Utility::DataType::Span<uint8_t>(buffer.data(), buffer.size()));
+        EXPECT_EQ(encoder.Append(sample), FrameResult::FRAME_OK);
+        return encoder.Size();
+    }
+
+    /**
+     * @brief Decode frame with one sample
+     */
+    SensorSample DecodeSample(const Buffer &buffer, size_t size)
+    {
+        std::array<SensorSample, 1> samples;
+        size_t decoded{0};
+
+        EXPECT_EQ(GreenhouseFrame::DecodeSamples(ByteView(buffer.data(), size), Utility::DataType::Span<SensorSample>(samples.data(), samples.size()), decoded),
+                  FrameResult::FRAME_OK);
+        EXPECT_EQ(decoded, 1u);
+        return samples[0];
+    }
+
+    /**
+     * @brief Encode and decode every value representable by field
+     */
+    template <typename Field, typename Storage>
+    void ExpectWholeRangeRoundTrip(float SensorSample::*member)
+    {
+        Buffer buffer;
+
+        for (int64_t raw = std::numeric_limits<Storage>::min(); raw <= std::numeric_limits<Storage>::max(); ++raw)
+        {
+            SensorSample sample{};
+            sample.content = ContentBit<Field>();
+            sample.*member = Field::Dequantize(static_cast<Storage>(raw));
+
+            const auto decoded = DecodeSample(buffer, EncodeSample(sample, buffer));
+
+            ASSERT_EQ(decoded.content, ContentBit<Field>()) << "raw " << raw;
+            ASSERT_EQ(decoded.*member, sample.*member) << "raw " << raw;
+            ASSERT_EQ(Field::Quantize(decoded.*member), raw) << "raw " << raw;
+        }
+    }
+
+    /**
+     * @brief Encode and decode random values inside range of field, error is at most half of resolution
+     */
+    template <typename Field, typename Storage, int32_t Scale>
+    void ExpectRoundingError(float SensorSample::*member)
+    {
+        std::mt19937 generator(Scale);
+        std::uniform_real_distribution<float> values(static_cast<float>(std::numeric_limits<Storage>::min()) / Scale,
+                                                     static_cast<float>(std::numeric_limits<Storage>::max()) / Scale);
+        Buffer buffer;
+
+        for (int i = 0; i < 100000; ++i)
+        {
+            SensorSample sample{};
+            sample.content = ContentBit<Field>();
+            sample.*member = values(generator);
+
+            const auto decoded = DecodeSample(buffer, EncodeSample(sample, buffer));
+            // Decoded value is float, so its own precision adds to error of quantization
+            const double tolerance = 0.5 / Scale + std::fabs(sample.*member) * std::numeric_limits<float>::epsilon();
+            ASSERT_LE(std::fabs(static_cast<double>(decoded.*member) - sample.*member), tolerance) << sample.*member;
+        }
+    }
+} // namespace
+
+TEST(SensorFrame, TemperatureRoundTripsWholeRange)
+{
+    ExpectWholeRangeRoundTrip<TemperatureField, int16_t>(&SensorSample::temperature);
+    ExpectRoundingError<TemperatureField, int16_t, 100>(&SensorSample::temperature);
+}
+
+TEST(SensorFrame, HumidityRoundTripsWholeRange)
+{
+    ExpectWholeRangeRoundTrip<HumidityField, int16_t>(&SensorSample::humidity);
+    ExpectRoundingError<HumidityField, int16_t, 100>(&SensorSample::humidity);
+}
+
+TEST(SensorFrame, CO2RoundTripsWholeRange)
+{
+    ExpectWholeRangeRoundTrip<CO2Field, uint16_t>(&SensorSample::co2);
+    ExpectRoundingError<CO2Field, uint16_t, 1>(&SensorSample::co2);
+}
+
+TEST(SensorFrame, SoilMoistureRoundTripsWholeRange)
+{
+    ExpectWholeRangeRoundTrip<SoilMoistureField, int16_t>(&SensorSample::soilMoisture);
+    ExpectRoundingError<SoilMoistureField, int16_t, 100>(&SensorSample::soilMoisture);
+}
+
+TEST(SensorFrame, SaturatesToRangeOfStorage)
+{
+    EXPECT_EQ(TemperatureField::Quantize(1000.0f), std::numeric_limits<int16_t>::max());
+    EXPECT_EQ(TemperatureField::Quantize(-1000.0f), std::numeric_limits<int16_t>::min());
+    EXPECT_EQ(TemperatureField::Quantize(327.67f), 32767);
+    EXPECT_EQ(TemperatureField::Quantize(-327.68f), -32768);
+
+    EXPECT_EQ(HumidityField::Quantize(std::numeric_limits<float>::max()), std::numeric_limits<int16_t>::max());
+    EXPECT_EQ(HumidityField::Quantize(std::numeric_limits<float>::lowest()), std::numeric_limits<int16_t>::min());
+
+    EXPECT_EQ(CO2Field::Quantize(70000.0f), std::numeric_limits<uint16_t>::max());
+    EXPECT_EQ(CO2Field::Quantize(-5.0f), 0);
+
+    EXPECT_EQ(SoilMoistureField::Quantize(400.0f), std::numeric_limits<int16_t>::max());
+    EXPECT_EQ(SoilMoistureField::Quantize(-400.0f), std::numeric_limits<int16_t>::min());
+
+    // Saturated value survives whole frame
+    SensorSample sample{};
+    sample.content = ContentBit<TemperatureField>() | ContentBit<CO2Field>();
+    sample.temperature = 500.0f;
+    sample.co2 = 100000.0f;
+
+    Buffer buffer;
+    const auto decoded = DecodeSample(buffer, EncodeSample(sample, buffer));
+    EXPECT_FLOAT_EQ(decoded.temperature, 327.67f);
+    EXPECT_EQ(decoded.co2, 65535.0f);
+}
+
+TEST(SensorFrame, RoundsHalfAwayFromZero)
+{
+    // Values with exact binary representation of half of resolution
+    EXPECT_EQ(TemperatureField::Quantize(0.125f), 13);
+    EXPECT_EQ(TemperatureField::Quantize(-0.125f), -13);
+    EXPECT_EQ(TemperatureField::Quantize(0.375f), 38);
+    EXPECT_EQ(TemperatureField::Quantize(-0.375f), -38);
+    EXPECT_EQ(HumidityField::Quantize(50.125f), 5013);
+    EXPECT_EQ(SoilMoistureField::Quantize(-20.625f), -2063);
+
+    EXPECT_EQ(CO2Field::Quantize(0.5f), 1);
+    EXPECT_EQ(CO2Field::Quantize(2.5f), 3);
+    EXPECT_EQ(CO2Field::Quantize(411.5f), 412);
+
+    // Below half rounds toward zero
+    EXPECT_EQ(TemperatureField::Quantize(0.1249f), 12);
+    EXPECT_EQ(TemperatureField::Quantize(-0.1249f), -12);
+    EXPECT_EQ(CO2Field::Quantize(2.49f), 2);
+}
+
+TEST(SensorFrame, RejectsValuesWhichAreNotFinite)
+{
+    const float invalid[] = {std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+                             -std::numeric_limits<float>::infinity()};
+
+    for (const auto value : invalid)
+    {
+        SensorSample sample{};
+        sample.content = GreenhouseSchema::MASK;
+        sample.temperature = value;
+        sample.humidity = 55.5f;
+        sample.co2 = value;
+        sample.soilMoisture = 31.25f;
+
+        Buffer buffer;
+        const size_t size = EncodeSample(sample, buffer);
+
+        // Only finite fields are encoded, bits of the others are cleared
+        const uint8_t finite = ContentBit<HumidityField>() | ContentBit<SoilMoistureField>();
+        EXPECT_EQ(size, HeaderLayout::SIZE + GreenhouseFrame::SampleSize(finite));
+
+        const auto decoded = DecodeSample(buffer, size);
+        EXPECT_EQ(decoded.content, finite);
+        EXPECT_FLOAT_EQ(decoded.humidity, 55.5f);
+        EXPECT_FLOAT_EQ(decoded.soilMoisture, 31.25f);
+    }
+}
+
+TEST(SensorFrame, RejectsFrameOfOtherVersion)
+{
+    SensorSample sample{};
+    sample.content = ContentBit<TemperatureField>();
+    sample.temperature = 21.5f;
+
+    Buffer buffer;
+    const size_t size = EncodeSample(sample, buffer);
+
+    FrameHeader header;
+    uint8_t count{0};
+    ASSERT_EQ(GreenhouseFrame::DecodeHeader(ByteView(buffer.data(), size), header, count), FrameResult::FRAME_OK);
+    EXPECT_EQ(header.version, SENSOR_FRAME_VERSION);
+    EXPECT_EQ(header.clientID, HEADER.clientID);
+    EXPECT_EQ(header.position, HEADER.position);
+    EXPECT_EQ(count, 1);
+
+    const uint8_t versions[] = {0x00, SENSOR_FRAME_VERSION - 1, SENSOR_FRAME_VERSION + 1, 0xFF};
+    for (const auto version : versions)
+    {
+        buffer[HeaderLayout::VERSION_OFFSET] = version;
+
+        EXPECT_EQ(GreenhouseFrame::DecodeHeader(ByteView(buffer.data(), size), header, count), FrameResult::INVALID_VERSION);
+
+        std::array<SensorSample, 1> samples;
+        size_t decoded{1};
+        EXPECT_EQ(GreenhouseFrame::DecodeSamples(ByteView(buffer.data(), size), Utility::DataType::Span<SensorSample>(samples.data(), samples.size()), decoded),
+                  FrameResult::INVALID_VERSION);
+        EXPECT_EQ(decoded, 0u);
+    }
+
+    EXPECT_STREQ(FRAME_RESULT_TO_STRING(FrameResult::INVALID_VERSION), "Frame_Invalid_Version");
+}
+
+TEST(SensorFrame, RejectsTruncatedFrame)
+{
+    SensorSample sample{};
+    sample.content = GreenhouseSchema::MASK;
+
+    Buffer buffer;
+    const size_t size = EncodeSample(sample, buffer);
+
+    for (size_t length = HeaderLayout::SIZE; length < size; ++length)
+    {
+        std::array<SensorSample, 1> samples;
+        size_t decoded{0};
+        EXPECT_EQ(GreenhouseFrame::DecodeSamples(ByteView(buffer.data(), length), Utility::DataType::Span<SensorSample>(samples.data(), samples.size()), decoded),
+                  FrameResult::TRUNCATED_FRAME)
+            << "length " << length;
+    }
+}
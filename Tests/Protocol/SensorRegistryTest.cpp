@@ -0,0 +1,171 @@
+/* Code under test */
+#include "Common_components/Protocol/SensorFrame.hpp"
+#include "Common_components/Protocol/SensorRegistry.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace Component::Protocol;
+
+namespace
+{
+    /* Fields of all sensors of greenhouse */
+    constexpr uint8_t ALL_FIELDS = 0xF0;
+
+    // Registry assigns the same bits which fields carried before registry
+    static_assert(ContentBit<TemperatureField>() == 0x80, "Bit of temperature changed");
+    static_assert(ContentBit<HumidityField>() == 0x40, "Bit of humidity changed");
+    static_assert(ContentBit<CO2Field>() == 0x20, "Bit of CO2 changed");
+    static_assert(ContentBit<SoilMoistureField>() == 0x10, "Bit of soil moisture changed");
+
+    // Schema keeps order and sizes of fields
+    static_assert(std::is_same<GreenhouseSchema, FrameSchema<BoundField<TemperatureField, 0x80>, BoundField<HumidityField, 0x40>,
+                                                             BoundField<CO2Field, 0x20>, BoundField<SoilMoistureField, 0x10>>>::value,
+                  "Layout of greenhouse schema changed");
+    static_assert(GreenhouseSchema::MASK == ALL_FIELDS, "Content mask of greenhouse schema changed");
+    static_assert(GreenhouseFrame::MAX_SAMPLE_SIZE == 11, "Size of full sample changed");
+
+    // Disabled sensors drop out of schema of subset, the rest keeps its bits and order
+    static_assert(std::is_same<GreenhouseRegistry::Subset<0x80 | 0x40>::Schema,
+                               FrameSchema<BoundField<TemperatureField, 0x80>, BoundField<HumidityField, 0x40>>>::value,
+                  "Subset of air sensor");
+    static_assert(std::is_same<GreenhouseRegistry::Subset<0x20 | 0x10>::Schema,
+                               FrameSchema<BoundField<CO2Field, 0x20>, BoundField<SoilMoistureField, 0x10>>>::value,
+                  "Subset of CO2 and soil sensors");
+    static_assert(std::is_same<GreenhouseRegistry::Subset<0x00>::Schema, FrameSchema<>>::value, "Empty subset");
+    static_assert(SensorFrame<GreenhouseRegistry::Subset<0x20>::Schema>::CONTENT_MASK == (0x20 | SampleLayout::DELTA_FLAG),
+                  "Content of subset with CO2 only");
+    static_assert(SensorFrame<GreenhouseRegistry::Subset<0x10>::Schema>::MAX_SAMPLE_SIZE == 5, "Size of soil sample");
+
+    /* Field of sensor appended to registry, reuses member of sample */
+    using LightField = FixedPointField<uint16_t, 10, &SensorSample::soilMoisture>;
+
+    struct LightDescriptor
+    {
+        using Fields = FieldList<LightField>;
+    };
+
+    using ExtendedRegistry = SensorRegistry<AirDescriptor, CO2Descriptor, SoilDescriptor, LightDescriptor>;
+
+    // Appended sensor takes the next free bit, fields of existing sensors keep theirs
+    static_assert(ContentBit<TemperatureField, ExtendedRegistry>() == 0x80, "Appended sensor moved temperature");
+    static_assert(ContentBit<SoilMoistureField, ExtendedRegistry>() == 0x10, "Appended sensor moved soil moisture");
+    static_assert(ContentBit<LightField, ExtendedRegistry>() == 0x08, "Bit of appended sensor");
+
+    // Order of sensors defines wire format
+    using ReorderedRegistry = SensorRegistry<SoilDescriptor, AirDescriptor, CO2Descriptor>;
+    static_assert(ContentBit<SoilMoistureField, ReorderedRegistry>() == 0x80, "The first sensor takes the highest bit");
+    static_assert(ContentBit<CO2Field, ReorderedRegistry>() == 0x10, "The last sensor takes the lowest bit");
+
+    const FrameHeader HEADER = {SENSOR_FRAME_VERSION, 42, 2};
+
+    /**
+     * @brief Sample with all fields of greenhouse
+     */
+    SensorSample FullSample()
+    {
+        SensorSample sample{};
+        sample.age = 0x0102;
+        sample.content = ALL_FIELDS;
+        sample.temperature = -12.34f;
+        sample.humidity = 56.78f;
+        sample.co2 = 1234.0f;
+        sample.soilMoisture = 33.33f;
+        return sample;
+    }
+
+    /**
+     * @brief Encode sample by client with only some sensors enabled and decode it by server with whole registry
+     */
+    template <uint8_t Content>
+    void ExpectSubsetRoundTrip()
+    {
+        using ClientFrame = SensorFrame<typename GreenhouseRegistry::template Subset<Content>::Schema>;
+
+        std::array<uint8_t, GreenhouseFrame::MAX_FRAME_SIZE> buffer;
+        typename ClientFrame::Encoder encoder(HEADER, Utility::DataType::Span<uint8_t>(buffer.data(), buffer.size()));
+
+        auto sample = FullSample();
+        sample.content = Content;
+        ASSERT_EQ(encoder.Append(sample), FrameResult::FRAME_OK) << "content " << static_cast<int>(Content);
+        EXPECT_EQ(encoder.Size(), HeaderLayout::SIZE + GreenhouseFrame::SampleSize(Content)) << "content " << static_cast<int>(Content);
+
+        // Sample with field of disabled sensor can not be encoded by client
+        const uint8_t disabled = ALL_FIELDS & ~Content;
+        if (disabled)
+        {
+            sample.content = Content | disabled;
+            EXPECT_EQ(encoder.Append(sample), FrameResult::INVALID_CONTENT) << "content " << static_cast<int>(Content);
+        }
+
+        std::array<SensorSample, 1> samples;
+        size_t decoded{0};
+        ASSERT_EQ(GreenhouseFrame::DecodeSamples(ByteView(buffer.data(), encoder.Size()),
+                                                 Utility::DataType::Span<SensorSample>(samples.data(), samples.size()), decoded),
+                  FrameResult::FRAME_OK);
+        ASSERT_EQ(decoded, 1u);
+
+        const auto expected = FullSample();
+        EXPECT_EQ(samples[0].age, expected.age);
+        EXPECT_EQ(samples[0].content, Content);
+        EXPECT_FLOAT_EQ(samples[0].temperature, (Content & 0x80) ? expected.temperature : 0.0f);
+        EXPECT_FLOAT_EQ(samples[0].humidity, (Content & 0x40) ? expected.humidity : 0.0f);
+        EXPECT_FLOAT_EQ(samples[0].co2, (Content & 0x20) ? expected.co2 : 0.0f);
+        EXPECT_FLOAT_EQ(samples[0].soilMoisture, (Content & 0x10) ? expected.soilMoisture : 0.0f);
+    }
+
+    /**
+     * @brief Round trip of every subset of four greenhouse fields
+     */
+    template <size_t... Subsets>
+    void ExpectEverySubsetRoundTrip(std::index_sequence<Subsets...>)
+    {
+        const int expand[] = {(ExpectSubsetRoundTrip<static_cast<uint8_t>(Subsets << 4)>(), 0)...};
+        (void)expand;
+    }
+} // namespace
+
+TEST(SensorRegistry, EncodesSameBytesAsFrameBeforeRegistry)
+{
+    // Frame encoded by schema with hand-picked bits of version 3
+    const std::vector<uint8_t> expected = {0x03, 0xAA, 0x02, 0x01, 0x02, 0xF0, 0xFB, 0x2E, 0x16, 0x2E, 0x04,
+                                           0xD2, 0x0D, 0x05, 0x00, 0x07, 0x51, 0x13, 0x88, 0x04, 0xE2};
+
+    std::array<uint8_t, GreenhouseFrame::MAX_FRAME_SIZE> buffer;
+    GreenhouseFrame::Encoder encoder(HEADER, Utility::DataType::Span<uint8_t>(buffer.data(), buffer.size()));
+
+    ASSERT_EQ(encoder.Append(FullSample()), FrameResult::FRAME_OK);
+
+    SensorSample delta{};
+    delta.age = 7;
+    delta.content = ContentBit<HumidityField>() | ContentBit<SoilMoistureField>() | SampleLayout::DELTA_FLAG;
+    delta.humidity = 50.0f;
+    delta.soilMoisture = 12.5f;
+    ASSERT_EQ(encoder.Append(delta), FrameResult::FRAME_OK);
+
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + encoder.Size()), expected);
+}
+
+TEST(SensorRegistry, EverySubsetRoundTripsThroughWholeRegistry)
+{
+    ExpectEverySubsetRoundTrip(std::make_index_sequence<16>());
+}
+
+TEST(SensorRegistry, SubsetFrameIsSmallerOnlyByDisabledFields)
+{
+    using AirFrame = SensorFrame<GreenhouseRegistry::Subset<0x80 | 0x40>::Schema>;
+
+    // Constants are copied, so test does not need their definition
+    const size_t maxSampleSize = AirFrame::MAX_SAMPLE_SIZE;
+    const uint8_t contentMask = AirFrame::CONTENT_MASK;
+
+    EXPECT_EQ(maxSampleSize, SampleLayout::SIZE + TemperatureField::SIZE + HumidityField::SIZE);
+    EXPECT_EQ(contentMask, 0x80 | 0x40 | SampleLayout::DELTA_FLAG);
+    EXPECT_EQ(AirFrame::SampleSize(0x80 | 0x40), GreenhouseFrame::SampleSize(0x80 | 0x40));
+}
@@ -0,0 +1,151 @@
+/* Code under test */
+#include "SCD4x.hpp"
+#include "SHT4x.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Fakes/FakeI2CBus.hpp"
+
+/* Host stubs */
+#include "HostRtos.hpp"
+
+/* Common components */
+#include "Common_components/Utility/Checksum/Crc8.hpp"
+
+/* STD library */
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+using namespace Sensor;
+using Fake::FakeI2CBus;
+
+namespace
+{
+    constexpr uint8_t SHT4x_ADDRESS = 0x44;
+    constexpr uint8_t SCD4x_ADDRESS = 0x62;
+
+    // Sensor clock runs on ticks of host kernel, one tick of firmware lasts this long
+    constexpr std::chrono::microseconds TICK_PERIOD(20);
+
+    // Work of client cycle besides air sensor, soil moisture burst and upload of queued samples
+    constexpr TickType_t SOIL_TICKS = 100;
+    constexpr TickType_t UPLOAD_TICKS = 700;
+
+    constexpr size_t CYCLES = 5;
+
+    /**
+     * @brief Response of sensor, every word followed by its CRC
+     */
+    std::vector<uint8_t> Words(std::initializer_list<uint16_t> words)
+    {
+        std::vector<uint8_t> response;
+        for (const auto word : words)
+        {
+            const uint8_t bytes[] = {static_cast<uint8_t>(word >> 8), static_cast<uint8_t>(word)};
+            response.insert(response.end(), bytes, bytes + 2);
+            response.push_back(Utility::Checksum::SensirionCrc8::Compute(ByteView(bytes, sizeof(bytes))));
+        }
+
+        return response;
+    }
+
+    /**
+     * @brief Work of client which does not use air sensor
+     */
+    void OtherWork()
+    {
+        vTaskDelay(SOIL_TICKS);
+        vTaskDelay(UPLOAD_TICKS);
+    }
+
+    /**
+     * @brief Blocking cycle, air sensor is measured before other work
+     */
+    void BlockingCycle(Sensor_I &sensor)
+    {
+        sensor.Measure();
+        OtherWork();
+    }
+
+    /**
+     * @brief Cycle of greenhouse manager, other work runs while air sensor converts
+     */
+    void OverlappedCycle(Sensor_I &sensor)
+    {
+        ASSERT_EQ(sensor.StartMeasurement(), I2C_OperationResult::I2C_OK);
+        OtherWork();
+        ASSERT_TRUE(sensor.WaitForData());
+        ASSERT_EQ(sensor.ReadMeasurement(), I2C_OperationResult::I2C_OK);
+    }
+
+    /**
+     * @brief Ticks of the shortest cycle, script gives transfers of one measurement. Loaded host delays some
+     *        cycles by many short ticks, the shortest one is closest to cycle on target
+     */
+    double MeasureCycle(Sensor_I &sensor, FakeI2CBus &bus, const std::function<void(FakeI2CBus &)> &script,
+                        void (*cycle)(Sensor_I &))
+    {
+        bus.Clear();
+        for (size_t i = 0; i < CYCLES; ++i)
+            script(bus);
+
+        TickType_t shortest = portMAX_DELAY;
+        for (size_t i = 0; i < CYCLES; ++i)
+        {
+            const TickType_t start = xTaskGetTickCount();
+            cycle(sensor);
+            shortest = std::min<TickType_t>(shortest, xTaskGetTickCount() - start);
+        }
+
+        EXPECT_TRUE(bus.IsDone());
+        return static_cast<double>(shortest);
+    }
+
+    /**
+     * @brief Compare cycles, report and return saved ticks
+     */
+    double Compare(const char *name, Sensor_I &sensor, FakeI2CBus &bus, const std::function<void(FakeI2CBus &)> &script)
+    {
+        const double blocking = MeasureCycle(sensor, bus, script, &BlockingCycle);
+        const double overlapped = MeasureCycle(sensor, bus, script, &OverlappedCycle);
+
+        std::printf("[ BENCHMARK] %-8s %14.0f %14.0f %12.0f %9.1f%%\n", name, blocking, overlapped, blocking - overlapped,
+                    100.0 * (blocking - overlapped) / blocking);
+
+        return blocking - overlapped;
+    }
+} // namespace
+
+TEST(MeasurementCycleBenchmark, OverlappedConversionShortensCycle)
+{
+    const auto period = Host::GetTickPeriod();
+    Host::SetTickPeriod(TICK_PERIOD);
+
+    FakeI2CBus bus;
+    SHT4x sht4x(SHT4x_ADDRESS, &bus);
+    SCD4x scd4x(SCD4x_ADDRESS, &bus);
+
+    std::printf("[ BENCHMARK] other work of cycle %u ticks, shortest of %zu cycles\n", static_cast<unsigned>(SOIL_TICKS + UPLOAD_TICKS), CYCLES);
+    std::printf("[ BENCHMARK] %-8s %14s %14s %12s %10s\n", "sensor", "blocking ticks", "overlap ticks", "saved", "saved");
+
+    // Conversion of 5 s is longer than other work, whole work is hidden
+    const double scd4xSaved = Compare("SCD4x", scd4x, bus, [](FakeI2CBus &script) {
+        script.Expect(SCD4x_ADDRESS, {0x21, 0x9D});
+        script.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8006}));
+        script.Expect(SCD4x_ADDRESS, {0xEC, 0x05}, Words({600, 0x6666, 0x8000}));
+    });
+
+    // Conversion of 10 ms is shorter than other work, only conversion is hidden
+    Compare("SHT4x", sht4x, bus, [](FakeI2CBus &script) {
+        script.Expect(SHT4x_ADDRESS, {MEASURE_T_RH_HIGH_PRECISION});
+        script.Expect(SHT4x_ADDRESS, {}, Words({0x6666, 0x8000}));
+    });
+
+    Host::SetTickPeriod(period);
+
+    // Host scheduling adds a few ticks to every delay, so saving is checked with margin. Saving of SHT4x
+    // is within this margin and is only reported
+    EXPECT_GT(scd4xSaved, 0.9 * (SOIL_TICKS + UPLOAD_TICKS));
+}
@@ -0,0 +1,294 @@
+/* Code under test */
+#include "SCD4x.hpp"
+#include "SHT4x.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Fakes/FakeI2CBus.hpp"
+#include "Support/AllocationCounter.hpp"
+
+/* Host stubs */
+#include "HostRtos.hpp"
+
+/* Common components */
+#include "Common_components/Utility/Checksum/Crc8.hpp"
+
+/* STD library */
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Sensor;
+using Fake::FakeI2CBus;
+
+namespace
+{
+    constexpr uint8_t SHT4x_ADDRESS = 0x44;
+    constexpr uint8_t SCD4x_ADDRESS = 0x62;
+
+    // Time of one bit on wire at 400 kHz in microseconds
+    constexpr double BIT_TIME = 2.5;
+
+    // Tick of FreeRTOS configuration in microseconds
+    constexpr double TICK_TIME = 1000.0;
+
+    /**
+     * @brief Response of sensor, every word followed by its CRC
+     */
+    std::vector<uint8_t> Words(std::initializer_list<uint16_t> words)
+    {
+        std::vector<uint8_t> response;
+        for (const auto word : words)
+        {
+            const uint8_t bytes[] = {static_cast<uint8_t>(word >> 8), static_cast<uint8_t>(word)};
+            response.insert(response.end(), bytes, bytes + 2);
+            response.push_back(Utility::Checksum::SensirionCrc8::Compute(ByteView(bytes, sizeof(bytes))));
+        }
+
+        return response;
+    }
+
+    /**
+     * @brief Temperature of SCD4x sample
+     */
+    float Temperature(uint16_t word) { return static_cast<float>(-45 + 175 * word / 65536.0); }
+
+    /**
+     * @brief Wait until background task of sensor reaches condition
+     */
+    template <typename Condition>
+    bool WaitFor(Condition condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Sensors wait for seconds of ticks, so tick of host is shortened
+     */
+    class SensorBusTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            mTickPeriod = Host::GetTickPeriod();
+            Host::SetTickPeriod(std::chrono::microseconds(10));
+        }
+
+        void TearDown() override { Host::SetTickPeriod(mTickPeriod); }
+
+        FakeI2CBus mBus;
+
+    private:
+        std::chrono::microseconds mTickPeriod;
+    };
+} // namespace
+
+TEST_F(SensorBusTest, SHT4xMeasurementDoesNotAllocate)
+{
+    // Counter sees allocations of driver, constructor allocates values of sensor
+    Allocation::Scope construction;
+    SHT4x sensor(SHT4x_ADDRESS, &mBus);
+    EXPECT_GE(construction.Allocations(), 2u);
+
+    mBus.Expect(SHT4x_ADDRESS, {MEASURE_T_RH_HIGH_PRECISION});
+    mBus.Expect(SHT4x_ADDRESS, {}, Words({0x6666, 0x8000}));
+
+    Allocation::Scope allocations;
+    sensor.Measure();
+    EXPECT_EQ(allocations.Allocations(), 0u);
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_NEAR(sensor.GetTemperature(), 25.0f, 0.01f);
+    EXPECT_NEAR(sensor.GetHumanity(), 56.5f, 0.01f);
+
+    // Command: start, address, command, stop. Result: start, address, two words, stop
+    ASSERT_EQ(mBus.GetLog().size(), 2u);
+    EXPECT_DOUBLE_EQ(mBus.WireTime(), (20 + 65) * BIT_TIME);
+    EXPECT_DOUBLE_EQ(mBus.BusTime(), mBus.WireTime());
+}
+
+TEST_F(SensorBusTest, SHT4xMeasuresAgainWhenResultIsCorrupted)
+{
+    SHT4x sensor(SHT4x_ADDRESS, &mBus);
+
+    auto corrupted = Words({0x6666, 0x8000});
+    corrupted[1] ^= 0x01;
+
+    // Sensor sends result only once, so retry starts conversion again and reads its result after conversion time
+    mBus.Expect(SHT4x_ADDRESS, {MEASURE_T_RH_HIGH_PRECISION});
+    mBus.Expect(SHT4x_ADDRESS, {}, corrupted);
+    mBus.Expect(SHT4x_ADDRESS, {MEASURE_T_RH_HIGH_PRECISION}, Words({0x6666, 0x8000}));
+
+    Allocation::Scope allocations;
+    sensor.Measure();
+    EXPECT_EQ(allocations.Allocations(), 0u);
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_NEAR(sensor.GetTemperature(), 25.0f, 0.01f);
+    EXPECT_NEAR(sensor.GetHumanity(), 56.5f, 0.01f);
+    EXPECT_EQ(sensor.GetChecksumStatistics().mismatches, 1u);
+    EXPECT_EQ(sensor.GetChecksumStatistics().retries, 1u);
+    EXPECT_EQ(sensor.GetChecksumStatistics().failures, 0u);
+
+    ASSERT_EQ(mBus.GetLog().size(), 3u);
+    EXPECT_EQ(mBus.GetLog()[2].delay, 10u);
+}
+
+TEST_F(SensorBusTest, SCD4xSingleShotDoesNotAllocate)
+{
+    SCD4x sensor(SCD4x_ADDRESS, &mBus);
+
+    mBus.Expect(SCD4x_ADDRESS, {0x21, 0x9D});
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8006}));
+    mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05}, Words({600, 0x6666, 0x8000}));
+
+    Allocation::Scope allocations;
+    sensor.Measure();
+    EXPECT_EQ(allocations.Allocations(), 0u);
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_EQ(sensor.GetCO2(), 600);
+    EXPECT_NEAR(sensor.GetTemperature(), 25.0f, 0.01f);
+    EXPECT_NEAR(sensor.GetHumanity(), 50.0f, 0.01f);
+
+    // Command of two bytes, status and measurement are read one tick after their command
+    ASSERT_EQ(mBus.GetLog().size(), 3u);
+    EXPECT_EQ(mBus.GetLog()[1].delay, 1u);
+    EXPECT_EQ(mBus.GetLog()[2].delay, 1u);
+    EXPECT_DOUBLE_EQ(mBus.WireTime(), (29 + 67 + 121) * BIT_TIME);
+    EXPECT_DOUBLE_EQ(mBus.BusTime(), (29 + 67 + 121) * BIT_TIME + 2 * TICK_TIME);
+}
+
+TEST_F(SensorBusTest, SCD4xDoesNotReadCorruptedMeasurementAgain)
+{
+    SCD4x sensor(SCD4x_ADDRESS, &mBus);
+
+    auto corrupted = Words({600, 0x6666, 0x8000});
+    corrupted[4] ^= 0x10;
+
+    // Sensor clears measurement once it was read, so repeated read would not be acknowledged
+    mBus.Expect(SCD4x_ADDRESS, {0x21, 0x9D});
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8006}));
+    mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05}, corrupted);
+
+    Allocation::Scope allocations;
+    sensor.Measure();
+    EXPECT_EQ(allocations.Allocations(), 0u);
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_EQ(sensor.GetCO2(), 0);
+    EXPECT_EQ(sensor.GetChecksumStatistics().mismatches, 1u);
+    EXPECT_EQ(sensor.GetChecksumStatistics().retries, 0u);
+    EXPECT_EQ(sensor.GetChecksumStatistics().failures, 1u);
+    EXPECT_EQ(sensor.GetMeasurementState(), MeasurementState::MEASUREMENT_IDLE);
+}
+
+TEST_F(SensorBusTest, SCD4xAcquisitionReadsNextSampleAfterCorruptedOne)
+{
+    SCD4x sensor(SCD4x_ADDRESS, &mBus);
+
+    auto corrupted = Words({600, 0x6666, 0x8000});
+    corrupted[4] ^= 0x10;
+
+    // Corrupted sample is dropped, data ready is polled until sensor has the next one
+    mBus.Expect(SCD4x_ADDRESS, {0x21, 0xB1});
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8006}));
+    mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05}, corrupted);
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8000}));
+    mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8006}));
+    mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05}, Words({700, 0x6666, 0x8000}));
+    mBus.Expect(SCD4x_ADDRESS, {0x3F, 0x86});
+
+    ASSERT_TRUE(sensor.StartAcquisition(false));
+
+    AirSample sample{};
+    ASSERT_TRUE(WaitFor([&sensor, &sample] { return sensor.GetLatestSample(sample); }));
+    sensor.StopAcquisition();
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_EQ(sample.co2, 700);
+    EXPECT_EQ(sensor.GetChecksumStatistics().mismatches, 1u);
+    EXPECT_EQ(sensor.GetChecksumStatistics().retries, 0u);
+    EXPECT_EQ(sensor.GetChecksumStatistics().failures, 1u);
+
+    // Corrupted sample is followed by poll of status, not by read of cleared buffer
+    ASSERT_EQ(mBus.GetLog().size(), 7u);
+    EXPECT_EQ(mBus.GetLog()[3].read, static_cast<size_t>(SENSOR_WORD_SIZE));
+}
+
+TEST_F(SensorBusTest, SCD4xWindowAggregatesNewestSamplesOfRing)
+{
+    SCD4x sensor(SCD4x_ADDRESS, &mBus);
+
+    // Six samples wrap around ring of four, minimum of temperature is not the oldest sample of window
+    const uint16_t co2[] = {400, 500, 600, 700, 800, 900};
+    const uint16_t temperature[] = {0x6666, 0x4000, 0x7000, 0x5000, 0x8000, 0x6000};
+
+    mBus.Expect(SCD4x_ADDRESS, {0x21, 0xB1});
+    for (size_t i = 0; i < 6; ++i)
+    {
+        mBus.Expect(SCD4x_ADDRESS, {0xE4, 0xB8}, Words({0x8006}));
+        mBus.Expect(SCD4x_ADDRESS, {0xEC, 0x05}, Words({co2[i], temperature[i], 0x8000}));
+    }
+    mBus.Expect(SCD4x_ADDRESS, {0x3F, 0x86});
+
+    ASSERT_TRUE(sensor.StartAcquisition(false));
+
+    AirSample sample{};
+    ASSERT_TRUE(WaitFor([&sensor, &sample] { return sensor.GetLatestSample(sample) && sample.co2 == 900; }));
+
+    // Values of running acquisition are averages of window of two samples
+    EXPECT_EQ(sensor.GetCO2(), 850);
+    EXPECT_NEAR(sensor.GetTemperature(), (Temperature(0x8000) + Temperature(0x6000)) / 2, 0.001f);
+
+    AirWindow window{};
+    ASSERT_TRUE(sensor.GetWindow(0, window));
+    sensor.StopAcquisition();
+    EXPECT_TRUE(mBus.IsDone());
+
+    EXPECT_EQ(window.count, 4u);
+    EXPECT_FLOAT_EQ(window.co2.mean, 750.0f);
+    EXPECT_FLOAT_EQ(window.co2.min, 600.0f);
+    EXPECT_FLOAT_EQ(window.co2.max, 900.0f);
+    EXPECT_NEAR(window.temperature.mean, (Temperature(0x7000) + Temperature(0x5000) + Temperature(0x8000) + Temperature(0x6000)) / 4,
+                0.001f);
+    EXPECT_FLOAT_EQ(window.temperature.min, Temperature(0x5000));
+    EXPECT_FLOAT_EQ(window.temperature.max, Temperature(0x8000));
+    EXPECT_FLOAT_EQ(window.humidity.min, window.humidity.max);
+
+    // Window longer than ring holds all buffered samples
+    ASSERT_TRUE(sensor.GetWindow(10, window));
+    EXPECT_EQ(window.count, 4u);
+
+    ASSERT_TRUE(sensor.GetWindow(3, window));
+    EXPECT_EQ(window.count, 3u);
+    EXPECT_FLOAT_EQ(window.co2.mean, 800.0f);
+    EXPECT_FLOAT_EQ(window.temperature.min, Temperature(0x5000));
+
+    // Stopped acquisition keeps buffered samples, but values are read from sensor again
+    EXPECT_EQ(sensor.GetCO2(), 0);
+}
+
+TEST_F(SensorBusTest, SCD4xStopsWhenCommandIsNotAcknowledged)
+{
+    SCD4x sensor(SCD4x_ADDRESS, &mBus);
+
+    mBus.ExpectFailure(SCD4x_ADDRESS, {0x21, 0x9D});
+
+    Allocation::Scope allocations;
+    sensor.Measure();
+    EXPECT_EQ(allocations.Allocations(), 0u);
+
+    EXPECT_TRUE(mBus.IsDone());
+    EXPECT_EQ(sensor.GetMeasurementState(), MeasurementState::MEASUREMENT_IDLE);
+    EXPECT_EQ(mBus.GetLog().size(), 1u);
+}
@@ -0,0 +1,92 @@
+/* Code under test */
+#include "Sensor.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* Common components */
+#include "Common_components/Utility/Checksum/Crc8.hpp"
+
+/* STD library */
+#include <array>
+
+using namespace Sensor;
+
+namespace
+{
+    /**
+     * @brief Sensor exposing response validation of driver, bus is not used
+     */
+    class ChecksumSensor : public Sensor_I
+    {
+    public:
+        ChecksumSensor() : Sensor_I(0x44, nullptr) {}
+
+        using Sensor_I::IsResponseValid;
+
+        std::string SerialNumber() const override { return {}; }
+        void SoftReset() const override {}
+
+    protected:
+        I2C_OperationResult TriggerMeasurement() override { return I2C_OperationResult::I2C_OK; }
+        TickType_t ConversionTime() const override { return 0; }
+        I2C_OperationResult FetchMeasurement() override { return I2C_OperationResult::I2C_OK; }
+    };
+
+    /**
+     * @brief Response of three words with valid CRC, as SCD4x sends measurement
+     */
+    std::array<uint8_t, 3 * SENSOR_WORD_SIZE> MakeResponse()
+    {
+        const uint16_t words[] = {0x01F4, 0x6667, 0x5EB9};
+
+        std::array<uint8_t, 3 * SENSOR_WORD_SIZE> response;
+        for (size_t i = 0; i < 3; ++i)
+        {
+            response[i * SENSOR_WORD_SIZE] = static_cast<uint8_t>(words[i] >> 8);
+            response[i * SENSOR_WORD_SIZE + 1] = static_cast<uint8_t>(words[i]);
+            response[i * SENSOR_WORD_SIZE + 2] = Utility::Checksum::SensirionCrc8::Compute(ByteView(&response[i * SENSOR_WORD_SIZE], 2));
+        }
+
+        return response;
+    }
+} // namespace
+
+TEST(SensorChecksum, AcceptsValidResponse)
+{
+    ChecksumSensor sensor;
+    const auto response = MakeResponse();
+
+    EXPECT_TRUE(sensor.IsResponseValid(response));
+    EXPECT_EQ(sensor.GetChecksumStatistics().mismatches, 0u);
+}
+
+TEST(SensorChecksum, RejectsCorruptedWord)
+{
+    ChecksumSensor sensor;
+    uint32_t corruptions = 0;
+
+    // Every bit of every word and of its CRC
+    for (size_t byte = 0; byte < 3 * SENSOR_WORD_SIZE; ++byte)
+    {
+        for (uint8_t bit = 0; bit < 8; ++bit)
+        {
+            auto response = MakeResponse();
+            response[byte] ^= static_cast<uint8_t>(1 << bit);
+
+            EXPECT_FALSE(sensor.IsResponseValid(response)) << "byte " << byte << ", bit " << static_cast<int>(bit);
+            ++corruptions;
+        }
+    }
+
+    // One corrupted word per response
+    EXPECT_EQ(sensor.GetChecksumStatistics().mismatches, corruptions);
+}
+
+TEST(SensorChecksum, RejectsResponseOfPartialWord)
+{
+    ChecksumSensor sensor;
+    const auto response = MakeResponse();
+
+    EXPECT_FALSE(sensor.IsResponseValid(ByteView(response.data(), response.size() - 1)));
+}
@@ -0,0 +1,19 @@
+/* Host stubs */
+#include "esp_timer.h"
+
+/* STD library */
+#include <chrono>
+
+namespace
+{
+    // Start of host process, time of boot for components
+    const auto BOOT = std::chrono::steady_clock::now();
+} // namespace
+
+/**
+ * @brief Get time in microseconds since start of host process
+ */
+int64_t esp_timer_get_time(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - BOOT).count();
+}
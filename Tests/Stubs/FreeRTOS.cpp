@@ -0,0 +1,476 @@
+/* Host stubs */
+#include "HostRtos.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/* STD library */
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Task created by xTaskCreate or thread of host calling FreeRTOS */
+struct HostTask
+{
+    // Name of task
+    std::string name;
+    // Bytes of heap held by task
+    size_t heap;
+    // Task was deleted and must leave at its next kernel call
+    bool deleted;
+    // Thread of task ended
+    bool finished;
+    // Notification value
+    uint32_t notifications;
+};
+
+/* Queue or semaphore */
+struct HostQueue
+{
+    // Maximum number of items
+    size_t length;
+    // Size of item, 0 for semaphore
+    size_t itemSize;
+    // Queued items
+    std::deque<std::vector<uint8_t>> items;
+    // Bytes of heap held by queue
+    size_t heap;
+};
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /* Thrown inside deleted task to unwind its thread */
+    struct TaskDeleted
+    {
+    };
+
+    /* State of kernel, one lock guards all objects as single core scheduler */
+    struct Kernel
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+
+        Clock::time_point base = Clock::now();
+        TickType_t baseTicks = 0;
+        std::chrono::microseconds period{1000};
+
+        size_t heap = 0;
+        size_t peak = 0;
+        size_t limit = 0;
+        size_t running = 0;
+    };
+
+    /**
+     * @brief Get kernel. It is never destroyed, so detached tasks may run until process exits
+     */
+    Kernel &GetKernel()
+    {
+        static Kernel *kernel = new Kernel;
+        return *kernel;
+    }
+
+    thread_local HostTask *currentTask = nullptr;
+
+    /**
+     * @brief Get task of calling thread, thread of host gets task on its first call
+     */
+    HostTask *Current()
+    {
+        if (!currentTask)
+            currentTask = new HostTask{"host", 0, false, false, 0};
+
+        return currentTask;
+    }
+
+    /**
+     * @brief Get tick count. Caller holds kernel lock
+     */
+    TickType_t Ticks(const Kernel &kernel)
+    {
+        return kernel.baseTicks + static_cast<TickType_t>((Clock::now() - kernel.base) / kernel.period);
+    }
+
+    /**
+     * @brief Reserve heap. Caller holds kernel lock
+     */
+    bool Allocate(Kernel &kernel, size_t bytes)
+    {
+        if (kernel.limit && kernel.heap + bytes > kernel.limit)
+            return false;
+
+        kernel.heap += bytes;
+        kernel.peak = std::max(kernel.peak, kernel.heap);
+        return true;
+    }
+
+    /**
+     * @brief Wait until condition is met or ticks elapse. Deleted task leaves by exception
+     *
+     * @return bool     : Condition is met
+     */
+    template <typename Condition>
+    bool Wait(std::unique_lock<std::mutex> &lock, TickType_t ticks, Condition condition)
+    {
+        auto &kernel = GetKernel();
+        auto task = Current();
+        auto wake = [&] { return task->deleted || condition(); };
+
+        if (ticks == portMAX_DELAY)
+            kernel.changed.wait(lock, wake);
+        else if (ticks)
+            kernel.changed.wait_until(lock, Clock::now() + ticks * kernel.period, wake);
+
+        if (task->deleted)
+            throw TaskDeleted();
+
+        return condition();
+    }
+
+    /**
+     * @brief Thread of task
+     */
+    void RunTask(HostTask *task, TaskFunction_t function, void *parameters)
+    {
+        currentTask = task;
+
+        try
+        {
+            function(parameters);
+        }
+        catch (const TaskDeleted &)
+        {
+        }
+
+        auto &kernel = GetKernel();
+        std::lock_guard<std::mutex> lock(kernel.mutex);
+        task->finished = true;
+        kernel.heap -= task->heap;
+        --kernel.running;
+        kernel.changed.notify_all();
+    }
+
+    /**
+     * @brief Create queue with heap accounting
+     */
+    QueueHandle_t CreateQueue(size_t length, size_t itemSize, size_t initialItems)
+    {
+        auto &kernel = GetKernel();
+        std::lock_guard<std::mutex> lock(kernel.mutex);
+
+        const size_t heap = Host::QUEUE_CONTROL_SIZE + length * itemSize;
+        if (!Allocate(kernel, heap))
+            return nullptr;
+
+        auto queue = new HostQueue{length, itemSize, {}, heap};
+        for (size_t i = 0; i < initialItems; ++i)
+            queue->items.emplace_back();
+
+        return queue;
+    }
+} // namespace
+
+/*********************************************
+ *              HOST CONTROL                 *
+ ********************************************/
+
+void Host::SetTickPeriod(std::chrono::microseconds period)
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+
+    kernel.baseTicks = Ticks(kernel);
+    kernel.base = Clock::now();
+    kernel.period = period;
+    kernel.changed.notify_all();
+}
+
+std::chrono::microseconds Host::GetTickPeriod()
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return kernel.period;
+}
+
+size_t Host::HeapInUse()
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return kernel.heap;
+}
+
+size_t Host::PeakHeap()
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return kernel.peak;
+}
+
+void Host::ResetPeakHeap()
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    kernel.peak = kernel.heap;
+}
+
+void Host::SetHeapLimit(size_t bytes)
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    kernel.limit = bytes;
+}
+
+size_t Host::RunningTasks()
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return kernel.running;
+}
+
+/*********************************************
+ *                 TASKS                     *
+ ********************************************/
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stackDepth, void *parameters, UBaseType_t,
+                       TaskHandle_t *handle)
+{
+    auto &kernel = GetKernel();
+    HostTask *task{nullptr};
+
+    {
+        std::lock_guard<std::mutex> lock(kernel.mutex);
+
+        // Stack depth is in bytes on ESP-IDF
+        const size_t heap = stackDepth + Host::TASK_CONTROL_BLOCK_SIZE;
+        if (!Allocate(kernel, heap))
+            return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+        task = new HostTask{name ? name : "", heap, false, false, 0};
+        ++kernel.running;
+    }
+
+    if (handle)
+        *handle = task;
+
+    std::thread(RunTask, task, function, parameters).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t)
+{
+    return xTaskCreate(function, name, stackDepth, parameters, priority, handle);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    auto &kernel = GetKernel();
+
+    if (!task || task == Current())
+    {
+        // Task never returns from deleting itself
+        std::lock_guard<std::mutex> lock(kernel.mutex);
+        Current()->deleted = true;
+        throw TaskDeleted();
+    }
+
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+    task->deleted = true;
+    kernel.changed.notify_all();
+
+    // Task leaves at its next kernel call
+    kernel.changed.wait(lock, [task] { return task->finished; });
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    if (!ticks)
+    {
+        std::this_thread::yield();
+        return;
+    }
+
+    auto &kernel = GetKernel();
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+    Wait(lock, ticks, [] { return false; });
+}
+
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment)
+{
+    auto &kernel = GetKernel();
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+
+    const TickType_t wake = *previousWakeTime + increment;
+    const TickType_t now = Ticks(kernel);
+    *previousWakeTime = wake;
+
+    if (static_cast<int32_t>(wake - now) > 0)
+        Wait(lock, wake - now, [] { return false; });
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return Ticks(kernel);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return Current();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticks)
+{
+    auto &kernel = GetKernel();
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+
+    auto task = Current();
+    if (!Wait(lock, ticks, [task] { return task->notifications > 0; }))
+        return 0;
+
+    const uint32_t value = task->notifications;
+    task->notifications = clearCountOnExit ? 0 : value - 1;
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+
+    ++task->notifications;
+    kernel.changed.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdFALSE;
+}
+
+void taskYIELD(void)
+{
+    std::this_thread::yield();
+}
+
+/*********************************************
+ *                 QUEUES                    *
+ ********************************************/
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    return CreateQueue(length, itemSize, 0);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    auto &kernel = GetKernel();
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+
+    if (!Wait(lock, ticks, [queue] { return queue->items.size() < queue->length; }))
+        return errQUEUE_FULL;
+
+    const auto bytes = static_cast<const uint8_t *>(item);
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    kernel.changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+    return xQueueSend(queue, item, ticks);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    auto &kernel = GetKernel();
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+
+    if (!Wait(lock, ticks, [queue] { return !queue->items.empty(); }))
+        return pdFALSE;
+
+    if (queue->itemSize)
+        std::memcpy(item, queue->items.front().data(), queue->itemSize);
+
+    queue->items.pop_front();
+    kernel.changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+    auto &kernel = GetKernel();
+    std::unique_lock<std::mutex> lock(kernel.mutex);
+
+    if (!Wait(lock, ticks, [queue] { return !queue->items.empty(); }))
+        return pdFALSE;
+
+    if (queue->itemSize)
+        std::memcpy(item, queue->items.front().data(), queue->itemSize);
+
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return static_cast<UBaseType_t>(queue->items.size());
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+    auto &kernel = GetKernel();
+    std::lock_guard<std::mutex> lock(kernel.mutex);
+    return static_cast<UBaseType_t>(queue->length - queue->items.size());
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    auto &kernel = GetKernel();
+    {
+        std::lock_guard<std::mutex> lock(kernel.mutex);
+        kernel.heap -= queue->heap;
+    }
+
+    delete queue;
+}
+
+/*********************************************
+ *               SEMAPHORES                  *
+ ********************************************/
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return CreateQueue(1, 0, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return CreateQueue(1, 0, 1);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    return xQueueReceive(semaphore, nullptr, ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    vQueueDelete(semaphore);
+}
@@ -0,0 +1,56 @@
+/**
+ * Control of ADC, GPIO, I2C and NVS of host build used by tests
+ *
+ * ADC returns samples of source set by test, every channel reads the same source. GPIO keeps output levels
+ * and reports their changes to observer. I2C master transactions are answered by device set by test, every
+ * port reaches the same device. NVS keeps blobs in memory of process until it is erased.
+ */
+#ifndef HOST_PERIPHERALS_H
+#define HOST_PERIPHERALS_H
+
+#include "driver/gpio.h"
+#include "esp_err.h"
+
+/* STD library */
+#include <cstddef>
+#include <functional>
+
+namespace Host
+{
+    /**
+     * @brief Set source of ADC samples. Negative sample is failed reading, no source reads failures
+     */
+    void SetAdcSource(std::function<int()> source);
+
+    /**
+     * @brief Get number of ADC readings since start of process
+     */
+    size_t AdcReadings();
+
+    /**
+     * @brief Observer of GPIO output, called in order of changes by thread which set level
+     */
+    using GpioObserver = std::function<void(gpio_num_t gpio, uint32_t level)>;
+
+    /**
+     * @brief Set observer of GPIO output, it must not set levels itself
+     */
+    void SetGpioObserver(GpioObserver observer);
+
+    /**
+     * @brief Device on I2C bus. Gets written bytes and fills read bytes, result is returned by transaction
+     */
+    using I2CDevice = std::function<esp_err_t(uint8_t address, const uint8_t *write, size_t writeSize, uint8_t *read, size_t readSize)>;
+
+    /**
+     * @brief Set device answering I2C transactions, no device fails every transaction
+     */
+    void SetI2CDevice(I2CDevice device);
+
+    /**
+     * @brief Erase all namespaces of NVS
+     */
+    void EraseNvs();
+} // namespace Host
+
+#endif // HOST_PERIPHERALS_H
@@ -0,0 +1,58 @@
+/**
+ * Control of FreeRTOS of host build used by tests
+ *
+ * Heap accounting follows allocations of kernel objects on target: task allocates its stack and
+ * control block, queue allocates its storage. Creation fails when limit of heap would be exceeded.
+ */
+#ifndef HOST_RTOS_H
+#define HOST_RTOS_H
+
+/* STD library */
+#include <chrono>
+#include <cstddef>
+
+namespace Host
+{
+    // Size of task control block allocated with every task
+    constexpr size_t TASK_CONTROL_BLOCK_SIZE = 360;
+
+    // Size of queue control structure allocated with every queue and semaphore
+    constexpr size_t QUEUE_CONTROL_SIZE = 84;
+
+    /**
+     * @brief Set real duration of one tick. Shorter tick runs tick based delays faster
+     */
+    void SetTickPeriod(std::chrono::microseconds period);
+
+    /**
+     * @brief Get real duration of one tick
+     */
+    std::chrono::microseconds GetTickPeriod();
+
+    /**
+     * @brief Get bytes of heap used by kernel objects
+     */
+    size_t HeapInUse();
+
+    /**
+     * @brief Get the highest heap usage since the last reset
+     */
+    size_t PeakHeap();
+
+    /**
+     * @brief Start new measurement of peak heap from current usage
+     */
+    void ResetPeakHeap();
+
+    /**
+     * @brief Set limit of heap for kernel objects, 0 disables limit
+     */
+    void SetHeapLimit(size_t bytes);
+
+    /**
+     * @brief Get number of running tasks
+     */
+    size_t RunningTasks();
+} // namespace Host
+
+#endif // HOST_RTOS_H
@@ -0,0 +1,310 @@
+/* Host stubs */
+#include "HostPeripherals.hpp"
+#include "driver/adc.h"
+#include "driver/i2c.h"
+#include "nvs.h"
+
+/* STD library */
+#include <array>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Adc
+    {
+        std::mutex mutex;
+        std::function<int()> source;
+        size_t readings{0};
+    };
+
+    Adc &GetAdc()
+    {
+        static Adc adc;
+        return adc;
+    }
+
+    int Sample()
+    {
+        auto &adc = GetAdc();
+        std::lock_guard<std::mutex> lock(adc.mutex);
+
+        ++adc.readings;
+        return adc.source ? adc.source() : -1;
+    }
+
+    struct Gpio
+    {
+        std::mutex mutex;
+        std::array<uint32_t, GPIO_NUM_MAX> levels{};
+        Host::GpioObserver observer;
+    };
+
+    Gpio &GetGpio()
+    {
+        static Gpio gpio;
+        return gpio;
+    }
+
+    struct I2CBus
+    {
+        std::mutex mutex;
+        Host::I2CDevice device;
+    };
+
+    I2CBus &GetI2CBus()
+    {
+        static I2CBus bus;
+        return bus;
+    }
+
+    esp_err_t Transfer(uint8_t address, const uint8_t *write, size_t writeSize, uint8_t *read, size_t readSize)
+    {
+        auto &bus = GetI2CBus();
+        std::lock_guard<std::mutex> lock(bus.mutex);
+
+        return bus.device ? bus.device(address, write, writeSize, read, readSize) : ESP_FAIL;
+    }
+
+    /* Open handle of NVS */
+    struct Handle
+    {
+        std::string name;
+        bool writable;
+        // Blobs set through handle, written by commit
+        std::map<std::string, std::vector<uint8_t>> pending;
+    };
+
+    struct Nvs
+    {
+        std::mutex mutex;
+        std::map<std::string, std::map<std::string, std::vector<uint8_t>>> namespaces;
+        std::map<nvs_handle_t, Handle> handles;
+        nvs_handle_t next{1};
+    };
+
+    Nvs &GetNvs()
+    {
+        static Nvs nvs;
+        return nvs;
+    }
+} // namespace
+
+void Host::SetAdcSource(std::function<int()> source)
+{
+    auto &adc = GetAdc();
+    std::lock_guard<std::mutex> lock(adc.mutex);
+    adc.source = std::move(source);
+}
+
+size_t Host::AdcReadings()
+{
+    auto &adc = GetAdc();
+    std::lock_guard<std::mutex> lock(adc.mutex);
+    return adc.readings;
+}
+
+void Host::SetGpioObserver(GpioObserver observer)
+{
+    auto &gpio = GetGpio();
+    std::lock_guard<std::mutex> lock(gpio.mutex);
+    gpio.observer = std::move(observer);
+}
+
+void Host::SetI2CDevice(I2CDevice device)
+{
+    auto &bus = GetI2CBus();
+    std::lock_guard<std::mutex> lock(bus.mutex);
+    bus.device = std::move(device);
+}
+
+void Host::EraseNvs()
+{
+    auto &nvs = GetNvs();
+    std::lock_guard<std::mutex> lock(nvs.mutex);
+    nvs.namespaces.clear();
+}
+
+int adc1_get_raw(adc1_channel_t)
+{
+    return Sample();
+}
+
+esp_err_t adc2_get_raw(adc2_channel_t, adc_bits_width_t, int *raw)
+{
+    const int sample = Sample();
+    if (sample < 0)
+        return ESP_ERR_TIMEOUT;
+
+    *raw = sample;
+    return ESP_OK;
+}
+
+esp_err_t adc1_pad_get_io_num(adc1_channel_t channel, gpio_num_t *gpio)
+{
+    // GPIO 36 to 39 and 32 to 35 on target, only distinct numbers matter on host
+    *gpio = static_cast<gpio_num_t>(30 + channel);
+    return ESP_OK;
+}
+
+esp_err_t adc2_pad_get_io_num(adc2_channel_t channel, gpio_num_t *gpio)
+{
+    *gpio = static_cast<gpio_num_t>(channel);
+    return ESP_OK;
+}
+
+esp_err_t adc1_config_channel_atten(adc1_channel_t, adc_atten_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t adc2_config_channel_atten(adc2_channel_t, adc_atten_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_config(const gpio_config_t *)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t pin, uint32_t level)
+{
+    if (pin < GPIO_NUM_0 || pin >= GPIO_NUM_MAX)
+        return ESP_ERR_INVALID_ARG;
+
+    auto &gpio = GetGpio();
+    std::lock_guard<std::mutex> lock(gpio.mutex);
+
+    // Observer is called under lock, so it sees changes in order
+    gpio.levels[pin] = level ? 1 : 0;
+    if (gpio.observer)
+        gpio.observer(pin, gpio.levels[pin]);
+
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t pin)
+{
+    if (pin < GPIO_NUM_0 || pin >= GPIO_NUM_MAX)
+        return 0;
+
+    auto &gpio = GetGpio();
+    std::lock_guard<std::mutex> lock(gpio.mutex);
+    return static_cast<int>(gpio.levels[pin]);
+}
+
+esp_err_t i2c_param_config(i2c_port_t, const i2c_config_t *)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_install(i2c_port_t, i2c_mode_t, size_t, size_t, int)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_delete(i2c_port_t)
+{
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write_to_device(i2c_port_t, uint8_t address, const uint8_t *write, size_t writeSize, TickType_t)
+{
+    return Transfer(address, write, writeSize, nullptr, 0);
+}
+
+esp_err_t i2c_master_read_from_device(i2c_port_t, uint8_t address, uint8_t *read, size_t readSize, TickType_t)
+{
+    return Transfer(address, nullptr, 0, read, readSize);
+}
+
+esp_err_t i2c_master_write_read_device(i2c_port_t, uint8_t address, const uint8_t *write, size_t writeSize, uint8_t *read,
+                                       size_t readSize, TickType_t)
+{
+    return Transfer(address, write, writeSize, read, readSize);
+}
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *handle)
+{
+    auto &nvs = GetNvs();
+    std::lock_guard<std::mutex> lock(nvs.mutex);
+
+    // Namespace which was never written can not be opened for reading
+    if (mode == NVS_READONLY && !nvs.namespaces.count(name))
+        return ESP_ERR_NVS_NOT_FOUND;
+
+    *handle = nvs.next++;
+    nvs.handles[*handle] = {name, mode == NVS_READWRITE, {}};
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *value, size_t *length)
+{
+    auto &nvs = GetNvs();
+    std::lock_guard<std::mutex> lock(nvs.mutex);
+
+    auto it = nvs.handles.find(handle);
+    if (it == nvs.handles.end())
+        return ESP_ERR_INVALID_ARG;
+
+    const auto &blobs = nvs.namespaces[it->second.name];
+    auto blob = blobs.find(key);
+    if (blob == blobs.end())
+        return ESP_ERR_NVS_NOT_FOUND;
+
+    // Null value asks only for length
+    if (!value)
+    {
+        *length = blob->second.size();
+        return ESP_OK;
+    }
+
+    if (*length < blob->second.size())
+        return ESP_ERR_INVALID_SIZE;
+
+    std::memcpy(value, blob->second.data(), blob->second.size());
+    *length = blob->second.size();
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    auto &nvs = GetNvs();
+    std::lock_guard<std::mutex> lock(nvs.mutex);
+
+    auto it = nvs.handles.find(handle);
+    if (it == nvs.handles.end() || !it->second.writable)
+        return ESP_ERR_INVALID_ARG;
+
+    const auto bytes = static_cast<const uint8_t *>(value);
+    it->second.pending[key] = std::vector<uint8_t>(bytes, bytes + length);
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    auto &nvs = GetNvs();
+    std::lock_guard<std::mutex> lock(nvs.mutex);
+
+    auto it = nvs.handles.find(handle);
+    if (it == nvs.handles.end())
+        return ESP_ERR_INVALID_ARG;
+
+    auto &blobs = nvs.namespaces[it->second.name];
+    for (auto &blob : it->second.pending)
+        blobs[blob.first] = std::move(blob.second);
+    it->second.pending.clear();
+
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    auto &nvs = GetNvs();
+    std::lock_guard<std::mutex> lock(nvs.mutex);
+    nvs.handles.erase(handle);
+}
@@ -0,0 +1,30 @@
+#ifndef HOST_CJSON_H
+#define HOST_CJSON_H
+
+/* Types and item of cJSON, trees are built by tests without library */
+#define cJSON_Invalid (0)
+#define cJSON_False (1 << 0)
+#define cJSON_True (1 << 1)
+#define cJSON_NULL (1 << 2)
+#define cJSON_Number (1 << 3)
+#define cJSON_String (1 << 4)
+#define cJSON_Array (1 << 5)
+#define cJSON_Object (1 << 6)
+#define cJSON_Raw (1 << 7)
+
+#define cJSON_IsReference 256
+#define cJSON_StringIsConst 512
+
+typedef struct cJSON
+{
+    struct cJSON *next;
+    struct cJSON *prev;
+    struct cJSON *child;
+    int type;
+    char *valuestring;
+    int valueint;
+    double valuedouble;
+    char *string;
+} cJSON;
+
+#endif // HOST_CJSON_H
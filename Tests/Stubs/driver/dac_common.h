@@ -0,0 +1,6 @@
+#ifndef HOST_DRIVER_DAC_COMMON_H
+#define HOST_DRIVER_DAC_COMMON_H
+
+#include "driver/gpio.h"
+
+#endif // HOST_DRIVER_DAC_COMMON_H
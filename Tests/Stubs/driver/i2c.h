@@ -0,0 +1,55 @@
+#ifndef HOST_DRIVER_I2C_H
+#define HOST_DRIVER_I2C_H
+
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/* STD library */
+#include <cstddef>
+#include <cstdint>
+
+typedef enum
+{
+    I2C_MODE_SLAVE = 0,
+    I2C_MODE_MASTER,
+    I2C_MODE_MAX,
+} i2c_mode_t;
+
+typedef int i2c_port_t;
+
+#define I2C_NUM_0 (0)
+#define I2C_NUM_1 (1)
+
+typedef struct
+{
+    i2c_mode_t mode;
+    int sda_io_num;
+    int scl_io_num;
+    bool sda_pullup_en;
+    bool scl_pullup_en;
+    union
+    {
+        struct
+        {
+            uint32_t clk_speed;
+        } master;
+        struct
+        {
+            uint8_t addr_10bit_en;
+            uint16_t slave_addr;
+            uint32_t maximum_speed;
+        } slave;
+    };
+    uint32_t clk_flags;
+} i2c_config_t;
+
+esp_err_t i2c_param_config(i2c_port_t port, const i2c_config_t *config);
+esp_err_t i2c_driver_install(i2c_port_t port, i2c_mode_t mode, size_t slaveRxBuffer, size_t slaveTxBuffer, int interruptFlags);
+esp_err_t i2c_driver_delete(i2c_port_t port);
+esp_err_t i2c_master_write_to_device(i2c_port_t port, uint8_t address, const uint8_t *write, size_t writeSize, TickType_t ticks);
+esp_err_t i2c_master_read_from_device(i2c_port_t port, uint8_t address, uint8_t *read, size_t readSize, TickType_t ticks);
+esp_err_t i2c_master_write_read_device(i2c_port_t port, uint8_t address, const uint8_t *write, size_t writeSize, uint8_t *read,
+                                       size_t readSize, TickType_t ticks);
+
+#endif // HOST_DRIVER_I2C_H
@@ -0,0 +1,26 @@
+#ifndef HOST_ESP_BT_DEFS_H
+#define HOST_ESP_BT_DEFS_H
+
+/* STD library */
+#include <cstdint>
+
+#define ESP_BD_ADDR_LEN 6
+
+typedef uint8_t esp_bd_addr_t[ESP_BD_ADDR_LEN];
+
+#define ESP_UUID_LEN_16 2
+#define ESP_UUID_LEN_32 4
+#define ESP_UUID_LEN_128 16
+
+typedef struct
+{
+    uint16_t len;
+    union
+    {
+        uint16_t uuid16;
+        uint32_t uuid32;
+        uint8_t uuid128[ESP_UUID_LEN_128];
+    } uuid;
+} __attribute__((packed)) esp_bt_uuid_t;
+
+#endif // HOST_ESP_BT_DEFS_H
@@ -0,0 +1,63 @@
+#ifndef HOST_ESP_GAP_BLE_API_H
+#define HOST_ESP_GAP_BLE_API_H
+
+#include "esp_bt_defs.h"
+
+typedef enum
+{
+    ESP_GAP_BLE_ADV_DATA_SET_COMPLETE_EVT = 0,
+    ESP_GAP_BLE_SCAN_RSP_DATA_SET_COMPLETE_EVT = 1,
+    ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT = 2,
+    ESP_GAP_BLE_SCAN_RESULT_EVT = 3,
+    ESP_GAP_BLE_ADV_START_COMPLETE_EVT = 6,
+    ESP_GAP_BLE_SCAN_START_COMPLETE_EVT = 7,
+    ESP_GAP_BLE_SCAN_STOP_COMPLETE_EVT = 18,
+    ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT = 20,
+} esp_gap_ble_cb_event_t;
+
+typedef enum
+{
+    ESP_GAP_SEARCH_INQ_RES_EVT = 0,
+    ESP_GAP_SEARCH_INQ_CMPL_EVT = 1,
+    ESP_GAP_SEARCH_DISC_RES_EVT = 2,
+    ESP_GAP_SEARCH_DISC_BLE_RES_EVT = 3,
+    ESP_GAP_SEARCH_DISC_CMPL_EVT = 4,
+    ESP_GAP_SEARCH_DI_DISC_CMPL_EVT = 5,
+    ESP_GAP_SEARCH_SEARCH_CANCEL_CMPL_EVT = 6,
+    ESP_GAP_SEARCH_INQ_DISCARD_NUM_EVT = 7,
+} esp_gap_search_evt_t;
+
+typedef enum
+{
+    BLE_SCAN_TYPE_PASSIVE = 0,
+    BLE_SCAN_TYPE_ACTIVE = 1,
+} esp_ble_scan_type_t;
+
+typedef enum
+{
+    BLE_ADDR_TYPE_PUBLIC = 0,
+    BLE_ADDR_TYPE_RANDOM = 1,
+} esp_ble_addr_type_t;
+
+typedef enum
+{
+    BLE_SCAN_FILTER_ALLOW_ALL = 0,
+} esp_ble_scan_filter_t;
+
+typedef enum
+{
+    BLE_SCAN_DUPLICATE_DISABLE = 0,
+    BLE_SCAN_DUPLICATE_ENABLE = 1,
+} esp_ble_scan_duplicate_t;
+
+typedef struct
+{
+    esp_ble_scan_type_t scan_type;
+    esp_ble_addr_type_t own_addr_type;
+    esp_ble_scan_filter_t scan_filter_policy;
+    uint16_t scan_interval;
+    uint16_t scan_window;
+    esp_ble_scan_duplicate_t scan_duplicate;
+} esp_ble_scan_params_t;
+
+#endif // HOST_ESP_GAP_BLE_API_H
@@ -0,0 +1,37 @@
+#ifndef HOST_ESP_GATT_DEFS_H
+#define HOST_ESP_GATT_DEFS_H
+
+#include "esp_bt_defs.h"
+
+#define ESP_GATT_UUID_CHAR_CLIENT_CONFIG 0x2902
+
+typedef uint8_t esp_gatt_if_t;
+typedef uint16_t esp_gatt_perm_t;
+typedef uint8_t esp_gatt_char_prop_t;
+
+typedef struct
+{
+    esp_bt_uuid_t uuid;
+    uint8_t inst_id;
+} __attribute__((packed)) esp_gatt_id_t;
+
+typedef struct
+{
+    esp_gatt_id_t id;
+    bool is_primary;
+} __attribute__((packed)) esp_gatt_srvc_id_t;
+
+typedef struct
+{
+    uint16_t char_handle;
+    esp_gatt_char_prop_t properties;
+    esp_bt_uuid_t uuid;
+} esp_gattc_char_elem_t;
+
+typedef struct
+{
+    uint16_t handle;
+    esp_bt_uuid_t uuid;
+} esp_gattc_descr_elem_t;
+
+#endif // HOST_ESP_GATT_DEFS_H
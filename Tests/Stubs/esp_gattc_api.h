@@ -0,0 +1,23 @@
+#ifndef HOST_ESP_GATTC_API_H
+#define HOST_ESP_GATTC_API_H
+
+#include "esp_gatt_defs.h"
+
+typedef enum
+{
+    ESP_GATTC_REG_EVT = 0,
+    ESP_GATTC_OPEN_EVT = 2,
+    ESP_GATTC_WRITE_CHAR_EVT = 4,
+    ESP_GATTC_SEARCH_CMPL_EVT = 6,
+    ESP_GATTC_SEARCH_RES_EVT = 7,
+    ESP_GATTC_CFG_MTU_EVT = 18,
+    ESP_GATTC_CONNECT_EVT = 40,
+    ESP_GATTC_DIS_SRVC_CMPL_EVT = 46,
+} esp_gattc_cb_event_t;
+
+/* Parameters of client events are not used by host tests */
+typedef union esp_ble_gattc_cb_param_t esp_ble_gattc_cb_param_t;
+
+typedef void (*esp_gattc_cb_t)(esp_gattc_cb_event_t event, esp_gatt_if_t gattc_if, esp_ble_gattc_cb_param_t *param);
+
+#endif // HOST_ESP_GATTC_API_H
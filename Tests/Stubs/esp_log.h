@@ -0,0 +1,50 @@
+/**
+ * Logging of host build. Messages are printed only when environment variable HOST_LOG is set,
+ * so benchmarks are not slowed down by output
+ */
+#ifndef HOST_ESP_LOG_H
+#define HOST_ESP_LOG_H
+
+/* STD library */
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+#include "esp_err.h"
+
+typedef enum
+{
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+__attribute__((format(printf, 3, 4))) inline void HostLog(char level, const char *tag, const char *format, ...)
+{
+    static const bool enabled = std::getenv("HOST_LOG") != nullptr;
+    if (!enabled)
+        return;
+
+    std::printf("%c (%s) ", level, tag);
+
+    va_list arguments;
+    va_start(arguments, format);
+    std::vprintf(format, arguments);
+    va_end(arguments);
+
+    std::printf("\n");
+}
+
+#define ESP_LOGE(tag, format, ...) HostLog('E', tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) HostLog('W', tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) HostLog('I', tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) HostLog('D', tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) HostLog('V', tag, format, ##__VA_ARGS__)
+
+#define ESP_LOG_BUFFER_HEX_LEVEL(tag, buffer, length, level) (void)0
+#define ESP_LOG_BUFFER_HEX(tag, buffer, length) (void)0
+
+#endif // HOST_ESP_LOG_H
@@ -0,0 +1,12 @@
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+/* STD library */
+#include <cstdint>
+
+/**
+ * @brief Get time in microseconds since start of host process
+ */
+int64_t esp_timer_get_time(void);
+
+#endif // HOST_ESP_TIMER_H
@@ -0,0 +1,48 @@
+/**
+ * FreeRTOS of host build
+ *
+ * Tasks run as threads of host. Tick period is 1 ms by default and tests may shorten it to simulate
+ * long sensor delays quickly. Priorities are accepted but not applied.
+ */
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+/* STD library */
+#include <cstddef>
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define errQUEUE_FULL pdFALSE
+#define errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY (-1)
+
+#define configTICK_RATE_HZ 1000
+#define configMAX_PRIORITIES 25
+#define configMINIMAL_STACK_SIZE 768
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define portTICK_RATE_MS portTICK_PERIOD_MS
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((TickType_t)(ms) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+
+#define tskIDLE_PRIORITY ((UBaseType_t)0U)
+
+typedef struct
+{
+    int owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) (void)(mux)
+#define portEXIT_CRITICAL(mux) (void)(mux)
+#define taskENTER_CRITICAL(mux) (void)(mux)
+#define taskEXIT_CRITICAL(mux) (void)(mux)
+#define portYIELD_FROM_ISR() (void)0
+
+#endif // HOST_FREERTOS_H
@@ -0,0 +1,61 @@
+/**
+ * Configuration of host build, values follow defaults of Kconfig.
+ * Test target may override value with compile definition.
+ */
+#ifndef HOST_SDKCONFIG_H
+#define HOST_SDKCONFIG_H
+
+#define CONFIG_FREERTOS_HZ 1000
+
+/* Common components */
+#ifndef CONFIG_JSON_Number_Precision
+#define CONFIG_JSON_Number_Precision 3
+#endif
+
+/* Server */
+#ifndef CONFIG_BTDM_CTRL_BLE_MAX_CONN_EFF
+#define CONFIG_BTDM_CTRL_BLE_MAX_CONN_EFF 3
+#endif
+
+#ifndef CONFIG_EVENT_QUEUE_DEPTH
+#define CONFIG_EVENT_QUEUE_DEPTH 16
+#endif
+
+#ifndef CONFIG_EVENT_MAX_OBSERVERS
+#define CONFIG_EVENT_MAX_OBSERVERS 4
+#endif
+
+#ifndef CONFIG_BLUETOOTH_EVENT_POOL_SIZE
+#define CONFIG_BLUETOOTH_EVENT_POOL_SIZE 8
+#endif
+
+#ifndef CONFIG_WATER_LEVEL_SDA
+#define CONFIG_WATER_LEVEL_SDA 21
+#endif
+
+#ifndef CONFIG_WATER_LEVEL_SCL
+#define CONFIG_WATER_LEVEL_SCL 22
+#endif
+
+#ifndef CONFIG_WATER_LEVEL_ADDRESS
+#define CONFIG_WATER_LEVEL_ADDRESS 0x77
+#endif
+
+#ifndef CONFIG_WATER_LEVEL_THRESHOLD
+#define CONFIG_WATER_LEVEL_THRESHOLD 10
+#endif
+
+#ifndef CONFIG_WATER_LEVEL_HYSTERESIS
+#define CONFIG_WATER_LEVEL_HYSTERESIS 5
+#endif
+
+#ifndef CONFIG_WATER_LEVEL_PERIOD_MS
+#define CONFIG_WATER_LEVEL_PERIOD_MS 20
+#endif
+
+/* Client */
+#ifndef CONFIG_SENSOR_CRC_RETRIES
+#define CONFIG_SENSOR_CRC_RETRIES 2
+#endif
+
+#endif // HOST_SDKCONFIG_H
@@ -0,0 +1,36 @@
+/**
+ * Model of bytes on air of sensor frame sent as one characteristic write with response
+ */
+#ifndef TEST_AIR_TIME_H
+#define TEST_AIR_TIME_H
+
+/* STD library */
+#include <cstddef>
+
+namespace Benchmark
+{
+    // MTU before exchange, GATT_DEFAULT_MTU of bluetooth definitions
+    constexpr size_t DEFAULT_MTU = 23;
+
+    // MTU negotiated by greenhouse client and server
+    constexpr size_t NEGOTIATED_MTU = 185;
+
+    // ATT write request header, ATT_WRITE_HEADER_SIZE of bluetooth definitions
+    constexpr size_t ATT_WRITE_HEADER = 3;
+
+    // Link layer and L2CAP headers of every PDU
+    constexpr size_t LINK_HEADERS = 2 + 4;
+
+    // ATT write response, write is sent with response
+    constexpr size_t ATT_WRITE_RESPONSE = 1;
+
+    /**
+     * @brief Get bytes on air of write request carrying frame and its response
+     */
+    constexpr size_t WriteBytesOnAir(size_t frame)
+    {
+        return LINK_HEADERS + ATT_WRITE_HEADER + frame + LINK_HEADERS + ATT_WRITE_RESPONSE;
+    }
+} // namespace Benchmark
+
+#endif // TEST_AIR_TIME_H
@@ -0,0 +1,68 @@
+/* Test framework */
+#include "Support/AllocationCounter.hpp"
+
+/* STD library */
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<size_t> allocations{0};
+
+    void *Allocate(size_t size)
+    {
+        ++allocations;
+        if (void *memory = std::malloc(size ? size : 1))
+            return memory;
+
+        throw std::bad_alloc();
+    }
+} // namespace
+
+size_t Allocation::Count()
+{
+    return allocations;
+}
+
+void *operator new(size_t size)
+{
+    return Allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+    return Allocate(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    ++allocations;
+    return std::malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    ++allocations;
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,33 @@
+/**
+ * Counter of heap allocations of host tests
+ *
+ * Global operator new is replaced in AllocationCounter.cpp, target which links it counts every allocation
+ * of the process. Counting is meant for code running on the test thread while other tasks are idle.
+ */
+#ifndef TEST_ALLOCATION_COUNTER_H
+#define TEST_ALLOCATION_COUNTER_H
+
+/* STD library */
+#include <cstddef>
+
+namespace Allocation
+{
+    /**
+     * @brief Get number of allocations since start of process
+     */
+    size_t Count();
+
+    /* Number of allocations made during lifetime of scope */
+    class Scope
+    {
+    public:
+        Scope() : mStart(Count()) {}
+
+        size_t Allocations() const { return Count() - mStart; }
+
+    private:
+        size_t mStart;
+    };
+} // namespace Allocation
+
+#endif // TEST_ALLOCATION_COUNTER_H
@@ -0,0 +1,54 @@
+/**
+ * Helpers of host benchmarks
+ *
+ * Benchmarks report numbers on standard output. Time depends on host, so benchmarks assert only
+ * deterministic results like sizes and counts.
+ */
+#ifndef TEST_BENCHMARK_H
+#define TEST_BENCHMARK_H
+
+/* STD library */
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace Benchmark
+{
+    /**
+     * @brief Keep value alive, so compiler can not remove its computation
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief Measure average time of one call
+     *
+     * @param[in] iterations    : Number of calls
+     * @param[in] function      : Measured function, called with index of iteration
+     *
+     * @return double           : Nanoseconds per call
+     */
+    template <typename Function>
+    double NanosecondsPerCall(size_t iterations, Function function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            function(i);
+        const auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    }
+
+    /**
+     * @brief Print one row of benchmark report
+     */
+    inline void Report(const char *name, double value, const char *unit)
+    {
+        std::printf("[ BENCHMARK] %-48s %12.2f %s\n", name, value, unit);
+    }
+} // namespace Benchmark
+
+#endif // TEST_BENCHMARK_H
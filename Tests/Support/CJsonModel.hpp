@@ -0,0 +1,259 @@
+/**
+ * Model of cJSON library for host benchmarks
+ *
+ * Host stub of cJSON has no functions, so the previous payload path of network manager is modelled here
+ * after cJSON 1.7. Every item, key and string value is separate heap allocation, cJSON_Print formats
+ * indented text into buffer starting at 256 bytes which is grown and finally shrunk by reallocation,
+ * and numbers are printed with %1.15g, or with %1.17g when text does not read back to the same value.
+ * Memory is taken with new, so AllocationCounter counts it; reallocation counts as one allocation.
+ */
+#ifndef TEST_CJSON_MODEL_H
+#define TEST_CJSON_MODEL_H
+
+/* Host stubs */
+#include <cJSON.h>
+
+/* STD library */
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace CJsonModel
+{
+    /**
+     * @brief Copy string into new allocation
+     */
+    inline char *Duplicate(const char *text)
+    {
+        const size_t length = std::strlen(text) + 1;
+        auto copy = new char[length];
+        std::memcpy(copy, text, length);
+        return copy;
+    }
+
+    /* Output buffer of cJSON_Print */
+    struct PrintBuffer
+    {
+        char *buffer;
+        size_t length;
+        size_t offset;
+        size_t depth;
+    };
+
+    /**
+     * @brief Reallocate buffer to new length
+     */
+    inline void Reallocate(PrintBuffer &print, size_t length)
+    {
+        auto buffer = new char[length];
+        std::memcpy(buffer, print.buffer, print.offset);
+        delete[] print.buffer;
+        print.buffer = buffer;
+        print.length = length;
+    }
+
+    /**
+     * @brief Make space for given number of characters and terminating zero
+     */
+    inline char *Ensure(PrintBuffer &print, size_t needed)
+    {
+        needed += print.offset + 1;
+        if (needed > print.length)
+            Reallocate(print, needed * 2);
+
+        return print.buffer + print.offset;
+    }
+
+    inline void Append(PrintBuffer &print, const char *text, size_t length)
+    {
+        std::memcpy(Ensure(print, length), text, length);
+        print.offset += length;
+    }
+
+    inline void Append(PrintBuffer &print, char character) { Append(print, &character, 1); }
+
+    inline void PrintNumber(const cJSON *item, PrintBuffer &print)
+    {
+        char number[26];
+        const double value = item->valuedouble;
+        int length;
+
+        if (std::isnan(value) || std::isinf(value))
+        {
+            length = std::snprintf(number, sizeof(number), "null");
+        }
+        else if (value == item->valueint)
+        {
+            length = std::snprintf(number, sizeof(number), "%d", item->valueint);
+        }
+        else
+        {
+            length = std::snprintf(number, sizeof(number), "%1.15g", value);
+
+            double test = 0;
+            if (std::sscanf(number, "%lg", &test) != 1 || test != value)
+                length = std::snprintf(number, sizeof(number), "%1.17g", value);
+        }
+
+        Append(print, number, static_cast<size_t>(length));
+    }
+
+    inline void PrintString(const char *text, PrintBuffer &print)
+    {
+        Append(print, '"');
+        for (auto character = text; *character; ++character)
+        {
+            if (*character == '"' || *character == '\\')
+                Append(print, '\\');
+            Append(print, *character);
+        }
+        Append(print, '"');
+    }
+
+    inline void PrintIndent(PrintBuffer &print, size_t depth)
+    {
+        for (size_t i = 0; i < depth; ++i)
+            Append(print, '\t');
+    }
+
+    inline void PrintValue(const cJSON *item, PrintBuffer &print)
+    {
+        switch (item->type & 0xFF)
+        {
+        case cJSON_NULL:
+            Append(print, "null", 4);
+            break;
+        case cJSON_False:
+            Append(print, "false", 5);
+            break;
+        case cJSON_True:
+            Append(print, "true", 4);
+            break;
+        case cJSON_Number:
+            PrintNumber(item, print);
+            break;
+        case cJSON_String:
+            PrintString(item->valuestring, print);
+            break;
+        case cJSON_Array:
+        case cJSON_Object:
+        {
+            const bool object = (item->type & 0xFF) == cJSON_Object;
+            Append(print, object ? '{' : '[');
+            ++print.depth;
+            if (object)
+                Append(print, '\n');
+
+            for (auto child = item->child; child; child = child->next)
+            {
+                if (object)
+                {
+                    PrintIndent(print, print.depth);
+                    PrintString(child->string, print);
+                    Append(print, ":\t", 2);
+                }
+
+                PrintValue(child, print);
+
+                if (child->next)
+                    Append(print, object ? "," : ", ", object ? 1 : 2);
+                if (object)
+                    Append(print, '\n');
+            }
+
+            --print.depth;
+            if (object)
+                PrintIndent(print, print.depth);
+            Append(print, object ? '}' : ']');
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    inline cJSON *NewItem(int type)
+    {
+        auto item = new cJSON{};
+        item->type = type;
+        return item;
+    }
+
+    inline void AddItem(cJSON *parent, const char *key, cJSON *item)
+    {
+        if (key)
+            item->string = Duplicate(key);
+
+        if (!parent->child)
+        {
+            parent->child = item;
+            item->prev = item;
+            return;
+        }
+
+        auto last = parent->child->prev;
+        last->next = item;
+        item->prev = last;
+        parent->child->prev = item;
+    }
+} // namespace CJsonModel
+
+inline cJSON *cJSON_CreateObject() { return CJsonModel::NewItem(cJSON_Object); }
+
+inline cJSON *cJSON_CreateArray() { return CJsonModel::NewItem(cJSON_Array); }
+
+inline cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number)
+{
+    auto item = CJsonModel::NewItem(cJSON_Number);
+    item->valuedouble = number;
+    item->valueint = number >= 2147483647.0 ? 2147483647 : number <= -2147483648.0 ? -2147483647 - 1 : static_cast<int>(number);
+    CJsonModel::AddItem(object, name, item);
+    return item;
+}
+
+inline cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string)
+{
+    auto item = CJsonModel::NewItem(cJSON_String);
+    item->valuestring = CJsonModel::Duplicate(string);
+    CJsonModel::AddItem(object, name, item);
+    return item;
+}
+
+inline cJSON *cJSON_AddObjectToObject(cJSON *object, const char *name)
+{
+    auto item = cJSON_CreateObject();
+    CJsonModel::AddItem(object, name, item);
+    return item;
+}
+
+inline void cJSON_AddItemToArray(cJSON *array, cJSON *item) { CJsonModel::AddItem(array, nullptr, item); }
+
+inline char *cJSON_Print(const cJSON *item)
+{
+    CJsonModel::PrintBuffer print{new char[256], 256, 0, 0};
+    CJsonModel::PrintValue(item, print);
+    print.buffer[print.offset] = '\0';
+
+    // Result is shrunk to its length
+    CJsonModel::Reallocate(print, print.offset + 1);
+    print.buffer[print.offset] = '\0';
+    return print.buffer;
+}
+
+inline void cJSON_free(void *text) { delete[] static_cast<char *>(text); }
+
+inline void cJSON_Delete(cJSON *item)
+{
+    while (item)
+    {
+        auto next = item->next;
+        cJSON_Delete(item->child);
+        delete[] item->valuestring;
+        delete[] item->string;
+        delete item;
+        item = next;
+    }
+}
+
+#endif // TEST_CJSON_MODEL_H
@@ -0,0 +1,151 @@
+/**
+ * cJSON documents of host tests
+ *
+ * Items are linked the same way as cJSON library does, the last child is kept in prev of the first
+ * one. Document owns its items and strings, so trees do not need to be deleted.
+ */
+#ifndef TEST_JSON_DOCUMENT_H
+#define TEST_JSON_DOCUMENT_H
+
+/* Host stubs */
+#include <cJSON.h>
+
+/* STD library */
+#include <cstddef>
+#include <deque>
+#include <string>
+
+class JsonDocument
+{
+public:
+    cJSON *Null() { return Item(cJSON_NULL); }
+
+    cJSON *Bool(bool value) { return Item(value ? cJSON_True : cJSON_False); }
+
+    cJSON *Number(double value)
+    {
+        auto item = Item(cJSON_Number);
+        item->valuedouble = value;
+        item->valueint = static_cast<int>(value);
+        return item;
+    }
+
+    cJSON *String(const std::string &value)
+    {
+        auto item = Item(cJSON_String);
+        item->valuestring = Text(value);
+        return item;
+    }
+
+    cJSON *Array() { return Item(cJSON_Array); }
+
+    cJSON *Object() { return Item(cJSON_Object); }
+
+    /**
+     * @brief Append item to array
+     */
+    cJSON *Add(cJSON *parent, cJSON *item)
+    {
+        if (!parent->child)
+        {
+            parent->child = item;
+            item->prev = item;
+            return item;
+        }
+
+        auto last = parent->child->prev;
+        last->next = item;
+        item->prev = last;
+        parent->child->prev = item;
+        return item;
+    }
+
+    /**
+     * @brief Append member to object
+     */
+    cJSON *Add(cJSON *parent, const std::string &key, cJSON *item)
+    {
+        item->string = Text(key);
+        return Add(parent, item);
+    }
+
+    /**
+     * @brief Arrays nested given number of levels with number in the innermost one
+     */
+    cJSON *Nested(size_t levels)
+    {
+        auto item = Number(1);
+        for (size_t level = 0; level < levels; ++level)
+        {
+            auto array = Array();
+            Add(array, item);
+            item = array;
+        }
+
+        return item;
+    }
+
+    /**
+     * @brief Object with members "m<i>" : i
+     */
+    cJSON *Wide(size_t members)
+    {
+        auto object = Object();
+        for (size_t i = 0; i < members; ++i)
+            Add(object, "m" + std::to_string(i), Number(static_cast<double>(i)));
+
+        return object;
+    }
+
+    /**
+     * @brief Length of JSON of Wide document
+     */
+    static size_t WideSize(size_t members)
+    {
+        // Braces and commas between members
+        size_t size = 2 + (members ? members - 1 : 0);
+        for (size_t i = 0; i < members; ++i)
+            size += 4 + 2 * std::to_string(i).size();
+
+        return size;
+    }
+
+    /**
+     * @brief Tree of objects with given fan-out and depth, leaves are numbers
+     */
+    cJSON *Tree(size_t fanOut, size_t depth)
+    {
+        if (!depth)
+            return Number(static_cast<double>(mItems.size()));
+
+        auto object = Object();
+        for (size_t i = 0; i < fanOut; ++i)
+            Add(object, "n" + std::to_string(i), Tree(fanOut, depth - 1));
+
+        return object;
+    }
+
+    size_t Items() const { return mItems.size(); }
+
+private:
+    cJSON *Item(int type)
+    {
+        mItems.emplace_back();
+        auto item = &mItems.back();
+        *item = cJSON{};
+        item->type = type;
+        return item;
+    }
+
+    char *Text(const std::string &value)
+    {
+        mStrings.push_back(value);
+        return &mStrings.back()[0];
+    }
+
+    // Deque does not move items, so links between them stay valid
+    std::deque<cJSON> mItems;
+    std::deque<std::string> mStrings;
+};
+
+#endif // TEST_JSON_DOCUMENT_H
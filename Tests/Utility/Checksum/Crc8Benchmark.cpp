@@ -0,0 +1,51 @@
+/* Code under test */
+#include "Common_components/Utility/Checksum/Crc8.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* STD library */
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using Utility::Checksum::SensirionCrc8;
+using Utility::DataType::ByteView;
+
+namespace
+{
+    // Bytes processed by every measurement
+    constexpr size_t BYTES_PER_RUN = 64 * 1024 * 1024;
+} // namespace
+
+TEST(Crc8Benchmark, TableAgainstBitwiseThroughput)
+{
+    // Word of response, measurement of SCD4x, serial number and long block
+    const size_t lengths[] = {2, 8, 64, 4096};
+
+    std::mt19937 generator(3);
+    std::vector<uint8_t> data(4096);
+    for (auto &byte : data)
+        byte = static_cast<uint8_t>(generator());
+
+    std::printf("[ BENCHMARK] %8s %14s %14s %12s %12s %8s\n", "bytes", "table ns", "bitwise ns", "table MB/s", "bitwise MB/s", "speedup");
+
+    for (const auto length : lengths)
+    {
+        const size_t iterations = BYTES_PER_RUN / length;
+
+        // Offset changes input, so compiler can not hoist computation out of loop
+        const double table = Benchmark::NanosecondsPerCall(iterations, [&](size_t i) {
+            Benchmark::DoNotOptimize(SensirionCrc8::Compute(ByteView(data.data() + (i & 1), length - (i & 1))));
+        });
+        const double bitwise = Benchmark::NanosecondsPerCall(iterations / 8, [&](size_t i) {
+            Benchmark::DoNotOptimize(SensirionCrc8::ComputeConstexpr(data.data() + (i & 1), length - (i & 1)));
+        });
+
+        std::printf("[ BENCHMARK] %8zu %14.2f %14.2f %12.1f %12.1f %7.1fx\n", length, table, bitwise, length * 1000.0 / table,
+                    length * 1000.0 / bitwise, bitwise / table);
+
+        EXPECT_EQ(SensirionCrc8::Compute(ByteView(data.data(), length)), SensirionCrc8::ComputeConstexpr(data.data(), length));
+    }
+}
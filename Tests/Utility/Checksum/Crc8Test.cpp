@@ -0,0 +1,68 @@
+/* Code under test */
+#include "Common_components/Utility/Checksum/Crc8.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using Utility::Checksum::SensirionCrc8;
+using Utility::DataType::ByteView;
+
+namespace
+{
+    // Example of Sensirion datasheets
+    constexpr uint8_t BEEF[] = {0xBE, 0xEF};
+    constexpr uint8_t BEEF_CRC = 0x92;
+} // namespace
+
+static_assert(SensirionCrc8::ComputeConstexpr(BEEF, sizeof(BEEF)) == BEEF_CRC, "CRC of 0xBEEF is 0x92");
+static_assert(SensirionCrc8::ComputeConstexpr(BEEF, 0) == 0xFF, "CRC of no data is initial value");
+
+TEST(SensirionCrc8, MatchesDatasheetExample)
+{
+    EXPECT_EQ(SensirionCrc8::Compute(ByteView(BEEF, sizeof(BEEF))), BEEF_CRC);
+    EXPECT_TRUE(SensirionCrc8::Check(ByteView(BEEF, sizeof(BEEF)), BEEF_CRC));
+    EXPECT_FALSE(SensirionCrc8::Check(ByteView(BEEF, sizeof(BEEF)), BEEF_CRC ^ 0x01));
+    EXPECT_EQ(SensirionCrc8::Compute(ByteView()), 0xFF);
+}
+
+TEST(SensirionCrc8, TableMatchesBitwiseComputationOfEveryWord)
+{
+    // Every word of response, so every entry of table is used
+    for (uint32_t word = 0; word <= UINT16_MAX; ++word)
+    {
+        const uint8_t bytes[] = {static_cast<uint8_t>(word >> 8), static_cast<uint8_t>(word)};
+        ASSERT_EQ(SensirionCrc8::Compute(ByteView(bytes, sizeof(bytes))), SensirionCrc8::ComputeConstexpr(bytes, sizeof(bytes)))
+            << "word " << word;
+    }
+}
+
+TEST(SensirionCrc8, TableMatchesBitwiseComputationOfLongData)
+{
+    std::mt19937 generator(17);
+    std::vector<uint8_t> data;
+
+    for (size_t length = 0; length <= 256; ++length)
+    {
+        const auto crc = SensirionCrc8::Compute(ByteView(data.data(), data.size()));
+        ASSERT_EQ(crc, SensirionCrc8::ComputeConstexpr(data.data(), data.size())) << "length " << length;
+        data.push_back(static_cast<uint8_t>(generator()));
+    }
+}
+
+TEST(SensirionCrc8, DetectsEveryBitFlipOfWord)
+{
+    const auto crc = SensirionCrc8::Compute(ByteView(BEEF, sizeof(BEEF)));
+
+    for (size_t bit = 0; bit < 8 * sizeof(BEEF); ++bit)
+    {
+        std::array<uint8_t, sizeof(BEEF)> corrupted = {{BEEF[0], BEEF[1]}};
+        corrupted[bit / 8] ^= static_cast<uint8_t>(1 << bit % 8);
+        EXPECT_FALSE(SensirionCrc8::Check(ByteView(corrupted.data(), corrupted.size()), crc)) << "bit " << bit;
+    }
+}
@@ -0,0 +1,145 @@
+/* Code under test */
+#include "Common_components/Utility/Network/TopicRouter.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/AllocationCounter.hpp"
+#include "Support/Benchmark.hpp"
+
+/* STD library */
+#include <cstring>
+#include <string>
+
+using namespace Utility::Network;
+
+namespace
+{
+    constexpr size_t ITERATIONS = 1000000;
+
+    // Greenhouse ID of server, default of Kconfig
+    constexpr int GREENHOUSE_ID = 1;
+
+    // Command topics of server, the same as GreenhouseDefinitions.hpp
+    const char *const SERVER_FILTERS[] = {"Greenhouse/window", "Greenhouse/window/1", "Greenhouse/irrigation",
+                                          "Greenhouse/irrigation/1", "Greenhouse/commands", "Greenhouse/commands/1"};
+
+    // Typical command payload, longer than small string buffer
+    const char PAYLOAD[] = "{\"window\":{\"open\":true,\"angle\":45},\"irrigation\":{\"duration\":120}}";
+
+    /**
+     * @brief Handler counting its calls
+     */
+    void Count(TopicView, TopicView payload, void *context)
+    {
+        Benchmark::DoNotOptimize(payload.size());
+        ++*static_cast<size_t *>(context);
+    }
+
+    /**
+     * @brief Routing of network manager before topic router. Topic and payload were copied into strings
+     *        and compared against every command topic, topics with ID were built for every message
+     *
+     * @return size_t   : Number of matched command topics
+     */
+    size_t CompareTopics(const char *topic, size_t topicLength, const char *payload, size_t payloadLength)
+    {
+        std::string topicText;
+        topicText.assign(topic, topicLength);
+        std::string data;
+        data.assign(payload, payloadLength);
+        Benchmark::DoNotOptimize(data);
+
+        size_t matched = 0;
+        if (!topicText.compare("Greenhouse/window") || !topicText.compare(std::string("Greenhouse/window/") + std::to_string(GREENHOUSE_ID)))
+            ++matched;
+        if (!topicText.compare("Greenhouse/irrigation") ||
+            !topicText.compare(std::string("Greenhouse/irrigation/") + std::to_string(GREENHOUSE_ID)))
+            ++matched;
+        if (!topicText.compare("Greenhouse/commands") ||
+            !topicText.compare(std::string("Greenhouse/commands/") + std::to_string(GREENHOUSE_ID)))
+            ++matched;
+
+        return matched;
+    }
+
+    /* Cost of routing one message */
+    struct RouteCost
+    {
+        size_t matched;
+        size_t allocations;
+        double nanoseconds;
+    };
+
+    /**
+     * @brief Measure matches, allocations and time of routing one message
+     *
+     * @param[in] route     : Routes one message, returns number of matches
+     */
+    template <typename Route>
+    RouteCost Measure(Route route)
+    {
+        RouteCost cost;
+        {
+            Allocation::Scope scope;
+            cost.matched = route();
+            cost.allocations = scope.Allocations();
+        }
+
+        cost.nanoseconds = Benchmark::NanosecondsPerCall(ITERATIONS, [&](size_t) { Benchmark::DoNotOptimize(route()); });
+        return cost;
+    }
+} // namespace
+
+TEST(TopicRouterBenchmark, RoutingCostAgainstStringCompare)
+{
+    size_t calls = 0;
+    TopicRouter router;
+    for (const auto filter : SERVER_FILTERS)
+        ASSERT_TRUE(router.Register(filter, &Count, &calls));
+
+    // The same topics and wildcards of 64 greenhouses
+    TopicRouter large;
+    for (const auto filter : SERVER_FILTERS)
+        ASSERT_TRUE(large.Register(filter, &Count, &calls));
+    for (int id = 2; id < 64; ++id)
+    {
+        for (const auto kind : {"window", "irrigation", "commands"})
+            ASSERT_TRUE(large.Register((std::string("Greenhouse/") + kind + "/" + std::to_string(id)).c_str(), &Count, &calls));
+    }
+    for (const auto filter : {"Greenhouse/+/status", "Greenhouse/logs/#", "$SYS/#"})
+        ASSERT_TRUE(large.Register(filter, &Count, &calls));
+
+    struct Case
+    {
+        const char *topic;
+        size_t matched;
+    };
+
+    const Case cases[] = {{"Greenhouse/window", 1}, {"Greenhouse/commands/1", 1}, {"Greenhouse/lights/1", 0}};
+
+    const TopicView payload(PAYLOAD, sizeof(PAYLOAD) - 1);
+
+    std::printf("[ BENCHMARK] %zu and %zu filters, payload %zu B\n", router.GetFilterCount(), large.GetFilterCount(), payload.size());
+    std::printf("[ BENCHMARK] %-24s %-16s %8s %8s %10s\n", "topic", "path", "matched", "allocs", "ns");
+
+    for (const auto &test : cases)
+    {
+        const TopicView topic(test.topic, std::strlen(test.topic));
+
+        const auto compared = Measure([&]() { return CompareTopics(topic.data(), topic.size(), payload.data(), payload.size()); });
+        const auto routed = Measure([&]() { return router.Dispatch(topic, payload); });
+        const auto routedLarge = Measure([&]() { return large.Dispatch(topic, payload); });
+
+        const std::pair<const char *, RouteCost> rows[] = {{"string compare", compared}, {"router", routed}, {"router, large", routedLarge}};
+        for (const auto &row : rows)
+        {
+            std::printf("[ BENCHMARK] %-24s %-16s %8zu %8zu %10.1f\n", test.topic, row.first, row.second.matched, row.second.allocations,
+                        row.second.nanoseconds);
+
+            EXPECT_EQ(row.second.matched, test.matched) << test.topic << ", " << row.first;
+        }
+
+        EXPECT_EQ(routed.allocations, 0u) << test.topic;
+        EXPECT_EQ(routedLarge.allocations, 0u) << test.topic;
+    }
+}
@@ -0,0 +1,178 @@
+/* Code under test */
+#include "Common_components/Utility/Network/TopicRouter.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Utility::Network;
+
+namespace
+{
+    /* Filters called by dispatch, in order of calls */
+    struct Calls
+    {
+        std::vector<std::string> filters;
+        std::string payload;
+    };
+
+    /* Route of test, context of its handler */
+    struct Route
+    {
+        const char *filter;
+        Calls *calls;
+    };
+
+    void Record(TopicView, TopicView payload, void *context)
+    {
+        auto route = static_cast<Route *>(context);
+        route->calls->filters.push_back(route->filter);
+        route->calls->payload.assign(payload.data(), payload.size());
+    }
+
+    TopicView View(const char *text) { return TopicView(text, std::strlen(text)); }
+
+    /**
+     * @brief Router with every filter registered with its own route
+     */
+    class TopicRouterTest : public ::testing::Test
+    {
+    protected:
+        // Contexts registered in router must not move
+        TopicRouterTest() { mRoutes.reserve(32); }
+
+        void Register(std::initializer_list<const char *> filters)
+        {
+            for (const auto filter : filters)
+            {
+                mRoutes.push_back({filter, &mCalls});
+                ASSERT_TRUE(mRouter.Register(filter, &Record, &mRoutes.back())) << filter;
+            }
+        }
+
+        /**
+         * @brief Dispatch topic, return sorted filters which were called
+         */
+        std::vector<std::string> Dispatch(const char *topic, const char *payload = "")
+        {
+            mCalls.filters.clear();
+            const auto called = mRouter.Dispatch(View(topic), View(payload));
+            EXPECT_EQ(called, mCalls.filters.size()) << topic;
+
+            auto filters = mCalls.filters;
+            std::sort(filters.begin(), filters.end());
+            return filters;
+        }
+
+        TopicRouter mRouter;
+        Calls mCalls;
+        std::vector<Route> mRoutes;
+    };
+
+    using Filters = std::vector<std::string>;
+} // namespace
+
+TEST_F(TopicRouterTest, ExactFilterMatchesOnlyItsTopic)
+{
+    Register({"Greenhouse/window", "Greenhouse/window/1"});
+
+    EXPECT_EQ(Dispatch("Greenhouse/window", "open"), Filters({"Greenhouse/window"}));
+    EXPECT_EQ(mCalls.payload, "open");
+    EXPECT_EQ(Dispatch("Greenhouse/window/1"), Filters({"Greenhouse/window/1"}));
+
+    EXPECT_TRUE(Dispatch("Greenhouse/window/2").empty());
+    EXPECT_TRUE(Dispatch("Greenhouse/windows").empty());
+    EXPECT_TRUE(Dispatch("Greenhouse").empty());
+    EXPECT_TRUE(Dispatch("Greenhouse/window/").empty());
+    EXPECT_TRUE(Dispatch("greenhouse/window").empty());
+}
+
+TEST_F(TopicRouterTest, SingleLevelWildcardMatchesExactlyOneLevel)
+{
+    Register({"Greenhouse/+/1", "+/window", "Greenhouse/+"});
+
+    EXPECT_EQ(Dispatch("Greenhouse/window/1"), Filters({"Greenhouse/+/1"}));
+    EXPECT_EQ(Dispatch("Greenhouse/irrigation/1"), Filters({"Greenhouse/+/1"}));
+    EXPECT_EQ(Dispatch("Greenhouse/window"), Filters({"+/window", "Greenhouse/+"}));
+
+    // Wildcard level may be empty, but it is still one level
+    EXPECT_EQ(Dispatch("Greenhouse//1"), Filters({"Greenhouse/+/1"}));
+    EXPECT_EQ(Dispatch("Greenhouse/"), Filters({"Greenhouse/+"}));
+
+    EXPECT_TRUE(Dispatch("Greenhouse/window/2").empty());
+    EXPECT_TRUE(Dispatch("Greenhouse/window/1/2").empty());
+    EXPECT_TRUE(Dispatch("Greenhouse").empty());
+}
+
+TEST_F(TopicRouterTest, TrailingMultiLevelWildcardMatchesParentAndAllChildren)
+{
+    Register({"Greenhouse/commands/#", "#"});
+
+    EXPECT_EQ(Dispatch("Greenhouse/commands"), Filters({"#", "Greenhouse/commands/#"}));
+    EXPECT_EQ(Dispatch("Greenhouse/commands/1"), Filters({"#", "Greenhouse/commands/#"}));
+    EXPECT_EQ(Dispatch("Greenhouse/commands/1/window/open"), Filters({"#", "Greenhouse/commands/#"}));
+
+    EXPECT_EQ(Dispatch("Greenhouse"), Filters({"#"}));
+    EXPECT_EQ(Dispatch("Greenhouse/commandsX"), Filters({"#"}));
+}
+
+TEST_F(TopicRouterTest, EveryMatchingFilterIsCalledOnce)
+{
+    Register({"Greenhouse/window/1", "Greenhouse/window/+", "Greenhouse/+/1", "Greenhouse/#", "+/+/+", "#", "Greenhouse/window/#"});
+
+    EXPECT_EQ(Dispatch("Greenhouse/window/1"), Filters({"#", "+/+/+", "Greenhouse/#", "Greenhouse/+/1", "Greenhouse/window/#",
+                                                        "Greenhouse/window/+", "Greenhouse/window/1"}));
+
+    // "Greenhouse/window/#" matches its parent level, "Greenhouse/window/+" needs one more level
+    EXPECT_EQ(Dispatch("Greenhouse/window"), Filters({"#", "Greenhouse/#", "Greenhouse/window/#"}));
+}
+
+TEST_F(TopicRouterTest, WildcardAtFirstLevelDoesNotMatchDollarTopics)
+{
+    Register({"#", "+/broker", "+/+", "$SYS/#", "$SYS/+"});
+
+    EXPECT_EQ(Dispatch("$SYS/broker"), Filters({"$SYS/#", "$SYS/+"}));
+    EXPECT_EQ(Dispatch("$SYS"), Filters({"$SYS/#"}));
+
+    // Topic with '$' in other than the first level is ordinary topic
+    EXPECT_EQ(Dispatch("SYS/broker"), Filters({"#", "+/+", "+/broker"}));
+    EXPECT_EQ(Dispatch("Greenhouse/$SYS"), Filters({"#", "+/+"}));
+}
+
+TEST_F(TopicRouterTest, RejectsDuplicateAndInvalidFilters)
+{
+    Register({"Greenhouse/window", "Greenhouse/+", "Greenhouse/#"});
+
+    Route duplicate{"duplicate", &mCalls};
+    EXPECT_FALSE(mRouter.Register("Greenhouse/window", &Record, &duplicate));
+    EXPECT_FALSE(mRouter.Register("Greenhouse/+", &Record, &duplicate));
+    EXPECT_FALSE(mRouter.Register("Greenhouse/#", &Record, &duplicate));
+
+    // Wildcards must fill whole level and "#" must be the last one
+    for (const auto filter : {"Greenhouse/win+", "Greenhouse/+dow", "Greenhouse#", "Greenhouse/#/1", "##", "+#", ""})
+        EXPECT_FALSE(mRouter.Register(filter, &Record, &duplicate)) << filter;
+
+    EXPECT_FALSE(mRouter.Register(nullptr, &Record, &duplicate));
+    EXPECT_FALSE(mRouter.Register("Greenhouse/irrigation", nullptr, &duplicate));
+
+    // Rejected filters neither changed routes nor left routes in trie
+    EXPECT_EQ(mRouter.GetFilterCount(), 3u);
+    EXPECT_EQ(mRouter.GetFilter(0), "Greenhouse/window");
+    EXPECT_EQ(Dispatch("Greenhouse/window"), Filters({"Greenhouse/#", "Greenhouse/+", "Greenhouse/window"}));
+    EXPECT_EQ(Dispatch("Greenhouse/1"), Filters({"Greenhouse/#", "Greenhouse/+"}));
+    EXPECT_EQ(Dispatch("Greenhouse/irrigation"), Filters({"Greenhouse/#", "Greenhouse/+"}));
+}
+
+TEST_F(TopicRouterTest, EmptyTopicIsNotDispatched)
+{
+    Register({"#", "+"});
+
+    EXPECT_EQ(mRouter.Dispatch(TopicView(), View("payload")), 0u);
+    EXPECT_EQ(mRouter.Dispatch(TopicView("Greenhouse", 0), View("payload")), 0u);
+    EXPECT_TRUE(mCalls.filters.empty());
+}
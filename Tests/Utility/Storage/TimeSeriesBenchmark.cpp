@@ -0,0 +1,225 @@
+/* Code under test */
+#include "Common_components/Utility/Storage/TimeSeries.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* STD library */
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Utility::Storage;
+
+namespace
+{
+    // Two clients with four metrics each
+    constexpr size_t SERIES = 8;
+
+    // Measurement period of client and samples of every series, more than pool holds for noisy values
+    constexpr uint32_t PERIOD = 10;
+    constexpr size_t SAMPLES = 2000;
+
+    constexpr uint32_t START = 1700000000;
+
+    // Timestamp and value of raw sample
+    constexpr double RAW_SAMPLE_BYTES = sizeof(uint32_t) + sizeof(float);
+
+    // Windows of dashboard graph and of whole day
+    constexpr uint32_t DASHBOARD_WINDOW = 30 * 60;
+    constexpr uint32_t DAY_WINDOW = 24 * 3600;
+
+    constexpr size_t QUERIES = 20000;
+    constexpr size_t CHECKED_WINDOWS = 2000;
+
+    constexpr double PI = 3.14159265358979323846;
+
+    /* Stored sample */
+    struct Sample
+    {
+        uint32_t timestamp;
+        float value;
+    };
+
+    /* Kind of values of all series */
+    enum class Trace
+    {
+        CONSTANT,
+        FIXED_POINT,
+        INTEGER,
+        NOISY_FLOAT,
+    };
+
+    SeriesKey KeyOf(size_t series) { return {static_cast<uint8_t>(series / 4), 0, static_cast<uint8_t>(0x80 >> (series % 4))}; }
+
+    /**
+     * @brief Generate samples of series. Clock of client jitters by a second now and then
+     */
+    std::vector<Sample> Generate(Trace trace, size_t series, std::mt19937 &generator)
+    {
+        std::normal_distribution<float> noise(0.0f, 0.05f);
+        std::uniform_int_distribution<int> jitter(-1, 1);
+        std::uniform_real_distribution<float> uniform(-1000.0f, 1000.0f);
+
+        std::vector<Sample> samples;
+        samples.reserve(SAMPLES);
+
+        for (size_t i = 0; i < SAMPLES; ++i)
+        {
+            uint32_t timestamp = START + i * PERIOD + (i % 7 == 0 ? jitter(generator) : 0);
+            if (!samples.empty() && timestamp < samples.back().timestamp)
+                timestamp = samples.back().timestamp;
+
+            const double swing = std::sin(2 * PI * i / (200.0 + 50.0 * series));
+            float value{0.0f};
+            switch (trace)
+            {
+            case Trace::CONSTANT:
+                value = 60.0f;
+                break;
+            case Trace::FIXED_POINT:
+                // Two decimals of frame field
+                value = std::round((22.0f + 3.0f * static_cast<float>(swing) + noise(generator)) * 100.0f) / 100.0f;
+                break;
+            case Trace::INTEGER:
+                value = std::round(800.0f + 100.0f * static_cast<float>(swing));
+                break;
+            case Trace::NOISY_FLOAT:
+                value = uniform(generator);
+                break;
+            }
+
+            samples.push_back({timestamp, value});
+        }
+
+        return samples;
+    }
+
+    /**
+     * @brief Check summary of window against samples still held by store
+     */
+    bool Matches(const std::vector<Sample> &samples, size_t held, uint32_t from, uint32_t to, bool found, const SeriesSummary &summary)
+    {
+        SeriesSummary expected = {0, 0.0f, 0.0f, 0.0f, 0.0f, 0};
+        double sum{0.0};
+
+        for (size_t i = samples.size() - held; i < samples.size(); ++i)
+        {
+            const auto &sample = samples[i];
+            if (sample.timestamp < from || sample.timestamp > to)
+                continue;
+
+            if (!expected.count || sample.value < expected.min)
+                expected.min = sample.value;
+            if (!expected.count || sample.value > expected.max)
+                expected.max = sample.value;
+
+            ++expected.count;
+            sum += sample.value;
+            expected.last = sample.value;
+        }
+
+        if (found != (expected.count > 0))
+            return false;
+
+        return !expected.count || (summary.count == expected.count && summary.min == expected.min && summary.max == expected.max &&
+                                   summary.last == expected.last && std::fabs(sum / expected.count - summary.avg) <= 1e-3 * std::fabs(summary.avg) + 1e-3);
+    }
+
+    /**
+     * @brief Average time of query over the newest window of given length
+     */
+    double QueryTime(const TimeSeriesStore &store, uint32_t newest, uint32_t window)
+    {
+        SeriesSummary summary;
+        return Benchmark::NanosecondsPerCall(QUERIES, [&](size_t i) {
+            Benchmark::DoNotOptimize(store.Query(KeyOf(i % SERIES), newest - window, newest, summary));
+            Benchmark::DoNotOptimize(summary);
+        });
+    }
+} // namespace
+
+TEST(TimeSeriesBenchmark, BytesPerSampleAndQueryLatency)
+{
+    struct Case
+    {
+        const char *name;
+        Trace trace;
+    };
+
+    const Case cases[] = {
+        {"constant", Trace::CONSTANT},
+        {"fixed point, 0.01", Trace::FIXED_POINT},
+        {"integer", Trace::INTEGER},
+        {"noisy float", Trace::NOISY_FLOAT},
+    };
+
+    // Store is too large for stack of test
+    std::unique_ptr<TimeSeriesStore> store(new TimeSeriesStore());
+
+    // Pool with block headers and series table
+    const double poolBlockBytes = static_cast<double>(sizeof(TimeSeriesStore)) / TIMESERIES_BLOCKS;
+
+    std::printf("[ BENCHMARK] %zu series, %zu samples every %u s, pool of %d blocks, %zu bytes\n", SERIES, SAMPLES, PERIOD, TIMESERIES_BLOCKS,
+                sizeof(TimeSeriesStore));
+    std::printf("[ BENCHMARK] %-18s %8s %9s %9s %9s %12s %12s %12s\n", "trace", "held", "B/sample", "pool B/s", "hours", "30 min ns",
+                "day ns", "series ns");
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c)
+    {
+        store->Clear();
+        std::mt19937 generator(static_cast<unsigned>(c + 1));
+
+        std::array<std::vector<Sample>, SERIES> samples;
+        for (size_t s = 0; s < SERIES; ++s)
+            samples[s] = Generate(cases[c].trace, s, generator);
+
+        // Clients report in turns
+        for (size_t i = 0; i < SAMPLES; ++i)
+        {
+            for (size_t s = 0; s < SERIES; ++s)
+                ASSERT_TRUE(store->Append(KeyOf(s), samples[s][i].timestamp, samples[s][i].value));
+        }
+
+        const auto statistics = store->GetStatistics();
+        const double bytesPerSample = static_cast<double>(statistics.usedBytes) / statistics.samples;
+        const double poolBytesPerSample = statistics.usedBlocks * poolBlockBytes / statistics.samples;
+        const double hours = static_cast<double>(statistics.samples) / SERIES * PERIOD / 3600;
+
+        // Random windows over held history against reference
+        std::array<size_t, SERIES> held;
+        for (size_t s = 0; s < SERIES; ++s)
+        {
+            SeriesSummary all;
+            ASSERT_TRUE(store->Query(KeyOf(s), 0, UINT32_MAX, all));
+            held[s] = all.count;
+        }
+
+        const uint32_t newest = samples[0].back().timestamp;
+        std::uniform_int_distribution<uint32_t> time(START - PERIOD, newest + PERIOD);
+        size_t mismatches{0};
+        for (size_t i = 0; i < CHECKED_WINDOWS; ++i)
+        {
+            const size_t s = i % SERIES;
+            uint32_t from = time(generator), to = time(generator);
+            if (from > to)
+                std::swap(from, to);
+
+            SeriesSummary summary;
+            const bool found = store->Query(KeyOf(s), from, to, summary);
+            mismatches += !Matches(samples[s], held[s], from, to, found, summary);
+        }
+
+        std::printf("[ BENCHMARK] %-18s %8u %9.2f %9.2f %9.1f %12.1f %12.1f %12.1f\n", cases[c].name, statistics.samples, bytesPerSample,
+                    poolBytesPerSample, hours, QueryTime(*store, newest, DASHBOARD_WINDOW), QueryTime(*store, newest, DAY_WINDOW),
+                    QueryTime(*store, newest, newest));
+
+        EXPECT_EQ(mismatches, 0u) << cases[c].name;
+        EXPECT_EQ(statistics.rejected, 0u) << cases[c].name;
+        EXPECT_LT(bytesPerSample, RAW_SAMPLE_BYTES) << cases[c].name;
+    }
+}
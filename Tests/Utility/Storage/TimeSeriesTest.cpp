@@ -0,0 +1,173 @@
+/* Code under test */
+#include "Common_components/Utility/Storage/TimeSeries.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+
+/* STD library */
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace Utility::Storage;
+
+namespace
+{
+    const SeriesKey TEMPERATURE = {1, 2, 0x80};
+    const SeriesKey HUMIDITY = {1, 2, 0x40};
+
+    constexpr uint32_t START = 1700000000;
+
+    /* Stored sample */
+    struct Sample
+    {
+        uint32_t timestamp;
+        float value;
+    };
+
+    bool SameBits(float a, float b) { return std::memcmp(&a, &b, sizeof(a)) == 0; }
+
+    /**
+     * @brief Store is too large for stack of test
+     */
+    class TimeSeriesStoreTest : public ::testing::Test
+    {
+    protected:
+        std::unique_ptr<TimeSeriesStore> mStore{new TimeSeriesStore()};
+    };
+} // namespace
+
+TEST_F(TimeSeriesStoreTest, DecodesEveryEncodingOfTimestampAndValue)
+{
+    // Deltas of delta of every prefix in both directions, values of every XOR encoding
+    const int32_t deltasOfDelta[] = {0, 0, 1, -1, 63, -64, 64, -65, 255, -256, 256, -257, 2047, -2048, 2048, -2049, 100000, -100000};
+    const float values[] = {21.5f, 21.5f, 21.25f, 21.75f, -21.75f, 0.0f, -0.0f, FLT_MAX, -FLT_MAX, FLT_MIN, 1e-40f, 1.0f, 1.0f,
+                            1000.0f, 999.99f, 3.14159f, 2.71828f, 42.0f};
+    static_assert(sizeof(deltasOfDelta) / sizeof(deltasOfDelta[0]) == sizeof(values) / sizeof(values[0]), "One value per timestamp");
+
+    std::vector<Sample> samples;
+    uint32_t timestamp = START;
+    int64_t delta = 200000;
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        delta += deltasOfDelta[i];
+        timestamp += static_cast<uint32_t>(delta);
+        samples.push_back({timestamp, values[i]});
+        ASSERT_TRUE(mStore->Append(TEMPERATURE, timestamp, values[i])) << "sample " << i;
+    }
+
+    // Window of single sample decodes block
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        SeriesSummary summary;
+        ASSERT_TRUE(mStore->Query(TEMPERATURE, samples[i].timestamp, samples[i].timestamp, summary)) << "sample " << i;
+        EXPECT_EQ(summary.count, 1u);
+        EXPECT_TRUE(SameBits(summary.last, samples[i].value)) << "sample " << i;
+        EXPECT_EQ(summary.lastTimestamp, samples[i].timestamp);
+    }
+}
+
+TEST_F(TimeSeriesStoreTest, WindowMergesBlocksAndDecodedEdges)
+{
+    // Ramp over many blocks, every sample differs so blocks fill fast
+    constexpr uint32_t SAMPLES = 2000;
+    constexpr uint32_t PERIOD = 10;
+    for (uint32_t i = 0; i < SAMPLES; ++i)
+        ASSERT_TRUE(mStore->Append(TEMPERATURE, START + i * PERIOD, static_cast<float>(i) * 0.37f));
+
+    ASSERT_GT(mStore->GetStatistics().usedBlocks, 2u);
+
+    const uint32_t windows[][2] = {{0, SAMPLES - 1}, {1, SAMPLES - 2}, {17, 1234}, {500, 500}, {SAMPLES - 180, SAMPLES - 1}};
+    for (const auto &window : windows)
+    {
+        SeriesSummary summary;
+        ASSERT_TRUE(mStore->Query(TEMPERATURE, START + window[0] * PERIOD, START + window[1] * PERIOD, summary));
+
+        const uint32_t count = window[1] - window[0] + 1;
+        double sum{0.0};
+        for (uint32_t i = window[0]; i <= window[1]; ++i)
+            sum += static_cast<float>(i) * 0.37f;
+
+        EXPECT_EQ(summary.count, count) << window[0] << "-" << window[1];
+        EXPECT_FLOAT_EQ(summary.min, static_cast<float>(window[0]) * 0.37f);
+        EXPECT_FLOAT_EQ(summary.max, static_cast<float>(window[1]) * 0.37f);
+        EXPECT_FLOAT_EQ(summary.last, static_cast<float>(window[1]) * 0.37f);
+        EXPECT_NEAR(summary.avg, sum / count, 1e-3);
+        EXPECT_EQ(summary.lastTimestamp, START + window[1] * PERIOD);
+    }
+
+    // Window between samples and window after series
+    SeriesSummary summary;
+    EXPECT_FALSE(mStore->Query(TEMPERATURE, START + 1, START + PERIOD - 1, summary));
+    EXPECT_FALSE(mStore->Query(TEMPERATURE, START + SAMPLES * PERIOD, UINT32_MAX, summary));
+    EXPECT_FALSE(mStore->Query(HUMIDITY, 0, UINT32_MAX, summary));
+}
+
+TEST_F(TimeSeriesStoreTest, OlderSampleIsRejected)
+{
+    ASSERT_TRUE(mStore->Append(TEMPERATURE, START + 10, 20.0f));
+
+    // Sample of the same second is kept, older one is not
+    EXPECT_TRUE(mStore->Append(TEMPERATURE, START + 10, 20.5f));
+    EXPECT_FALSE(mStore->Append(TEMPERATURE, START + 9, 21.0f));
+
+    // Other series has its own time
+    EXPECT_TRUE(mStore->Append(HUMIDITY, START, 60.0f));
+
+    const auto statistics = mStore->GetStatistics();
+    EXPECT_EQ(statistics.series, 2u);
+    EXPECT_EQ(statistics.samples, 3u);
+    EXPECT_EQ(statistics.rejected, 1u);
+
+    SeriesSummary summary;
+    ASSERT_TRUE(mStore->Query(TEMPERATURE, 0, UINT32_MAX, summary));
+    EXPECT_EQ(summary.count, 2u);
+    EXPECT_FLOAT_EQ(summary.last, 20.5f);
+}
+
+TEST_F(TimeSeriesStoreTest, FullPoolReusesOldestBlocks)
+{
+    // Two series fill the pool several times
+    constexpr uint32_t SAMPLES = 40 * TIMESERIES_BLOCKS;
+    for (uint32_t i = 0; i < SAMPLES; ++i)
+    {
+        ASSERT_TRUE(mStore->Append(TEMPERATURE, START + 2 * i, static_cast<float>(i % 1000) * 0.01f));
+        ASSERT_TRUE(mStore->Append(HUMIDITY, START + 2 * i + 1, static_cast<float>(i % 777) * 0.1f));
+    }
+
+    const auto statistics = mStore->GetStatistics();
+    EXPECT_GT(statistics.evictedBlocks, 0u);
+    EXPECT_EQ(statistics.usedBlocks, static_cast<uint32_t>(TIMESERIES_BLOCKS));
+    EXPECT_EQ(statistics.rejected, 0u);
+
+    // Both series keep their newest samples, the oldest ones are gone
+    SeriesSummary temperature, humidity;
+    ASSERT_TRUE(mStore->Query(TEMPERATURE, 0, UINT32_MAX, temperature));
+    ASSERT_TRUE(mStore->Query(HUMIDITY, 0, UINT32_MAX, humidity));
+    EXPECT_EQ(temperature.count + humidity.count, statistics.samples);
+    EXPECT_LT(temperature.count, SAMPLES);
+    EXPECT_GT(temperature.count, SAMPLES / 4);
+    EXPECT_EQ(temperature.lastTimestamp, START + 2 * (SAMPLES - 1));
+    EXPECT_EQ(humidity.lastTimestamp, START + 2 * (SAMPLES - 1) + 1);
+
+    SeriesSummary oldest;
+    EXPECT_FALSE(mStore->Query(TEMPERATURE, START, START + 2 * (SAMPLES - temperature.count) - 1, oldest));
+}
+
+TEST_F(TimeSeriesStoreTest, SeriesAreLimited)
+{
+    for (uint8_t i = 0; i < TIMESERIES_MAX_SERIES; ++i)
+        ASSERT_TRUE(mStore->Append({i, 0, 0x80}, START, i));
+
+    EXPECT_FALSE(mStore->Append({TIMESERIES_MAX_SERIES, 0, 0x80}, START, 0.0f));
+    EXPECT_EQ(mStore->GetStatistics().rejected, 1u);
+
+    // Cleared store takes new series and keeps no samples
+    mStore->Clear();
+    SeriesSummary summary;
+    EXPECT_FALSE(mStore->Query({0, 0, 0x80}, 0, UINT32_MAX, summary));
+    EXPECT_TRUE(mStore->Append({TIMESERIES_MAX_SERIES, 0, 0x80}, START, 0.0f));
+    EXPECT_EQ(mStore->GetStatistics().series, 1u);
+}
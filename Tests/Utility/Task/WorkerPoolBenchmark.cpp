@@ -0,0 +1,174 @@
+/* Code under test */
+#include "Common_components/Utility/Task/WorkerPool.hpp"
+
+/* Test framework */
+#include <gtest/gtest.h>
+#include "Support/Benchmark.hpp"
+
+/* Host stubs */
+#include "HostRtos.hpp"
+
+/* STD library */
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Utility::Task;
+
+namespace
+{
+    // Packets received in one burst of all clients
+    constexpr size_t PACKETS = 2000;
+
+    // Stack of bluetooth data task, the same for worker and task per event
+    constexpr uint32_t STACK_SIZE = 4096;
+
+    // Free heap of server with bluetooth and WiFi running
+    constexpr size_t HEAP_LIMIT = 96 * 1024;
+
+    // Processing of one packet, decoding and publishing
+    constexpr std::chrono::microseconds HANDLING_TIME{100};
+
+    /* Result of one run */
+    struct RunResult
+    {
+        // Packets handled
+        size_t processed;
+        // Packets lost
+        size_t lost;
+        // Handled packets per second
+        double packetsPerSecond;
+        // Peak heap of kernel objects
+        size_t peakHeap;
+    };
+
+    std::atomic<size_t> processed{0};
+
+    /**
+     * @brief Handle packet, CPU is busy for handling time
+     */
+    void HandlePacket(void *, void *)
+    {
+        const auto end = std::chrono::steady_clock::now() + HANDLING_TIME;
+        while (std::chrono::steady_clock::now() < end)
+        {
+        }
+
+        ++processed;
+    }
+
+    /**
+     * @brief Task of former model, created for every packet
+     */
+    void PacketTask(void *packet)
+    {
+        HandlePacket(packet, nullptr);
+        vTaskDelete(nullptr);
+    }
+
+    /**
+     * @brief Wait until all packets are handled or lost
+     */
+    void WaitForPackets(size_t lost)
+    {
+        while (processed + lost < PACKETS)
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+        // Ended tasks return their heap
+        while (Host::RunningTasks())
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    /**
+     * @brief Create task for every packet as observer did before worker pool
+     */
+    RunResult RunTaskPerEvent()
+    {
+        processed = 0;
+        Host::ResetPeakHeap();
+        size_t lost{0};
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < PACKETS; ++i)
+        {
+            if (xTaskCreate(&PacketTask, "BluetoothDataTask", STACK_SIZE, nullptr, tskIDLE_PRIORITY, nullptr) != pdPASS)
+                ++lost;
+        }
+
+        WaitForPackets(lost);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        return {processed, lost, processed / elapsed.count(), Host::PeakHeap()};
+    }
+
+    /**
+     * @brief Submit packets to worker pool
+     */
+    RunResult RunWorkerPool(OverflowPolicy policy)
+    {
+        processed = 0;
+        Host::ResetPeakHeap();
+        size_t lost{0};
+
+        const auto start = std::chrono::steady_clock::now();
+        {
+            WorkerPool pool("BluetoothDataTask", 2, 8, policy, &HandlePacket, nullptr, nullptr, STACK_SIZE);
+            EXPECT_TRUE(pool.Start());
+
+            for (size_t i = 0; i < PACKETS; ++i)
+                pool.Submit(nullptr);
+
+            while (processed + pool.GetStatistics().dropped < PACKETS)
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+            lost = pool.GetStatistics().dropped;
+        }
+
+        // Workers are deleted with pool
+        WaitForPackets(lost);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        return {processed, lost, processed / elapsed.count(), Host::PeakHeap()};
+    }
+
+    void Report(const char *name, const RunResult &result)
+    {
+        std::printf("[ BENCHMARK] %-24s %9zu %6zu %12.0f %10zu\n", name, result.processed, result.lost, result.packetsPerSecond,
+                    result.peakHeap);
+    }
+} // namespace
+
+TEST(WorkerPoolBenchmark, SustainedPacketsAndPeakHeapAgainstTaskPerEvent)
+{
+    // Heap needed by task per event when nothing limits it
+    const auto unlimited = RunTaskPerEvent();
+
+    Host::SetHeapLimit(HEAP_LIMIT);
+
+    const auto taskPerEvent = RunTaskPerEvent();
+    const auto blocking = RunWorkerPool(OverflowPolicy::BLOCK);
+    const auto dropOldest = RunWorkerPool(OverflowPolicy::DROP_OLDEST);
+
+    Host::SetHeapLimit(0);
+
+    std::printf("[ BENCHMARK] %zu packets, %lld us of handling, heap limit %zu bytes\n", PACKETS,
+                static_cast<long long>(HANDLING_TIME.count()), HEAP_LIMIT);
+    std::printf("[ BENCHMARK] %-24s %9s %6s %12s %10s\n", "model", "processed", "lost", "packets/s", "peak heap");
+    Report("task per event, no limit", unlimited);
+    Report("task per event", taskPerEvent);
+    Report("pool, block", blocking);
+    Report("pool, drop oldest", dropOldest);
+
+    // Pool never needs more than its workers and queue
+    const size_t poolHeap = 2 * (STACK_SIZE + Host::TASK_CONTROL_BLOCK_SIZE) + Host::QUEUE_CONTROL_SIZE + 8 * sizeof(void *);
+    EXPECT_LE(blocking.peakHeap, poolHeap);
+    EXPECT_LE(dropOldest.peakHeap, poolHeap);
+
+    // Blocking producer loses nothing
+    EXPECT_EQ(blocking.processed, PACKETS);
+    EXPECT_EQ(blocking.lost, 0u);
+    EXPECT_EQ(dropOldest.processed + dropOldest.lost, PACKETS);
+    EXPECT_EQ(taskPerEvent.processed + taskPerEvent.lost, PACKETS);
+    EXPECT_EQ(unlimited.processed, PACKETS);
+    EXPECT_GT(unlimited.peakHeap, blocking.peakHeap);
+}